@@ -1,10 +1,14 @@
 /// This example demonstrates how to do a very basic NMEA multiplexer.
 /// It does not implement any error handling and other (normally necessary)
 /// stuff (configurability, error handling, etc.).
+///
+/// Sentences are written to the destinations in batches, using one
+/// write per destination for many sentences.
 
 #include <marnav/nmea/nmea.hpp>
 #include <marnav/nmea/checksum.hpp>
 #include <marnav-io/default_nmea_reader.hpp>
+#include <marnav-io/nmea_writer.hpp>
 #include <marnav-io/serial.hpp>
 #include <vector>
 
@@ -14,10 +18,10 @@ int main(int, char **)
 	using namespace marnav::io;
 
 	// prepare destinations
-	std::vector<std::unique_ptr<serial>> destinations;
-	destinations.push_back(std::make_unique<serial>("dev/ttyUSB1", serial::baud::baud_4800,
+	std::vector<nmea_writer> destinations;
+	destinations.emplace_back(std::make_unique<serial>("dev/ttyUSB1", serial::baud::baud_4800,
 		serial::databits::bit_8, serial::stopbits::bit_1, serial::parity::none));
-	destinations.push_back(std::make_unique<serial>("dev/ttyUSB2", serial::baud::baud_4800,
+	destinations.emplace_back(std::make_unique<serial>("dev/ttyUSB2", serial::baud::baud_4800,
 		serial::databits::bit_8, serial::stopbits::bit_1, serial::parity::none));
 
 	// open source device
@@ -30,12 +34,23 @@ int main(int, char **)
 			// this is used only to check the received data, e.g. if the checksum is correct.
 			auto sentence = nmea::make_sentence(data);
 
-			// send valid NMEA sentences to destinations
+			// send valid NMEA sentences to destinations, they are buffered
+			// and written if enough data is pending or after a while.
 			for (auto & destination : destinations) {
-				destination->write(data.c_str(), data.size());
+				destination.write(data);
 			}
 		} catch (nmea::checksum_error &) {
 			// let's just ignore them
 		}
+
+		// write data which is pending for too long, in case no more data is written
+		for (auto & destination : destinations) {
+			destination.poll();
+		}
+	}
+
+	// write all remaining data
+	for (auto & destination : destinations) {
+		destination.flush();
 	}
 }
@@ -0,0 +1,94 @@
+#ifndef MARNAV_IO_NMEA_WRITER_HPP
+#define MARNAV_IO_NMEA_WRITER_HPP
+
+#include <marnav-io/device.hpp>
+#include <marnav/nmea/sentence.hpp>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace marnav::io
+{
+/// This class writes NMEA sentences to a device in batches.
+///
+/// Sentences are collected (terminated by CRLF) in one contiguous buffer, which
+/// is written to the device as soon as either the buffer reaches the specified
+/// size, or the oldest pending sentence is older than the specified interval.
+/// This reduces the number of calls to `device::write` (normally system calls)
+/// per sentence significantly, which matters if data is sent to many devices.
+///
+/// The writer opens the device upon construction. Pending data is written when
+/// the writer is closed or destroyed.
+///
+/// Example:
+/// @code
+///   io::nmea_writer writer{std::make_unique<io::serial>("/dev/ttyUSB1",
+///       io::serial::baud::baud_4800, io::serial::databits::bit_8,
+///       io::serial::stopbits::bit_1, io::serial::parity::none)};
+///
+///   writer.write(raw_sentence);
+///   ...
+///   writer.poll(); // periodically, to respect the flush interval
+/// @endcode
+///
+class nmea_writer
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Counters about the written data.
+	struct statistics {
+		uint64_t sentences = 0; ///< Number of sentences written.
+		uint64_t bytes = 0; ///< Number of bytes written to the device.
+		uint64_t flushes = 0; ///< Number of flushes of the buffer.
+		uint64_t writes = 0; ///< Number of calls of `device::write`.
+		/// Time spent in `device::write` by the last flush.
+		clock::duration last_write_duration = clock::duration::zero();
+		/// Maximum time spent in `device::write` by a flush.
+		clock::duration max_write_duration = clock::duration::zero();
+
+		/// Returns the average number of bytes per call of `device::write`.
+		double bytes_per_write() const noexcept
+		{
+			return (writes > 0) ? static_cast<double>(bytes) / static_cast<double>(writes)
+								: 0.0;
+		}
+	};
+
+	constexpr static std::string::size_type default_flush_size = 1024;
+
+	~nmea_writer();
+
+	nmea_writer(std::unique_ptr<device> && d,
+		std::string::size_type flush_size = default_flush_size,
+		clock::duration flush_interval = std::chrono::milliseconds{100});
+	nmea_writer(const nmea_writer &) = delete;
+	nmea_writer(nmea_writer &&) = default;
+
+	nmea_writer & operator=(const nmea_writer &) = delete;
+	nmea_writer & operator=(nmea_writer &&) = default;
+
+	void close();
+
+	void write(const std::string & s, clock::time_point now = clock::now());
+	void write(const nmea::sentence & s, clock::time_point now = clock::now());
+
+	bool poll(clock::time_point now = clock::now());
+	void flush();
+
+	std::string::size_type pending() const noexcept { return buffer_.size(); }
+
+	const statistics & get_statistics() const noexcept { return stats_; }
+	void reset_statistics() noexcept { stats_ = statistics{}; }
+
+private:
+	std::string::size_type flush_size_;
+	clock::duration flush_interval_;
+	clock::time_point first_pending_;
+	std::string buffer_;
+	statistics stats_;
+	std::unique_ptr<device> dev_; ///< Device to write data to.
+};
+}
+
+#endif
@@ -2,7 +2,9 @@
 #define MARNAV_AIS_DECODE_HPP
 
 #include <marnav/ais/message.hpp>
+#include <marnav/utils/parse_statistics.hpp>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace marnav::ais
@@ -14,11 +16,28 @@ public:
 	using logic_error::logic_error;
 };
 
+/// The header common to all AIS messages.
+struct message_header {
+	message_id type = message_id::NONE;
+	uint32_t repeat_indicator = 0;
+	utils::mmsi mmsi;
+};
+
+/// Number of payload characters containing the message header.
+constexpr std::size_t payload_header_size = 7;
+
 std::unique_ptr<message> make_message(const std::vector<std::pair<std::string, uint32_t>> & v);
+std::unique_ptr<message> make_message(const raw & bits);
 std::vector<std::pair<std::string, uint32_t>> encode_message(const message & msg);
+raw encode_bits(const message & msg);
 
 uint8_t decode_armoring(char c);
 char encode_armoring(uint8_t value);
+void append_payload(raw & bits, const std::string & payload, uint32_t fill_bits);
+message_header peek_header(const std::string & payload);
+
+std::vector<std::pair<message_id, utils::parse_statistics>> get_parse_statistics();
+void reset_parse_statistics();
 }
 
 #endif
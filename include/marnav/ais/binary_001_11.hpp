@@ -1,7 +1,7 @@
 #ifndef MARNAV_AIS_BINARY_001_11_HPP
 #define MARNAV_AIS_BINARY_001_11_HPP
 
-#include <marnav/ais/binary_data.hpp>
+#include <marnav/ais/binary_payload.hpp>
 #include <marnav/geo/position.hpp>
 #include <optional>
 
@@ -9,7 +9,7 @@ namespace marnav::ais
 {
 /// @brief Meteorological and Hydrological Data (IMO236).
 ///
-class binary_001_11 final : public binary_data
+class binary_001_11 final : public binary_payload
 {
 public:
 	/// This offset is the size of the header of the binary message 08,
@@ -21,6 +21,9 @@ public:
 	/// the header of the message 08 must not be included in this header.
 	constexpr static uint32_t MSG08_HEAD = 56;
 
+	constexpr static uint32_t DAC = 1;
+	constexpr static uint32_t FID = 11;
+
 	constexpr static uint32_t SIZE_BITS = 352 - MSG08_HEAD;
 
 	constexpr static uint32_t lat_not_available = 0x7fffff;
@@ -66,8 +69,11 @@ public:
 		not_available = 7
 	};
 
-	void read_from(const raw & payload);
-	void write_to(raw & payload) const;
+	uint32_t get_dac() const noexcept override { return DAC; }
+	uint32_t get_fid() const noexcept override { return FID; }
+
+	void read_from(const raw_view & payload) override;
+	void write_to(raw & payload) const override;
 
 private:
 	// clang-format off
@@ -0,0 +1,124 @@
+#ifndef MARNAV_AIS_BINARY_001_22_HPP
+#define MARNAV_AIS_BINARY_001_22_HPP
+
+#include <marnav/ais/binary_payload.hpp>
+#include <marnav/geo/position.hpp>
+#include <array>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace marnav::ais
+{
+/// @brief Area Notice (IMO289).
+///
+/// The notice consists of a header and up to 10 sub-areas of 87 bits each.
+/// The shape of a sub-area determines which of the members of `sub_area`
+/// are used. Distances are in meters, multiplied by the scale factor of the
+/// sub-area (`10^scale`).
+///
+class binary_001_22 final : public binary_payload
+{
+public:
+	/// The offsets of the fields are the same as in the documentation,
+	/// which specifies them within a message 08, see `binary_001_11`.
+	constexpr static uint32_t MSG08_HEAD = 56;
+
+	constexpr static uint32_t DAC = 1;
+	constexpr static uint32_t FID = 22;
+
+	constexpr static uint32_t SIZE_BITS_HEAD = 111 - MSG08_HEAD;
+	constexpr static uint32_t SIZE_BITS_AREA = 87;
+	constexpr static uint32_t MAX_AREAS = 10;
+
+	constexpr static uint32_t month_not_available = 0;
+	constexpr static uint32_t day_not_available = 0;
+	constexpr static uint32_t hour_not_available = 24;
+	constexpr static uint32_t minute_not_available = 60;
+	constexpr static uint32_t duration_indefinite = 262143;
+	constexpr static uint32_t angle_not_available = 720;
+
+	enum class shape : uint8_t {
+		circle = 0,
+		rectangle = 1,
+		sector = 2,
+		polyline = 3,
+		polygon = 4,
+		text = 5
+	};
+
+	/// Point of a polyline or a polygon, relative to the previous point.
+	struct point {
+		uint32_t angle = angle_not_available; ///< in 0.5 degrees, `720` is not available
+		uint32_t distance = 0; ///< scaled distance
+	};
+
+	/// Sub-area of the notice.
+	struct sub_area {
+		shape type = shape::circle;
+		uint32_t scale = 0; ///< exponent of the scale factor, `0` to `3`
+
+		// circle, rectangle, sector
+		geo::position position;
+		uint32_t precision = 4; ///< number of decimal places of the position
+
+		uint32_t radius = 0; ///< circle, sector: scaled radius
+		uint32_t east_dimension = 0; ///< rectangle: scaled dimension
+		uint32_t north_dimension = 0; ///< rectangle: scaled dimension
+		uint32_t orientation = 0; ///< rectangle: degrees
+		uint32_t left_bound = 0; ///< sector: degrees
+		uint32_t right_bound = 0; ///< sector: degrees
+
+		std::array<point, 4> points; ///< polyline, polygon
+		std::string text; ///< text, up to 14 characters
+	};
+
+	uint32_t get_dac() const noexcept override { return DAC; }
+	uint32_t get_fid() const noexcept override { return FID; }
+
+	void read_from(const raw_view & payload) override;
+	void write_to(raw & payload) const override;
+
+private:
+	// clang-format off
+	bitset_value< 56 - MSG08_HEAD, 10, uint32_t> linkage_id_ = 0;
+	bitset_value< 66 - MSG08_HEAD,  7, uint32_t> notice_type_ = 0;
+	bitset_value< 73 - MSG08_HEAD,  4, uint32_t> month_ = month_not_available;
+	bitset_value< 77 - MSG08_HEAD,  5, uint32_t> day_ = day_not_available;
+	bitset_value< 82 - MSG08_HEAD,  5, uint32_t> hour_ = hour_not_available;
+	bitset_value< 87 - MSG08_HEAD,  6, uint32_t> minute_ = minute_not_available;
+	bitset_value< 93 - MSG08_HEAD, 18, uint32_t> duration_ = duration_indefinite;
+	// clang-format on
+
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.linkage_id_, s.notice_type_, s.month_, s.day_, s.hour_, s.minute_,
+			s.duration_);
+	}
+
+	std::vector<sub_area> areas_;
+
+public:
+	uint32_t get_linkage_id() const noexcept { return linkage_id_; }
+	uint32_t get_notice_type() const noexcept { return notice_type_; }
+	std::optional<uint32_t> get_month() const;
+	std::optional<uint32_t> get_day() const;
+	std::optional<uint32_t> get_hour() const;
+	std::optional<uint32_t> get_minute() const;
+	std::optional<uint32_t> get_duration() const;
+	const std::vector<sub_area> & get_areas() const noexcept { return areas_; }
+
+	void set_linkage_id(uint32_t t) noexcept { linkage_id_ = t; }
+	void set_notice_type(uint32_t t) noexcept { notice_type_ = t; }
+	void set_month(std::optional<uint32_t> t);
+	void set_day(std::optional<uint32_t> t);
+	void set_hour(std::optional<uint32_t> t);
+	void set_minute(std::optional<uint32_t> t);
+	void set_duration(std::optional<uint32_t> t);
+	void set_areas(const std::vector<sub_area> & t);
+};
+}
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef MARNAV_AIS_BINARY_001_31_HPP
+#define MARNAV_AIS_BINARY_001_31_HPP
+
+#include <marnav/ais/binary_payload.hpp>
+#include <marnav/geo/position.hpp>
+#include <optional>
+
+namespace marnav::ais
+{
+/// @brief Meteorological and Hydrographic Data (IMO289).
+///
+/// Successor of `binary_001_11` (IMO236), with signed temperatures, a higher
+/// resolution of the water level and a different position encoding.
+///
+class binary_001_31 final : public binary_payload
+{
+public:
+	/// The offsets of the fields are the same as in the documentation,
+	/// which specifies them within a message 08, see `binary_001_11`.
+	constexpr static uint32_t MSG08_HEAD = 56;
+
+	constexpr static uint32_t DAC = 1;
+	constexpr static uint32_t FID = 31;
+
+	constexpr static uint32_t SIZE_BITS = 360 - MSG08_HEAD;
+
+	constexpr static uint32_t lon_not_available = 181 * 60000;
+	constexpr static uint32_t lat_not_available = 91 * 60000;
+	constexpr static uint32_t day_not_available = 0;
+	constexpr static uint32_t hour_not_available = 24;
+	constexpr static uint32_t minute_not_available = 60;
+	constexpr static uint32_t wind_speed_not_available = 127;
+	constexpr static uint32_t wind_direction_not_available = 360;
+	constexpr static uint32_t air_temperature_not_available = 0x400; // -1024
+	constexpr static uint32_t humidity_not_available = 101;
+	constexpr static uint32_t dew_point_not_available = 501;
+	constexpr static uint32_t pressure_not_available = 511;
+	constexpr static uint32_t visibility_not_available = 127;
+	constexpr static uint32_t water_level_not_available = 4001;
+	constexpr static uint32_t current_speed_not_available = 255;
+	constexpr static uint32_t current_direction_not_available = 360;
+	constexpr static uint32_t current_depth_not_available = 31;
+	constexpr static uint32_t wave_height_not_available = 255;
+	constexpr static uint32_t wave_period_not_available = 63;
+	constexpr static uint32_t wave_direction_not_available = 360;
+	constexpr static uint32_t sea_state_not_available = 13;
+	constexpr static uint32_t water_temperature_not_available = 501;
+	constexpr static uint32_t salinity_not_available = 510;
+
+	enum class trend : uint8_t {
+		steady = 0,
+		decreasing = 1,
+		increasing = 2,
+		not_available = 3
+	};
+
+	enum class ice : uint8_t { no = 0, yes = 1, not_available = 3 };
+
+	enum class precipitation : uint8_t {
+		rain = 1,
+		thunderstorm = 2,
+		freezing_rain = 3,
+		mixed_ice = 4,
+		snow = 5,
+		not_available = 7
+	};
+
+	uint32_t get_dac() const noexcept override { return DAC; }
+	uint32_t get_fid() const noexcept override { return FID; }
+
+	void read_from(const raw_view & payload) override;
+	void write_to(raw & payload) const override;
+
+private:
+	// clang-format off
+	bitset_value< 56 - MSG08_HEAD, 25, uint32_t     > lon_ = lon_not_available;
+	bitset_value< 81 - MSG08_HEAD, 24, uint32_t     > lat_ = lat_not_available;
+	bitset_value<105 - MSG08_HEAD,  1, bool         > position_accuracy_ = false;
+	bitset_value<106 - MSG08_HEAD,  5, uint32_t     > day_ = day_not_available;
+	bitset_value<111 - MSG08_HEAD,  5, uint32_t     > hour_ = hour_not_available;
+	bitset_value<116 - MSG08_HEAD,  6, uint32_t     > minute_ = minute_not_available;
+	bitset_value<122 - MSG08_HEAD,  7, uint32_t     > wind_speed_avg_ = wind_speed_not_available;
+	bitset_value<129 - MSG08_HEAD,  7, uint32_t     > wind_gust_ = wind_speed_not_available;
+	bitset_value<136 - MSG08_HEAD,  9, uint32_t     > wind_direction_ = wind_direction_not_available;
+	bitset_value<145 - MSG08_HEAD,  9, uint32_t     > wind_gust_direction_ = wind_direction_not_available;
+	bitset_value<154 - MSG08_HEAD, 11, uint32_t     > air_temperature_ = air_temperature_not_available;
+	bitset_value<165 - MSG08_HEAD,  7, uint32_t     > humidity_ = humidity_not_available;
+	bitset_value<172 - MSG08_HEAD, 10, uint32_t     > dew_point_ = dew_point_not_available;
+	bitset_value<182 - MSG08_HEAD,  9, uint32_t     > pressure_ = pressure_not_available;
+	bitset_value<191 - MSG08_HEAD,  2, trend        > pressure_trend_ = trend::not_available;
+	bitset_value<193 - MSG08_HEAD,  1, bool         > visibility_greater_ = false;
+	bitset_value<194 - MSG08_HEAD,  7, uint32_t     > visibility_ = visibility_not_available;
+	bitset_value<201 - MSG08_HEAD, 12, uint32_t     > water_level_ = water_level_not_available;
+	bitset_value<213 - MSG08_HEAD,  2, trend        > water_level_trend_ = trend::not_available;
+	bitset_value<215 - MSG08_HEAD,  8, uint32_t     > surface_current_speed_ = current_speed_not_available;
+	bitset_value<223 - MSG08_HEAD,  9, uint32_t     > surface_current_direction_ = current_direction_not_available;
+	bitset_value<232 - MSG08_HEAD,  8, uint32_t     > current_2_speed_ = current_speed_not_available;
+	bitset_value<240 - MSG08_HEAD,  9, uint32_t     > current_2_direction_ = current_direction_not_available;
+	bitset_value<249 - MSG08_HEAD,  5, uint32_t     > current_2_depth_ = current_depth_not_available;
+	bitset_value<254 - MSG08_HEAD,  8, uint32_t     > current_3_speed_ = current_speed_not_available;
+	bitset_value<262 - MSG08_HEAD,  9, uint32_t     > current_3_direction_ = current_direction_not_available;
+	bitset_value<271 - MSG08_HEAD,  5, uint32_t     > current_3_depth_ = current_depth_not_available;
+	bitset_value<276 - MSG08_HEAD,  8, uint32_t     > wave_height_ = wave_height_not_available;
+	bitset_value<284 - MSG08_HEAD,  6, uint32_t     > wave_period_ = wave_period_not_available;
+	bitset_value<290 - MSG08_HEAD,  9, uint32_t     > wave_direction_ = wave_direction_not_available;
+	bitset_value<299 - MSG08_HEAD,  8, uint32_t     > swell_height_ = wave_height_not_available;
+	bitset_value<307 - MSG08_HEAD,  6, uint32_t     > swell_period_ = wave_period_not_available;
+	bitset_value<313 - MSG08_HEAD,  9, uint32_t     > swell_direction_ = wave_direction_not_available;
+	bitset_value<322 - MSG08_HEAD,  4, uint32_t     > sea_state_ = sea_state_not_available;
+	bitset_value<326 - MSG08_HEAD, 10, uint32_t     > water_temperature_ = water_temperature_not_available;
+	bitset_value<336 - MSG08_HEAD,  3, precipitation> precipitation_type_ = precipitation::not_available;
+	bitset_value<339 - MSG08_HEAD,  9, uint32_t     > salinity_ = salinity_not_available;
+	bitset_value<348 - MSG08_HEAD,  2, ice          > ice_info_ = ice::not_available;
+	// clang-format on
+
+	/// Layout of the payload, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.lon_, s.lat_, s.position_accuracy_, s.day_, s.hour_, s.minute_,
+			s.wind_speed_avg_, s.wind_gust_, s.wind_direction_, s.wind_gust_direction_,
+			s.air_temperature_, s.humidity_, s.dew_point_, s.pressure_, s.pressure_trend_,
+			s.visibility_greater_, s.visibility_, s.water_level_, s.water_level_trend_,
+			s.surface_current_speed_, s.surface_current_direction_, s.current_2_speed_,
+			s.current_2_direction_, s.current_2_depth_, s.current_3_speed_,
+			s.current_3_direction_, s.current_3_depth_, s.wave_height_, s.wave_period_,
+			s.wave_direction_, s.swell_height_, s.swell_period_, s.swell_direction_,
+			s.sea_state_, s.water_temperature_, s.precipitation_type_, s.salinity_,
+			s.ice_info_);
+	}
+
+public:
+	std::optional<geo::position> get_position() const;
+	bool get_position_accuracy() const noexcept { return position_accuracy_; }
+	std::optional<uint32_t> get_day() const;
+	std::optional<uint32_t> get_hour() const;
+	std::optional<uint32_t> get_minute() const;
+	std::optional<uint32_t> get_wind_speed_avg() const;
+	std::optional<uint32_t> get_wind_gust() const;
+	std::optional<uint32_t> get_wind_direction() const;
+	std::optional<uint32_t> get_wind_gust_direction() const;
+	std::optional<double> get_air_temperature() const;
+	std::optional<uint32_t> get_humidity() const;
+	std::optional<double> get_dew_point() const;
+	std::optional<uint32_t> get_pressure() const;
+	std::optional<trend> get_pressure_trend() const;
+	bool get_visibility_greater() const noexcept { return visibility_greater_; }
+	std::optional<double> get_visibility() const;
+	std::optional<double> get_water_level() const;
+	std::optional<trend> get_water_level_trend() const;
+	std::optional<double> get_surface_current_speed() const;
+	std::optional<uint32_t> get_surface_current_direction() const;
+	std::optional<double> get_current_2_speed() const;
+	std::optional<uint32_t> get_current_2_direction() const;
+	std::optional<uint32_t> get_current_2_depth() const;
+	std::optional<double> get_current_3_speed() const;
+	std::optional<uint32_t> get_current_3_direction() const;
+	std::optional<uint32_t> get_current_3_depth() const;
+	std::optional<double> get_wave_height() const;
+	std::optional<uint32_t> get_wave_period() const;
+	std::optional<uint32_t> get_wave_direction() const;
+	std::optional<double> get_swell_height() const;
+	std::optional<uint32_t> get_swell_period() const;
+	std::optional<uint32_t> get_swell_direction() const;
+	std::optional<uint32_t> get_sea_state() const;
+	std::optional<double> get_water_temperature() const;
+	std::optional<precipitation> get_precipitation() const;
+	std::optional<double> get_salinity() const;
+	std::optional<ice> get_ice() const;
+
+	void set_position(std::optional<geo::position> t);
+	void set_position_accuracy(bool t) noexcept { position_accuracy_ = t; }
+	void set_day(std::optional<uint32_t> t);
+	void set_hour(std::optional<uint32_t> t);
+	void set_minute(std::optional<uint32_t> t);
+	void set_wind_speed_avg(std::optional<uint32_t> t);
+	void set_wind_gust(std::optional<uint32_t> t);
+	void set_wind_direction(std::optional<uint32_t> t);
+	void set_wind_gust_direction(std::optional<uint32_t> t);
+	void set_air_temperature(std::optional<double> t);
+	void set_humidity(std::optional<uint32_t> t);
+	void set_dew_point(std::optional<double> t);
+	void set_pressure(std::optional<uint32_t> t);
+	void set_pressure_trend(std::optional<trend> t);
+	void set_visibility_greater(bool t) noexcept { visibility_greater_ = t; }
+	void set_visibility(std::optional<double> t);
+	void set_water_level(std::optional<double> t);
+	void set_water_level_trend(std::optional<trend> t);
+	void set_surface_current_speed(std::optional<double> t);
+	void set_surface_current_direction(std::optional<uint32_t> t);
+	void set_current_2_speed(std::optional<double> t);
+	void set_current_2_direction(std::optional<uint32_t> t);
+	void set_current_2_depth(std::optional<uint32_t> t);
+	void set_current_3_speed(std::optional<double> t);
+	void set_current_3_direction(std::optional<uint32_t> t);
+	void set_current_3_depth(std::optional<uint32_t> t);
+	void set_wave_height(std::optional<double> t);
+	void set_wave_period(std::optional<uint32_t> t);
+	void set_wave_direction(std::optional<uint32_t> t);
+	void set_swell_height(std::optional<double> t);
+	void set_swell_period(std::optional<uint32_t> t);
+	void set_swell_direction(std::optional<uint32_t> t);
+	void set_sea_state(std::optional<uint32_t> t);
+	void set_water_temperature(std::optional<double> t);
+	void set_precipitation(std::optional<precipitation> t);
+	void set_salinity(std::optional<double> t);
+	void set_ice(std::optional<ice> t);
+};
+}
+
+#endif
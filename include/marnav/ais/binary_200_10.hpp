@@ -1,13 +1,13 @@
 #ifndef MARNAV_AIS_BINARY_200_10_HPP
 #define MARNAV_AIS_BINARY_200_10_HPP
 
-#include <marnav/ais/binary_data.hpp>
+#include <marnav/ais/binary_payload.hpp>
 
 namespace marnav::ais
 {
 /// @brief Inland ship static and voyage related data (Inland AIS).
 ///
-class binary_200_10 final : public binary_data
+class binary_200_10 final : public binary_payload
 {
 public:
 	/// This offset is the size of the header of the binary message 08,
@@ -19,14 +19,20 @@ public:
 	/// the header of the message 08 must not be included in this header.
 	constexpr static uint32_t MSG08_HEAD = 56;
 
+	constexpr static uint32_t DAC = 200;
+	constexpr static uint32_t FID = 10;
+
 	constexpr static uint32_t SIZE_BITS = 168 - MSG08_HEAD;
 
 	enum class loaded_state : uint8_t { not_available = 0, unloaded = 1, loaded = 2 };
 
 	binary_200_10();
 
-	void read_from(const raw & payload);
-	void write_to(raw & payload) const;
+	uint32_t get_dac() const noexcept override { return DAC; }
+	uint32_t get_fid() const noexcept override { return FID; }
+
+	void read_from(const raw_view & payload) override;
+	void write_to(raw & payload) const override;
 
 private:
 	// clang-format off
@@ -2,13 +2,27 @@
 #define MARNAV_AIS_BINARY_DATA_HPP
 
 #include <marnav/utils/bitset.hpp>
+#include <marnav/utils/bitset_view.hpp>
+#include <marnav/utils/static_vector.hpp>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <cstdint>
 
 namespace marnav::ais
 {
-/// Type for raw AIS data.
-using raw = utils::bitset<uint8_t>;
+/// Maximum number of bits of raw AIS data. AIS messages occupy at most five
+/// slots (1008 bits of data).
+constexpr std::size_t raw_max_bits = 1024;
+
+/// Type for raw AIS data. Since the size of AIS messages is limited, the data
+/// is stored inline, decoding and encoding messages does not allocate memory
+/// for the data.
+using raw = utils::bitset<uint8_t, utils::static_vector<uint8_t, raw_max_bits / 8>>;
+
+/// Read only view of raw AIS data, or parts of it. Data is decoded in place,
+/// without copying it.
+using raw_view = utils::bitset_view<raw::block_type>;
 
 /// @{
 
@@ -79,7 +93,10 @@ protected:
 	/// @{
 
 	static std::string read_string(
-		const raw & bits, raw::size_type ofs, raw::size_type count_sixbits);
+		const raw_view & bits, raw::size_type ofs, raw::size_type count_sixbits);
+
+	static std::string read_trimmed_string(
+		const raw_view & bits, raw::size_type ofs, raw::size_type count_sixbits);
 
 	static void write_string(
 		raw & bits, raw::size_type ofs, raw::size_type count_sixbits, const std::string & s);
@@ -92,12 +109,12 @@ protected:
 	/// This is the `enum` variant.
 	///
 	/// @tparam T `bitset_value` type.
-	/// @param[in] bits The AIS message to read from.
+	/// @param[in] bits The AIS message (or a part of it) to read from.
 	/// @param[out] t The data read from the message.
 	///
 	template <typename T,
 		typename std::enable_if<std::is_enum<typename T::value_type>::value, int>::type = 0>
-	static void get(const raw & bits, T & t)
+	static void get(const raw_view & bits, T & t)
 	{
 		typename std::underlying_type<typename T::value_type>::type tmp;
 		bits.get(tmp, T::offset, T::count);
@@ -109,7 +126,7 @@ protected:
 	template <typename T,
 		typename std::enable_if<std::is_same<typename T::value_type, bool>::value, int>::type
 		= 0>
-	static void get(const raw & bits, T & t)
+	static void get(const raw_view & bits, T & t)
 	{
 		t = bits.get_bit(T::offset);
 	}
@@ -122,7 +139,7 @@ protected:
 				&& !std::is_same<typename T::value_type, std::string>::value,
 			int>::type
 		= 0>
-	static void get(const raw & bits, T & t)
+	static void get(const raw_view & bits, T & t)
 	{
 		bits.get(t.value_, T::offset, T::count);
 	}
@@ -135,13 +152,27 @@ protected:
 				&& std::is_same<typename T::value_type, std::string>::value,
 			int>::type
 		= 0>
-	static void get(const raw & bits, T & t)
+	static void get(const raw_view & bits, T & t)
 	{
 		t.value_ = read_string(bits, T::offset, T::count);
 	}
 
 	/// @}
 
+	/// Reads the datum specified by the `bitset_value` type directly from the
+	/// bits and returns it, without the need of an object holding the value.
+	///
+	/// @tparam T `bitset_value` type.
+	/// @param[in] bits The AIS message (or a part of it) to read from.
+	/// @return The `bitset_value` holding the data read from the message.
+	template <typename T>
+	static T read(const raw_view & bits)
+	{
+		T t{typename T::value_type{}};
+		get(bits, t);
+		return t;
+	}
+
 	/// @{
 
 	/// Writes data to the AIS message (bitset).
@@ -197,6 +228,72 @@ protected:
 	}
 
 	/// @}
+
+	/// @{
+
+	/// Reads all fields of a layout from the AIS message.
+	///
+	/// The layout is a tuple of references to `bitset_value` members, normally
+	/// created by `std::tie`. Listing the fields of a message once, as layout,
+	/// makes it possible to generate decoding, encoding and the checks of
+	/// the layout (see `is_valid_layout`) from the same definition.
+	///
+	/// @param[in] bits The AIS message (or a part of it) to read from.
+	/// @param[out] fields The layout, tuple of references to the fields to be read.
+	template <typename Tuple>
+	static void get_fields(const raw_view & bits, Tuple && fields)
+	{
+		std::apply([&bits](auto &... t) { (get(bits, t), ...); }, fields);
+	}
+
+	/// Writes all fields of a layout to the AIS message.
+	/// @see get_fields
+	template <typename Tuple>
+	static void set_fields(raw & bits, const Tuple & fields)
+	{
+		std::apply([&bits](const auto &... t) { (set(bits, t), ...); }, fields);
+	}
+
+	/// Returns the number of bits occupied by the `bitset_value` type.
+	template <typename T>
+	static constexpr std::size_t field_bits() noexcept
+	{
+		return std::is_same<typename T::value_type, std::string>::value ? T::count * 6
+																		 : T::count;
+	}
+
+	/// Checks the layout at compile time: the fields must be ordered by
+	/// their offsets, must not overlap and must lie within the specified range.
+	///
+	/// Gaps between fields are permitted, they are the spare bits of the messages.
+	///
+	/// @tparam Tuple Type of the layout, see `get_fields`.
+	/// @param[in] begin Offset of the first bit available to the fields.
+	/// @param[in] end Offset of the first bit after the fields.
+	/// @return `true` if the layout is valid.
+	template <typename Tuple>
+	static constexpr bool is_valid_layout(std::size_t begin, std::size_t end) noexcept
+	{
+		return check_layout(static_cast<std::decay_t<Tuple> *>(nullptr), begin, end);
+	}
+
+	/// @}
+
+private:
+	template <typename... Ts>
+	static constexpr bool check_layout(
+		std::tuple<Ts...> *, std::size_t begin, std::size_t end) noexcept
+	{
+		bool valid = true;
+		std::size_t pos = begin;
+		(
+			[&](std::size_t offset, std::size_t n) {
+				valid = valid && (offset >= pos) && (offset + n <= end);
+				pos = offset + n;
+			}(std::decay_t<Ts>::offset, field_bits<std::decay_t<Ts>>()),
+			...);
+		return valid;
+	}
 };
 }
 
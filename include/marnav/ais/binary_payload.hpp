@@ -0,0 +1,38 @@
+#ifndef MARNAV_AIS_BINARY_PAYLOAD_HPP
+#define MARNAV_AIS_BINARY_PAYLOAD_HPP
+
+#include <marnav/ais/binary_data.hpp>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Base class of application specific payloads of binary messages
+/// (types 6 and 8), identified by the designated area code (DAC) and the
+/// function identifier (FID).
+///
+/// The payload begins after the header of the binary message, offsets of
+/// derived classes are relative to the end of the header. Derived classes
+/// provide the static constants `DAC` and `FID` to be used with the
+/// `binary_registry`.
+///
+class binary_payload : public binary_data
+{
+public:
+	virtual ~binary_payload() = default;
+
+	virtual uint32_t get_dac() const noexcept = 0;
+	virtual uint32_t get_fid() const noexcept = 0;
+
+	virtual void read_from(const raw_view & payload) = 0;
+	virtual void write_to(raw & payload) const = 0;
+
+protected:
+	binary_payload() = default;
+	binary_payload(const binary_payload &) = default;
+	binary_payload & operator=(const binary_payload &) = default;
+	binary_payload(binary_payload &&) = default;
+	binary_payload & operator=(binary_payload &&) = default;
+};
+}
+
+#endif
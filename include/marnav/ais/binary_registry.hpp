@@ -0,0 +1,98 @@
+#ifndef MARNAV_AIS_BINARY_REGISTRY_HPP
+#define MARNAV_AIS_BINARY_REGISTRY_HPP
+
+#include <marnav/ais/binary_payload.hpp>
+#include <marnav/ais/message.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Creates application specific payloads of binary messages (types 6 and 8)
+/// by the message type, DAC and FID.
+///
+/// The FIDs are allocated separately for addressed (type 6) and broadcast (type 8)
+/// messages, the same DAC and FID may denote different payloads in both. Payloads
+/// are therefore registered per message type. All payloads provided by this
+/// library are broadcast payloads.
+///
+/// The lookup is done in constant time, by a table per message type indexed by
+/// the DAC, referring to tables indexed by the FID. The tables of FIDs are allocated
+/// only for DACs which have registered payloads.
+///
+/// The payload is decoded directly from the bits of the binary message, without
+/// decoding the message itself and without copying the payload.
+///
+/// The registry returned by `binary_registry::standard` contains all payloads
+/// provided by this library. Users may copy it and add their own payloads at
+/// startup. Adding payloads is not thread safe, decoding with a registry which
+/// is not modified anymore is.
+///
+/// Example:
+/// @code
+///   auto registry = ais::binary_registry::standard();
+///   registry.add<my_payload>(); // broadcast, type 8
+///   registry.add<my_addressed_payload>(ais::message_id::binary_addressed_message);
+///
+///   auto payload = registry.decode(bits);
+///   if (payload && payload->get_fid() == ais::binary_001_31::FID) {
+///       const auto & meteo = static_cast<const ais::binary_001_31 &>(*payload);
+///       ...
+///   }
+/// @endcode
+///
+class binary_registry
+{
+public:
+	/// Creates a default constructed payload.
+	using factory = std::unique_ptr<binary_payload> (*)();
+
+	constexpr static uint32_t NUM_DAC = 1024; // 10 bits
+	constexpr static uint32_t NUM_FID = 64; // 6 bits
+
+	binary_registry() = default;
+
+	binary_registry(const binary_registry &) = default;
+	binary_registry & operator=(const binary_registry &) = default;
+	binary_registry(binary_registry &&) = default;
+	binary_registry & operator=(binary_registry &&) = default;
+
+	static binary_registry standard();
+
+	void add(message_id type, uint32_t dac, uint32_t fid, factory f);
+
+	/// Registers the payload type `T` for the specified message type, `T` must
+	/// provide the constants `T::DAC` and `T::FID` and must be default constructible.
+	template <class T>
+	void add(message_id type = message_id::binary_broadcast_message)
+	{
+		add(type, T::DAC, T::FID, &create<T>);
+	}
+
+	bool contains(message_id type, uint32_t dac, uint32_t fid) const noexcept;
+
+	std::unique_ptr<binary_payload> make(message_id type, uint32_t dac, uint32_t fid) const;
+
+	std::unique_ptr<binary_payload> decode(const raw & bits) const;
+
+private:
+	using fid_table = std::array<factory, NUM_FID>;
+
+	/// Per message type (addressed, broadcast): index into `tables_` plus one,
+	/// zero if the DAC has no registered payloads.
+	std::array<std::array<uint16_t, NUM_DAC>, 2> index_ = {};
+	std::vector<fid_table> tables_;
+
+	factory find(message_id type, uint32_t dac, uint32_t fid) const noexcept;
+
+	template <class T>
+	static std::unique_ptr<binary_payload> create()
+	{
+		return std::make_unique<T>();
+	}
+};
+}
+
+#endif
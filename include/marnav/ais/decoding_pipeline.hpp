@@ -0,0 +1,109 @@
+#ifndef MARNAV_AIS_DECODING_PIPELINE_HPP
+#define MARNAV_AIS_DECODING_PIPELINE_HPP
+
+#include <marnav/ais/binary_data.hpp>
+#include <marnav/utils/mmsi.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+class message;
+
+/// @brief Decodes AIS messages in parallel, preserving the order of the messages
+/// of each vessel.
+///
+/// Messages are distributed among a number of shards by the MMSI, which is read
+/// from the header of the message (the first fragment) without decoding the
+/// message. Each shard has a worker thread and a bounded lock free queue, to
+/// which the single producer writes the message in place: either the raw data,
+/// or the NMEA payloads as they are.
+///
+/// The worker decodes the armoring of the NMEA payloads (`append_payload`) and
+/// the messages (`make_message`), and hands them to the handler, in the order
+/// they were pushed. The producer only reads the header of the first payload. All messages of a vessel are processed by the
+/// same worker, per vessel state may therefore be kept per shard and updated
+/// without locking. The handler is called concurrently for different shards.
+/// Exceptions thrown by the handler are caught by the worker and counted
+/// (`statistics::handler_failed`), the worker continues with the next message.
+///
+/// If the queue of a shard is full, `push` either waits for the worker
+/// (`overflow::block`) or drops the message (`overflow::drop`).
+///
+/// Example:
+/// @code
+///   std::vector<ais::static_data_cache> caches(4);
+///   ais::decoding_pipeline pipeline{caches.size(),
+///       [&caches](std::size_t shard, std::unique_ptr<ais::message> m) {
+///           caches[shard].update(*m);
+///       }};
+///
+///   // single producer, e.g. after nmea::ais_reassembler
+///   pipeline.push(payload);
+///   ...
+///   pipeline.flush();
+/// @endcode
+///
+class decoding_pipeline
+{
+public:
+	/// Called by the worker of the shard for each decoded message.
+	using handler = std::function<void(std::size_t shard, std::unique_ptr<message> m)>;
+
+	/// Behaviour of `push` if the queue of the shard is full.
+	enum class overflow { block, drop };
+
+	/// Counters of the processed messages, summed over all shards.
+	struct statistics {
+		uint64_t messages = 0; ///< Number of messages pushed into the queues.
+		uint64_t dropped = 0; ///< Number of messages dropped, queue was full.
+		uint64_t decoded = 0; ///< Number of messages decoded and handled.
+		uint64_t failed = 0; ///< Number of messages failed to decode (payload or message).
+		uint64_t handler_failed = 0; ///< Number of messages the handler threw an exception for.
+	};
+
+	decoding_pipeline(std::size_t shards, handler h, std::size_t queue_capacity = 1024,
+		overflow policy = overflow::block);
+	~decoding_pipeline();
+
+	decoding_pipeline(const decoding_pipeline &) = delete;
+	decoding_pipeline & operator=(const decoding_pipeline &) = delete;
+	decoding_pipeline(decoding_pipeline &&) = delete;
+	decoding_pipeline & operator=(decoding_pipeline &&) = delete;
+
+	/// Returns the number of shards (worker threads).
+	std::size_t shards() const noexcept { return shards_.size(); }
+
+	std::size_t shard_of(const utils::mmsi & mmsi) const noexcept;
+
+	bool push(const raw & bits);
+	bool push(const std::vector<std::pair<std::string, uint32_t>> & payload);
+
+	void flush() const;
+
+	std::size_t depth(std::size_t index) const;
+
+	statistics get_statistics() const noexcept;
+
+private:
+	struct entry;
+	struct shard;
+
+	handler handler_;
+	overflow policy_;
+	std::vector<std::unique_ptr<shard>> shards_;
+	std::vector<std::thread> workers_;
+	std::atomic<bool> stop_{false};
+
+	entry * acquire(shard & s);
+	void run(shard & s);
+};
+}
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef MARNAV_AIS_DUPLICATE_FILTER_HPP
+#define MARNAV_AIS_DUPLICATE_FILTER_HPP
+
+#include <marnav/ais/binary_data.hpp>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Drops AIS messages received more than once, e.g. by overlapping
+/// shore stations and satellites.
+///
+/// Messages are identified by a hash of their raw data, the message type and
+/// the MMSI. A message is passed if it was not seen within the time window,
+/// all further arrivals within the window are duplicates.
+///
+/// The seen messages are kept in a hash table of fixed capacity, the memory used
+/// does not grow. Entries older than the window are reused, if there are no such
+/// entries the oldest one nearby is evicted. The capacity should exceed the number
+/// of messages received within the window.
+///
+/// Optionally the receivers of each message are recorded (identified by numbers
+/// 0 to 63), for example to assess the coverage of shore stations.
+///
+/// Example:
+/// @code
+///   ais::duplicate_filter dedup{8192, std::chrono::seconds{10}};
+///
+///   ais::raw bits;
+///   ais::append_payload(bits, payload, fill_bits);
+///   if (dedup.process(bits, station_index)) {
+///       // first arrival, decode and process
+///   }
+/// @endcode
+///
+class duplicate_filter
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Maximum number of distinguished receivers.
+	static constexpr uint32_t max_receivers = 64;
+
+	/// Counters of the processed messages.
+	struct statistics {
+		uint64_t messages = 0; ///< Number of messages presented to the filter.
+		uint64_t duplicates = 0; ///< Number of messages dropped as duplicates.
+		uint64_t evicted = 0; ///< Entries evicted before the end of the window.
+	};
+
+	explicit duplicate_filter(
+		std::size_t capacity = 4096, clock::duration window = std::chrono::seconds{10});
+
+	duplicate_filter(const duplicate_filter &) = default;
+	duplicate_filter & operator=(const duplicate_filter &) = default;
+	duplicate_filter(duplicate_filter &&) = default;
+	duplicate_filter & operator=(duplicate_filter &&) = default;
+
+	/// Returns the number of entries of the hash table.
+	std::size_t capacity() const noexcept { return entries_.size(); }
+
+	bool process(const raw & bits, uint32_t receiver = 0, clock::time_point now = clock::now());
+
+	uint64_t receivers(const raw & bits, clock::time_point now = clock::now()) const;
+
+	const statistics & get_statistics() const noexcept { return stats_; }
+	void reset_statistics() noexcept { stats_ = statistics{}; }
+
+	void clear() noexcept;
+
+private:
+	struct entry {
+		uint64_t hash = 0;
+		uint32_t mmsi = 0;
+		bool used = false;
+		clock::time_point first; // first arrival
+		uint64_t receivers = 0; // bit mask
+	};
+
+	/// Number of entries searched for a message, limits the cost of a lookup.
+	static constexpr std::size_t max_probe = 8;
+
+	clock::duration window_;
+	std::vector<entry> entries_;
+	statistics stats_;
+
+	bool expired(const entry & e, clock::time_point now) const noexcept;
+	std::size_t find(uint64_t hash, uint32_t mmsi, clock::time_point now) const noexcept;
+};
+}
+
+#endif
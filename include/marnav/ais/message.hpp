@@ -2,6 +2,7 @@
 #define MARNAV_AIS_MESSAGE_HPP
 
 #include <marnav/ais/binary_data.hpp>
+#include <marnav/utils/mmsi.hpp>
 #include <memory>
 #include <string>
 
@@ -302,6 +303,7 @@ constexpr static const uint32_t second_not_available = 60;
 class message : public binary_data
 {
 	friend std::vector<std::pair<std::string, uint32_t>> encode_message(const message & msg);
+	friend raw encode_bits(const message & msg);
 
 public:
 	virtual ~message() = default;
@@ -325,6 +327,69 @@ private:
 	message_id message_type_;
 };
 
+/// @brief Read only view of the raw data of an AIS message.
+///
+/// In contrast to `message`, the fields are not decoded at construction, but
+/// read directly from the bits on access. Filtering messages, e.g. by type or
+/// MMSI, therefore decodes only the bits actually needed.
+///
+/// The view does not own the data, the raw data must outlive the view.
+///
+/// This class provides access to the header, which is common to all messages.
+/// Message types provide their specific views as nested class `view`
+/// (e.g. `message_01::view`), which use the same data layout as the message.
+///
+/// @code
+///   ais::raw bits;
+///   ais::append_payload(bits, payload, fill_bits);
+///   const ais::message_view header{bits};
+///   if (header.get_mmsi() == wanted) {
+///       ...
+///   }
+/// @endcode
+class message_view : public binary_data
+{
+public:
+	constexpr static std::size_t SIZE_BITS_HEAD = 38u;
+
+	/// @exception std::invalid_argument Not enough bits for the header.
+	explicit message_view(const raw_view & bits)
+		: bits_(bits)
+	{
+		if (bits_.size() < SIZE_BITS_HEAD)
+			throw std::invalid_argument{"invalid number of bits in ais/message_view"};
+	}
+
+	message_view(const message_view &) = default;
+	message_view & operator=(const message_view &) = default;
+	message_view(message_view &&) = default;
+	message_view & operator=(message_view &&) = default;
+
+	message_id type() const { return field<type_field>(); }
+	uint32_t get_repeat_indicator() const { return field<repeat_indicator_field>(); }
+	utils::mmsi get_mmsi() const { return utils::mmsi{field<mmsi_field>()}; }
+
+	/// Returns the raw data of the message.
+	const raw_view & get_raw() const noexcept { return bits_; }
+
+protected:
+	/// Reads the datum specified by the `bitset_value` type from the message.
+	template <typename T>
+	T field() const
+	{
+		return read<T>(bits_);
+	}
+
+private:
+	// clang-format off
+	using type_field             = bitset_value< 0,  6, message_id>;
+	using repeat_indicator_field = bitset_value< 6,  2, uint32_t  >;
+	using mmsi_field             = bitset_value< 8, 30, uint32_t  >;
+	// clang-format on
+
+	raw_view bits_;
+};
+
 /// @cond DEV
 namespace detail
 {
@@ -349,6 +414,13 @@ public:
 	{
 		return std::unique_ptr<T>(new T{bits});
 	}
+
+	template <class T,
+		typename std::enable_if<std::is_base_of<message, T>::value, int>::type = 0>
+	static T create(const raw & bits)
+	{
+		return T{bits};
+	}
 };
 }
 /// @endcond
@@ -362,6 +434,33 @@ std::unique_ptr<message> message_parse(const raw & bits)
 	return detail::factory::parse<T>(bits);
 }
 
+/// Creates a message of the specified type directly from the decoded data.
+///
+/// In contrast to `make_message` the message is returned by value, therefore
+/// no memory is allocated on the heap, as long as the message itself does
+/// not allocate (e.g. for long strings).
+///
+/// @code
+///   ais::raw bits;
+///   ais::append_payload(bits, payload, fill_bits);
+///   if (bits.get<ais::message_id>(0, 6) == ais::message_01::ID) {
+///       const auto m = ais::create_message<ais::message_01>(bits);
+///       ...
+///   }
+/// @endcode
+///
+/// @param[in] bits The complete message data.
+/// @return The message.
+/// @exception std::invalid_argument The data does not contain a message of the
+///   specified type, or the message could not be parsed.
+template <class T, typename std::enable_if<std::is_base_of<message, T>::value, int>::type = 0>
+T create_message(const raw & bits)
+{
+	if ((bits.size() < 6) || (bits.get<message_id>(0, 6) != T::ID))
+		throw std::invalid_argument{"invalid message type in ais/create_message"};
+	return detail::factory::create<T>(bits);
+}
+
 /// @{
 
 /// Casts the specified message to the message given by the template parameter.
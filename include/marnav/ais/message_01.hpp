@@ -49,6 +49,15 @@ private:
 	bitset_value<149, 19, uint32_t             > radio_status_ = 0;
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.nav_status_, s.rot_, s.sog_,
+			s.position_accuracy_, s.longitude_minutes_, s.latitude_minutes_, s.cog_, s.hdg_,
+			s.timestamp_, s.maneuver_indicator_, s.raim_, s.radio_status_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -92,6 +101,34 @@ public:
 	void set_lat_unavailable();
 	void set_lon(const geo::longitude & t);
 	void set_lat(const geo::latitude & t);
+
+public:
+	/// @brief Read only view of a position report class A, fields are read
+	///   from the raw data on access. Covers message types 1, 2 and 3.
+	class view final : public message_view
+	{
+	public:
+		explicit view(const raw_view & bits);
+
+		navigation_status get_nav_status() const { return field<decltype(nav_status_)>(); }
+		rate_of_turn get_rot() const;
+		std::optional<units::knots> get_sog() const;
+		bool get_position_accuracy() const { return field<decltype(position_accuracy_)>(); }
+		std::optional<double> get_cog() const;
+		std::optional<uint32_t> get_hdg() const;
+		uint32_t get_timestamp() const { return field<decltype(timestamp_)>(); }
+
+		maneuver_indicator_id get_maneuver_indicator() const
+		{
+			return field<decltype(maneuver_indicator_)>();
+		}
+
+		bool get_raim() const { return field<decltype(raim_)>(); }
+		uint32_t get_radio_status() const { return field<decltype(radio_status_)>(); }
+
+		std::optional<geo::longitude> get_lon() const;
+		std::optional<geo::latitude> get_lat() const;
+	};
 };
 }
 
@@ -52,6 +52,15 @@ private:
 	bitset_value<149, 19, uint32_t     > radio_status_ = 0;
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.year_, s.month_, s.day_, s.hour_,
+			s.minute_, s.second_, s.position_accuracy_, s.longitude_minutes_,
+			s.latitude_minutes_, s.epfd_fix_, s.raim_, s.radio_status_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
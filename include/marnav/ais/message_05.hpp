@@ -62,6 +62,16 @@ private:
 	bitset_value<422,  1, data_terminal> dte_ = data_terminal::not_ready;
 	// clang-format on
 
+	/// Layout of the message without the optional `dte_`, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.ais_version_, s.imo_number_,
+			s.callsign_, s.shipname_, s.shiptype_, s.to_bow_, s.to_stern_, s.to_port_,
+			s.to_starboard_, s.epfd_fix_, s.eta_month_, s.eta_day_, s.eta_hour_, s.eta_minute_,
+			s.draught_, s.destination_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -103,6 +113,30 @@ public:
 
 	void set_destination(const std::string & t);
 	void set_dte(data_terminal t) noexcept { dte_ = t; }
+
+public:
+	/// @brief Read only view of static and voyage related data, fields are read
+	///   from the raw data on access.
+	class view final : public message_view
+	{
+	public:
+		explicit view(const raw_view & bits);
+
+		uint32_t get_ais_version() const { return field<decltype(ais_version_)>(); }
+		uint32_t get_imo_number() const { return field<decltype(imo_number_)>(); }
+		std::string get_callsign() const;
+		std::string get_shipname() const;
+		ship_type get_shiptype() const { return field<decltype(shiptype_)>(); }
+		vessel_dimension get_vessel_dimension() const;
+		epfd_fix_type get_epfd_fix() const { return field<decltype(epfd_fix_)>(); }
+		uint32_t get_eta_month() const { return field<decltype(eta_month_)>(); }
+		uint32_t get_eta_day() const { return field<decltype(eta_day_)>(); }
+		uint32_t get_eta_hour() const { return field<decltype(eta_hour_)>(); }
+		uint32_t get_eta_minute() const { return field<decltype(eta_minute_)>(); }
+		units::meters get_draught() const;
+		std::string get_destination() const;
+		data_terminal get_dte() const;
+	};
 };
 }
 
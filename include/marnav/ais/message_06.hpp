@@ -6,6 +6,8 @@
 
 namespace marnav::ais
 {
+class binary_payload; // forward
+
 /// @brief Binary Addressed Message
 class message_06 : public message
 {
@@ -38,6 +40,14 @@ private:
 	bitset_value<82,  6, uint32_t> fid_ = 0; ///< Functional ID
 	// clang-format on
 
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.sequence_no_, s.dest_mmsi_,
+			s.retransmit_flag_, s.dac_, s.fid_);
+	}
+
 	// unfortuanately std::variant is C++17, therefore we need to store
 	// the binary payload and parse it later.
 	raw payload_;
@@ -51,6 +61,9 @@ public:
 	uint32_t get_dac() const noexcept { return dac_; }
 	uint32_t get_fid() const noexcept { return fid_; }
 
+	// payload
+	void read_binary(binary_payload & m) const;
+
 	void set_repeat_indicator(uint32_t t) noexcept { repeat_indicator_ = t; }
 	void set_mmsi(const utils::mmsi & t) noexcept { mmsi_ = t; }
 	void set_sequnce_no(uint32_t t) noexcept { sequence_no_ = t; }
@@ -58,6 +71,9 @@ public:
 	void set_retransmit_flag(bool t) noexcept { retransmit_flag_ = t; }
 	void set_dac(uint32_t t) noexcept { dac_ = t; }
 	void set_fid(uint32_t t) noexcept { fid_ = t; }
+
+	// payload
+	void write_binary(const binary_payload & m);
 };
 }
 
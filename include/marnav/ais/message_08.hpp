@@ -6,8 +6,7 @@
 
 namespace marnav::ais
 {
-class binary_001_11; // forward
-class binary_200_10; // forward
+class binary_payload; // forward
 
 /// @brief Binary Broadcast Message
 class message_08 : public message
@@ -38,6 +37,13 @@ private:
 	bitset_value<50,  6, uint32_t> fid_ = 0; ///< Functional ID
 	// clang-format on
 
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.dac_, s.fid_);
+	}
+
 	// unfortuanately std::variant is C++17, therefore we need to store
 	// the binary payload and parse it later.
 	raw payload_;
@@ -49,8 +55,7 @@ public:
 	uint32_t get_fid() const noexcept { return fid_; }
 
 	// payload
-	void read_binary(binary_001_11 & m) const;
-	void read_binary(binary_200_10 & m) const;
+	void read_binary(binary_payload & m) const;
 
 	void set_repeat_indicator(uint32_t t) noexcept { repeat_indicator_ = t; }
 	void set_mmsi(const utils::mmsi & t) noexcept { mmsi_ = t; }
@@ -58,8 +63,7 @@ public:
 	void set_fid(uint32_t t) noexcept { fid_ = t; }
 
 	// payload
-	void write_binary(const binary_001_11 & m);
-	void write_binary(const binary_200_10 & m);
+	void write_binary(const binary_payload & m);
 };
 }
 
@@ -34,6 +34,13 @@ private:
 	bitset_value<40, 30, uint32_t> dest_mmsi_ = 0;
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.dest_mmsi_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -38,6 +38,13 @@ private:
 	bitset_value<70,  1, bool    > retransmit_ = false;
 	// clang-format on
 
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.seqno_, s.dest_mmsi_, s.retransmit_);
+	}
+
 	std::string text_; // bits 72..1008
 
 public:
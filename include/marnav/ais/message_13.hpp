@@ -41,6 +41,34 @@ private:
 	bitset_value<166,  2, uint32_t> mmsi_seq_4_ = 0;
 	// clang-format on
 
+	/// Layout of the message with the first acknowledgement, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.mmsi_1_, s.mmsi_seq_1_);
+	}
+
+	/// Layout of the optional second acknowledgement.
+	template <class Self>
+	static auto fields_2(Self & s)
+	{
+		return std::tie(s.mmsi_2_, s.mmsi_seq_2_);
+	}
+
+	/// Layout of the optional third acknowledgement.
+	template <class Self>
+	static auto fields_3(Self & s)
+	{
+		return std::tie(s.mmsi_3_, s.mmsi_seq_3_);
+	}
+
+	/// Layout of the optional fourth acknowledgement.
+	template <class Self>
+	static auto fields_4(Self & s)
+	{
+		return std::tie(s.mmsi_4_, s.mmsi_seq_4_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -34,6 +34,13 @@ private:
 	bitset_value< 8, 30, uint32_t> mmsi_ = 0;
 	// clang-format on
 
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_);
+	}
+
 	std::string text_; // bits 72..1008
 
 public:
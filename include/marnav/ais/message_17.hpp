@@ -38,6 +38,14 @@ private:
 	bitset_value<58, 17, uint32_t> latitude_minutes_ = latitude_not_available_short;
 	// clang-format on
 
+	/// Layout of the header, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.longitude_minutes_,
+			s.latitude_minutes_);
+	}
+
 	raw payload_;
 
 public:
@@ -51,6 +51,16 @@ private:
 	bitset_value<148, 20, uint32_t> radio_status_ = 0;
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.sog_, s.position_accuracy_,
+			s.longitude_minutes_, s.latitude_minutes_, s.cog_, s.hdg_, s.timestamp_, s.cs_unit_,
+			s.display_flag_, s.dsc_flag_, s.band_flag_, s.message_22_flag_, s.assigned_,
+			s.raim_, s.radio_status_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -93,6 +103,32 @@ public:
 	void set_lat_unavailable();
 	void set_lon(const geo::longitude & t);
 	void set_lat(const geo::latitude & t);
+
+public:
+	/// @brief Read only view of a standard class B CS position report, fields
+	///   are read from the raw data on access.
+	class view final : public message_view
+	{
+	public:
+		explicit view(const raw_view & bits);
+
+		std::optional<units::knots> get_sog() const;
+		bool get_position_accuracy() const { return field<decltype(position_accuracy_)>(); }
+		std::optional<double> get_cog() const;
+		std::optional<uint32_t> get_hdg() const;
+		uint32_t get_timestamp() const { return field<decltype(timestamp_)>(); }
+		bool get_cs_unit() const { return field<decltype(cs_unit_)>(); }
+		bool get_display_flag() const { return field<decltype(display_flag_)>(); }
+		bool get_dsc_flag() const { return field<decltype(dsc_flag_)>(); }
+		bool get_band_flag() const { return field<decltype(band_flag_)>(); }
+		bool get_message_22_flag() const { return field<decltype(message_22_flag_)>(); }
+		bool get_assigned() const { return field<decltype(assigned_)>(); }
+		bool get_raim() const { return field<decltype(raim_)>(); }
+		uint32_t get_radio_status() const { return field<decltype(radio_status_)>(); }
+
+		std::optional<geo::longitude> get_lon() const;
+		std::optional<geo::latitude> get_lat() const;
+	};
 };
 }
 
@@ -54,6 +54,16 @@ private:
 	bitset_value<307,  1, bool         > assigned_ = false;
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.sog_, s.position_accuracy_,
+			s.longitude_minutes_, s.latitude_minutes_, s.cog_, s.hdg_, s.timestamp_,
+			s.shipname_, s.shiptype_, s.to_bow_, s.to_stern_, s.to_port_, s.to_starboard_,
+			s.epfd_fix_, s.raim_, s.dte_, s.assigned_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
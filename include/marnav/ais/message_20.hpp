@@ -64,6 +64,35 @@ private:
 	bitset_value<149, 11, uint32_t> increment_4_ = 0;
 	// clang-format on
 
+	/// Layout of the message with the first reservation, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.offset_number_1_, s.reserved_slots_1_,
+			s.timeout_1_, s.increment_1_);
+	}
+
+	/// Layout of the optional second reservation.
+	template <class Self>
+	static auto fields_2(Self & s)
+	{
+		return std::tie(s.offset_number_2_, s.reserved_slots_2_, s.timeout_2_, s.increment_2_);
+	}
+
+	/// Layout of the optional third reservation.
+	template <class Self>
+	static auto fields_3(Self & s)
+	{
+		return std::tie(s.offset_number_3_, s.reserved_slots_3_, s.timeout_3_, s.increment_3_);
+	}
+
+	/// Layout of the optional fourth reservation.
+	template <class Self>
+	static auto fields_4(Self & s)
+	{
+		return std::tie(s.offset_number_4_, s.reserved_slots_4_, s.timeout_4_, s.increment_4_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
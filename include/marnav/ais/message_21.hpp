@@ -53,6 +53,16 @@ private:
 	std::string name_extension_;
 	// clang-format on
 
+	/// Layout of the message without the name extension, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.aid_type_, s.name_,
+			s.position_accuracy_, s.longitude_minutes_, s.latitude_minutes_, s.to_bow_,
+			s.to_stern_, s.to_port_, s.to_starboard_, s.epfd_fix_, s.utc_second_,
+			s.off_position_, s.regional_, s.raim_, s.virtual_aid_flag_, s.assigned_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
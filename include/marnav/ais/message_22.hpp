@@ -55,6 +55,35 @@ private:
 	bitset_value<104, 30, uint32_t> mmsi_2_ = 0;
 	// clang-format on
 
+	/// Layout of the common fields in front of the area, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.channel_a_, s.channel_b_, s.txrx_mode_,
+			s.power_);
+	}
+
+	/// Layout of the area, if the message is broadcast.
+	template <class Self>
+	static auto fields_broadcast(Self & s)
+	{
+		return std::tie(s.ne_lon_, s.ne_lat_, s.sw_lon_, s.sw_lat_);
+	}
+
+	/// Layout of the area, if the message is addressed.
+	template <class Self>
+	static auto fields_addressed(Self & s)
+	{
+		return std::tie(s.mmsi_1_, s.mmsi_2_);
+	}
+
+	/// Layout of the common fields after the area.
+	template <class Self>
+	static auto fields_flags(Self & s)
+	{
+		return std::tie(s.addressed_, s.band_a_, s.band_b_, s.zone_size_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -59,6 +59,14 @@ private:
 	bitset_value<150,  4, uint32_t       > quiet_time_ = 0; // minutes (0=none, 1..15 minutes)
 	// clang-format on
 
+	/// Layout of the message, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.ne_lon_, s.ne_lat_, s.sw_lon_,
+			s.sw_lat_, s.station_type_, s.shiptype_, s.txrx_mode_, s.interval_, s.quiet_time_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
@@ -67,6 +67,41 @@ private:
 	bitset_value<132, 30, uint32_t> mothership_mmsi_ = 0;
 	// clang-format on
 
+	/// Layout of the fields common to both parts, see `binary_data::get_fields`.
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.repeat_indicator_, s.mmsi_, s.part_number_);
+	}
+
+	/// Layout of part A.
+	template <class Self>
+	static auto fields_part_a(Self & s)
+	{
+		return std::tie(s.shipname_);
+	}
+
+	/// Layout of part B, without the dimension or mothership.
+	template <class Self>
+	static auto fields_part_b(Self & s)
+	{
+		return std::tie(s.shiptype_, s.vendor_id_, s.model_, s.serial_, s.callsign_);
+	}
+
+	/// Layout of the dimension in part B of a normal vessel.
+	template <class Self>
+	static auto fields_dimension(Self & s)
+	{
+		return std::tie(s.to_bow_, s.to_stern_, s.to_port_, s.to_starboard_);
+	}
+
+	/// Layout of the mothership in part B of an auxiliary vessel.
+	template <class Self>
+	static auto fields_mothership(Self & s)
+	{
+		return std::tie(s.mothership_mmsi_);
+	}
+
 public:
 	uint32_t get_repeat_indicator() const noexcept { return repeat_indicator_; }
 	utils::mmsi get_mmsi() const noexcept { return utils::mmsi{mmsi_}; }
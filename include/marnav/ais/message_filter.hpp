@@ -0,0 +1,56 @@
+#ifndef MARNAV_AIS_MESSAGE_FILTER_HPP
+#define MARNAV_AIS_MESSAGE_FILTER_HPP
+
+#include <marnav/ais/ais.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Filters AIS messages by their header (message type and MMSI).
+///
+/// The filter decides on the header only, which is peeked from the payload of
+/// the first fragment. Unwanted messages are therefore dropped before they
+/// are reassembled or decoded.
+///
+/// Without any accepted message types, all types pass. Without any accepted
+/// MMSIs, all MMSIs pass. A message must pass both criteria.
+///
+/// Example:
+/// @code
+///   ais::message_filter filter;
+///   filter.accept_type(ais::message_id::position_report_class_a)
+///       .accept_type(ais::message_id::standard_class_b_cs_position_report)
+///       .accept_mmsi(utils::mmsi{211234560});
+///
+///   if (filter.accepts(vdm.get_payload())) {
+///       // reassemble and decode
+///   }
+/// @endcode
+///
+class message_filter
+{
+public:
+	message_filter() = default;
+	message_filter(const message_filter &) = default;
+	message_filter & operator=(const message_filter &) = default;
+	message_filter(message_filter &&) = default;
+	message_filter & operator=(message_filter &&) = default;
+
+	message_filter & accept_type(message_id t);
+	message_filter & accept_mmsi(const utils::mmsi & t);
+
+	/// Returns true if the filter accepts all messages.
+	bool accepts_all() const noexcept { return (types_ == 0) && mmsis_.empty(); }
+
+	bool accepts(const message_header & h) const noexcept;
+	bool accepts(const std::string & payload) const;
+
+private:
+	uint64_t types_ = 0; // bit mask of accepted message types, zero: all
+	std::vector<uint32_t> mmsis_; // sorted accepted MMSIs, empty: all
+};
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef MARNAV_AIS_POSITION_COLUMNS_HPP
+#define MARNAV_AIS_POSITION_COLUMNS_HPP
+
+#include <marnav/ais/binary_data.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @{
+
+/// Conversion of many raw values of position reports at once.
+///
+/// The raw values are converted like the getters of the messages do (for example
+/// `message_01::get_lat`), but without `std::optional` and without branches,
+/// in loops suitable for vectorization by the compiler. Values which are not
+/// available, or out of range, are converted to NaN and marked as invalid
+/// (`valid[i] == 0`), all others are marked as valid (`valid[i] == 1`).
+///
+/// In contrast to `to_geo_latitude` and `to_geo_longitude`, latitudes and
+/// longitudes are not rounded to six decimal places.
+///
+/// The output arrays must provide space for `n` values.
+
+void convert_latitudes(
+	const uint32_t * minutes, std::size_t n, double * degrees, uint8_t * valid) noexcept;
+void convert_longitudes(
+	const uint32_t * minutes, std::size_t n, double * degrees, uint8_t * valid) noexcept;
+void convert_sog(const uint32_t * sog, std::size_t n, double * knots, uint8_t * valid) noexcept;
+void convert_cog(const uint32_t * cog, std::size_t n, double * degrees, uint8_t * valid) noexcept;
+
+/// @}
+
+/// @brief Raw data of position reports, stored by column.
+///
+/// Collects the raw values of MMSI, position, speed and course of position
+/// reports (types 1, 2, 3, 18 and 19) without decoding the messages. The
+/// columns are meant to be converted in batches, see `convert_latitudes` etc.
+///
+/// Example:
+/// @code
+///   ais::position_columns columns;
+///   for (const auto & bits : messages)
+///       columns.append(bits);
+///
+///   const auto n = columns.size();
+///   std::vector<double> lat(n);
+///   std::vector<uint8_t> valid(n);
+///   ais::convert_latitudes(columns.latitudes().data(), n, lat.data(), valid.data());
+/// @endcode
+///
+class position_columns
+{
+public:
+	position_columns() = default;
+
+	position_columns(const position_columns &) = default;
+	position_columns & operator=(const position_columns &) = default;
+	position_columns(position_columns &&) = default;
+	position_columns & operator=(position_columns &&) = default;
+
+	bool append(const raw & bits);
+
+	/// Returns the number of collected position reports.
+	std::size_t size() const noexcept { return mmsi_.size(); }
+
+	void reserve(std::size_t n);
+	void clear() noexcept;
+
+	const std::vector<uint32_t> & mmsi() const noexcept { return mmsi_; }
+	const std::vector<uint32_t> & latitudes() const noexcept { return lat_; }
+	const std::vector<uint32_t> & longitudes() const noexcept { return lon_; }
+	const std::vector<uint32_t> & sog() const noexcept { return sog_; }
+	const std::vector<uint32_t> & cog() const noexcept { return cog_; }
+
+private:
+	std::vector<uint32_t> mmsi_;
+	std::vector<uint32_t> lat_; // in 1/10000 minutes, 27 bits
+	std::vector<uint32_t> lon_; // in 1/10000 minutes, 28 bits
+	std::vector<uint32_t> sog_; // in 0.1 knots
+	std::vector<uint32_t> cog_; // in 0.1 degrees
+};
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef MARNAV_AIS_STATIC_DATA_CACHE_HPP
+#define MARNAV_AIS_STATIC_DATA_CACHE_HPP
+
+#include <marnav/ais/message.hpp>
+#include <marnav/ais/vessel_dimension.hpp>
+#include <marnav/utils/mmsi.hpp>
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Static data of a vessel, merged from all messages containing
+/// static data.
+struct static_data {
+	utils::mmsi mmsi;
+	std::string shipname;
+	std::string callsign;
+	ship_type shiptype = ship_type::not_available;
+	vessel_dimension dimension;
+	uint32_t imo_number = 0;
+
+	/// Incremented each time the data changes.
+	uint32_t revision = 0;
+};
+
+/// @brief Cache of the static data of vessels, indexed by MMSI.
+///
+/// Joins the static data sent in different messages into one record per vessel:
+/// - static and voyage related data (type 5, class A)
+/// - extended class B equipment position report (type 19)
+/// - static data report (type 24), part A (name) and part B (type, callsign, dimension)
+///
+/// Vessels send their static data repeatedly, mostly unchanged. The cache keeps
+/// the raw bits of the static data of each message type per vessel, and decodes
+/// a message only if its static data differs from the last one. Unchanged repeats
+/// cost a comparison of a few words, the strings are not decoded.
+///
+/// Example:
+/// @code
+///   ais::static_data_cache cache;
+///
+///   ais::raw bits;
+///   ais::append_payload(bits, payload, fill_bits);
+///   if (cache.update(bits)) {
+///       const auto * data = cache.find(ais::message_view{bits}.get_mmsi());
+///       // data changed, e.g. update display of data->shipname
+///   }
+/// @endcode
+///
+class static_data_cache
+{
+public:
+	/// Counters of the processed messages.
+	struct statistics {
+		uint64_t messages = 0; ///< Number of messages containing static data.
+		uint64_t unchanged = 0; ///< Number of messages without changes, not decoded.
+		uint64_t decoded = 0; ///< Number of messages decoded.
+	};
+
+	static_data_cache() = default;
+
+	static_data_cache(const static_data_cache &) = default;
+	static_data_cache & operator=(const static_data_cache &) = default;
+	static_data_cache(static_data_cache &&) = default;
+	static_data_cache & operator=(static_data_cache &&) = default;
+
+	bool update(const raw & bits);
+	bool update(const message & m);
+
+	const static_data * find(const utils::mmsi & mmsi) const;
+
+	/// Returns the number of vessels in the cache.
+	std::size_t size() const noexcept { return entries_.size(); }
+
+	void clear();
+
+	const statistics & get_statistics() const noexcept { return stats_; }
+
+private:
+	/// Kinds of messages containing static data.
+	enum class source : uint8_t { message_05, message_19, message_24_a, message_24_b };
+
+	static constexpr std::size_t n_sources = 4;
+
+	/// Raw bits of the static data of one message, 64 bits per word.
+	using fingerprint = std::array<uint64_t, 4>;
+
+	struct entry {
+		static_data data;
+		std::array<fingerprint, n_sources> fingerprints = {};
+		uint8_t known = 0; // bit per source, fingerprint is valid
+	};
+
+	std::unordered_map<uint32_t, entry> entries_;
+	statistics stats_;
+
+	bool merge(const message & m, entry & e);
+};
+}
+
+#endif
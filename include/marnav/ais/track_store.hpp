@@ -0,0 +1,140 @@
+#ifndef MARNAV_AIS_TRACK_STORE_HPP
+#define MARNAV_AIS_TRACK_STORE_HPP
+
+#include <marnav/ais/message.hpp>
+#include <marnav/ais/rate_of_turn.hpp>
+#include <marnav/geo/position.hpp>
+#include <marnav/units/units.hpp>
+#include <marnav/utils/mmsi.hpp>
+#include <chrono>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Recent position reports of vessels, to estimate their positions at
+/// arbitrary times.
+///
+/// The store keeps the latest `depth` position reports (types 1, 2, 3, 18 and 19)
+/// of each vessel in a ring buffer. The reports are stored as struct of arrays in
+/// fixed point: positions in 1/10000 minutes, speed in 0.1 knots, course in
+/// 0.1 degrees and the rate of turn as raw value, as they are transmitted.
+///
+/// The position of a vessel at a time is estimated:
+/// - between two stored reports: by linear interpolation of the positions
+/// - after the latest report: by dead reckoning, using speed, course and rate
+///   of turn of the latest report, up to `max_extrapolation` after the report.
+///   If speed or course are not available, the vessel is assumed not to move.
+/// - before the oldest stored report: not at all
+///
+/// The same plane approximation as in `geo::cpa` applies, the vessels are supposed
+/// to move no more than some tens of nautical miles between reports and within
+/// the time of extrapolation.
+///
+/// `positions_at` estimates the positions of all vessels for the same time at once,
+/// the results are stored in arrays in the order of the rows, see `mmsi`.
+///
+/// Vessels are not removed automatically. `expire` removes all vessels whose
+/// positions cannot be estimated anymore (no report within `max_extrapolation`),
+/// `remove` a single vessel. The last row takes the place of a removed one, the
+/// order of the rows changes.
+///
+/// Example:
+/// @code
+///   ais::track_store tracks;
+///   tracks.update(*ais::make_message(payload), ais::track_store::clock::now());
+///
+///   // display refresh, vessels which fell silent are removed
+///   tracks.expire(ais::track_store::clock::now());
+///   const auto n = tracks.size();
+///   std::vector<double> lat(n), lon(n);
+///   std::vector<uint8_t> valid(n);
+///   tracks.positions_at(ais::track_store::clock::now(), lat.data(), lon.data(), valid.data());
+///   for (std::size_t i = 0; i < n; ++i) {
+///       if (valid[i])
+///           draw(tracks.mmsi()[i], lat[i], lon[i]);
+///   }
+/// @endcode
+///
+class track_store
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Stored position report.
+	struct report {
+		clock::time_point time;
+		geo::position pos;
+		std::optional<units::knots> sog;
+		std::optional<double> cog; ///< Course over ground in degrees.
+		rate_of_turn rot;
+	};
+
+	explicit track_store(
+		std::size_t depth = 8, clock::duration max_extrapolation = std::chrono::minutes{10});
+
+	track_store(const track_store &) = default;
+	track_store & operator=(const track_store &) = default;
+	track_store(track_store &&) = default;
+	track_store & operator=(track_store &&) = default;
+
+	/// Returns the number of vessels.
+	std::size_t size() const noexcept { return mmsi_.size(); }
+
+	/// Returns the maximum number of reports stored per vessel.
+	std::size_t depth() const noexcept { return depth_; }
+
+	bool update(const raw & bits, clock::time_point t = clock::now());
+	bool update(const message & m, clock::time_point t = clock::now());
+
+	std::vector<report> track(const utils::mmsi & mmsi) const;
+
+	std::optional<geo::position> position_at(
+		const utils::mmsi & mmsi, clock::time_point t) const;
+
+	void positions_at(clock::time_point t, double * lat, double * lon, uint8_t * valid) const;
+
+	/// Returns the MMSIs of the vessels, in the order of the rows.
+	const std::vector<uint32_t> & mmsi() const noexcept { return mmsi_; }
+
+	bool remove(const utils::mmsi & mmsi);
+	std::size_t expire(clock::time_point t);
+
+	void clear() noexcept;
+
+private:
+	std::size_t depth_;
+	int64_t max_extrapolation_; // milliseconds
+
+	std::unordered_map<uint32_t, std::size_t> rows_;
+
+	// per vessel
+	std::vector<uint32_t> mmsi_;
+	std::vector<uint32_t> latest_; // slot of the latest report
+	std::vector<uint32_t> count_; // number of stored reports
+
+	// reports, depth_ slots per vessel
+	std::vector<int64_t> time_; // milliseconds since epoch of the clock
+	std::vector<int32_t> lat_; // 1/10000 minutes
+	std::vector<int32_t> lon_; // 1/10000 minutes
+	std::vector<uint16_t> sog_; // 0.1 knots, sog_not_available
+	std::vector<uint16_t> cog_; // 0.1 degrees, cog_not_available
+	std::vector<int8_t> rot_; // raw rate of turn
+
+	struct sample {
+		int32_t lat;
+		int32_t lon;
+		uint16_t sog;
+		uint16_t cog;
+		int8_t rot;
+	};
+
+	bool append(const utils::mmsi & id, int64_t t, const sample & s);
+	void remove_row(std::size_t row);
+	bool estimate(std::size_t row, int64_t t, double & lat, double & lon) const;
+};
+}
+
+#endif
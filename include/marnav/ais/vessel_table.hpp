@@ -0,0 +1,163 @@
+#ifndef MARNAV_AIS_VESSEL_TABLE_HPP
+#define MARNAV_AIS_VESSEL_TABLE_HPP
+
+#include <marnav/ais/message.hpp>
+#include <marnav/ais/vessel_dimension.hpp>
+#include <marnav/geo/position.hpp>
+#include <marnav/units/units.hpp>
+#include <marnav/utils/mmsi.hpp>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @brief Table of the latest known state of vessels, indexed by MMSI.
+///
+/// The table is updated by AIS messages: position reports (types 1, 2, 3, 18
+/// and 19) update the dynamic data, static data reports (types 5, 19 and 24)
+/// update the static data of the vessel.
+///
+/// The data is stored as struct of arrays, one array per datum, the rows are
+/// located by an open addressing hash index of the MMSIs. The capacity is fixed
+/// at construction, updates do not allocate memory.
+///
+/// There must be only one writer (`update`), but any number of concurrent
+/// readers (`find`, `for_each`, `size`) without locks. Each row is protected
+/// by a sequence lock, readers retry if the row was modified while they read
+/// it, and therefore always get a consistent state of a vessel.
+///
+/// Example:
+/// @code
+///   ais::vessel_table table{100000};
+///
+///   // writer thread
+///   table.update(*ais::make_message(payload));
+///
+///   // reader threads
+///   if (auto v = table.find(utils::mmsi{211234560}); v && v->pos) {
+///       // use v->pos, v->sog, ...
+///   }
+/// @endcode
+///
+class vessel_table
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Copy of the state of one vessel.
+	struct vessel {
+		utils::mmsi mmsi;
+
+		// dynamic data
+		std::optional<geo::position> pos;
+		std::optional<units::knots> sog;
+		std::optional<double> cog; ///< Course over ground in degrees.
+		std::optional<uint32_t> hdg; ///< True heading in degrees.
+		navigation_status nav_status = navigation_status::not_defined;
+		clock::time_point dynamic_time; ///< Time of the last position report.
+
+		// static data
+		std::string shipname;
+		std::string callsign;
+		ship_type shiptype = ship_type::not_available;
+		vessel_dimension dimension;
+		uint32_t imo_number = 0;
+		clock::time_point static_time; ///< Time of the last static data report.
+	};
+
+	explicit vessel_table(std::size_t capacity);
+
+	vessel_table(const vessel_table &) = delete;
+	vessel_table & operator=(const vessel_table &) = delete;
+	vessel_table(vessel_table &&) = delete;
+	vessel_table & operator=(vessel_table &&) = delete;
+
+	/// Returns the maximum number of vessels.
+	std::size_t capacity() const noexcept { return capacity_; }
+
+	/// Returns the number of vessels in the table.
+	std::size_t size() const noexcept { return size_.load(std::memory_order_acquire); }
+
+	bool update(const message & m, clock::time_point t = clock::now());
+
+	std::optional<vessel> find(const utils::mmsi & mmsi) const;
+
+	/// Calls the specified function for each vessel in the table, in order of
+	/// their first appearance.
+	///
+	/// @param[in] func Function, called with `const vessel &`.
+	template <class Func>
+	void for_each(Func func) const
+	{
+		const auto n = size();
+		for (std::size_t row = 0; row < n; ++row)
+			func(load(row));
+	}
+
+private:
+	template <class T>
+	using column = std::vector<std::atomic<T>>;
+
+	static constexpr std::size_t shipname_words = 3; // 20 characters
+	static constexpr std::size_t callsign_words = 1; // 7 characters
+
+	std::size_t capacity_;
+	std::atomic<std::size_t> size_{0};
+
+	// index, MMSI to row, zero marks free slots
+	unsigned int index_shift_;
+	column<uint32_t> index_mmsi_;
+	column<uint32_t> index_row_;
+
+	// rows, sequence number is odd while the row is being written
+	column<uint32_t> seq_;
+	column<uint32_t> mmsi_;
+	column<double> lat_; // degrees, NaN if not available
+	column<double> lon_; // degrees, NaN if not available
+	column<double> sog_; // knots, NaN if not available
+	column<double> cog_; // degrees, NaN if not available
+	column<uint16_t> hdg_; // degrees, hdg_not_available if not available
+	column<uint8_t> nav_status_;
+	column<int64_t> dynamic_time_;
+	column<uint64_t> shipname_; // shipname_words per row
+	column<uint64_t> callsign_; // callsign_words per row
+	column<uint8_t> shiptype_;
+	column<uint16_t> to_bow_;
+	column<uint16_t> to_stern_;
+	column<uint16_t> to_port_;
+	column<uint16_t> to_starboard_;
+	column<uint32_t> imo_number_;
+	column<int64_t> static_time_;
+
+	std::size_t slot(uint32_t mmsi) const noexcept;
+	std::size_t lookup(uint32_t mmsi) const noexcept;
+	std::size_t acquire(uint32_t mmsi);
+
+	void begin_write(std::size_t row) noexcept;
+	void end_write(std::size_t row) noexcept;
+
+	struct dynamic_data {
+		double lat;
+		double lon;
+		double sog;
+		double cog;
+		uint16_t hdg;
+	};
+
+	template <class Report>
+	static dynamic_data read_dynamic(const Report & r);
+
+	void write_dynamic(std::size_t row, const dynamic_data & d, clock::time_point t) noexcept;
+	void write_shipname(std::size_t row, const std::string & s) noexcept;
+	void write_callsign(std::size_t row, const std::string & s) noexcept;
+	void write_dimension(std::size_t row, const vessel_dimension & d) noexcept;
+
+	vessel load(std::size_t row) const;
+};
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef MARNAV_GEO_CPA_SCREEN_HPP
+#define MARNAV_GEO_CPA_SCREEN_HPP
+
+#include <marnav/geo/cpa.hpp>
+#include <marnav/units/units.hpp>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::geo
+{
+/// @brief Screens many vessels for close encounters (CPA/TCPA), own ship
+/// against all targets, or all pairs of targets.
+///
+/// The positions of the vessels are projected once to a plane, tangent to the
+/// earth at the specified origin, speed and course are converted to velocity
+/// vectors. The data is stored as struct of arrays, the CPA/TCPA of many vessels
+/// are computed in tight loops without trigonometry.
+///
+/// The same approximation as in `cpa` applies, the vessels are supposed to be in the
+/// vincinity of the origin (tens of nautical miles).
+///
+/// For all pairs (`screen_pairs`), the vessels are sorted along the east axis, pairs
+/// which are not able to come close enough within the time limit are skipped without
+/// computation. The sorted copy is made once by `prepare`, after all vessels are added.
+/// `screen_pairs_parallel` distributes the pairs among a number of threads, or the work
+/// may be distributed by the caller by partitioning (`screen_pairs` with parts).
+/// The screening functions are const and may be called concurrently.
+///
+/// Example:
+/// @code
+///   geo::cpa_screen screen{own.pos};
+///   for (const auto & [mmsi, v] : targets)
+///       screen.add(mmsi, v);
+///
+///   const geo::cpa_screen::limits l{units::nautical_miles{0.5}, std::chrono::minutes{20}};
+///   for (const auto & e : screen.screen(own_mmsi, own, l)) {
+///       // warning, e.second will pass within e.cpa in e.tcpa
+///   }
+/// @endcode
+///
+class cpa_screen
+{
+public:
+	using id_type = uint32_t;
+
+	/// Thresholds, encounters closer than `cpa` within `tcpa` are reported.
+	struct limits {
+		units::nautical_miles cpa;
+		std::chrono::seconds tcpa;
+	};
+
+	/// A close encounter of two vessels.
+	struct encounter {
+		id_type first;
+		id_type second;
+		units::nautical_miles cpa; ///< Distance at the closest point of approach.
+		std::chrono::seconds tcpa; ///< Time until the closest point of approach.
+	};
+
+	explicit cpa_screen(const position & origin);
+
+	/// Returns the number of vessels.
+	std::size_t size() const noexcept { return ids_.size(); }
+
+	void reserve(std::size_t n);
+	void add(id_type id, const vessel & v);
+	void clear() noexcept;
+
+	std::vector<encounter> screen(id_type own_id, const vessel & own, const limits & l) const;
+
+	void prepare();
+
+	std::vector<encounter> screen_pairs(
+		const limits & l, std::size_t part = 0, std::size_t parts = 1) const;
+
+	std::vector<encounter> screen_pairs_parallel(const limits & l, std::size_t threads) const;
+
+private:
+	/// Vessels sorted along the east axis, see `prepare`.
+	struct sorted_columns {
+		std::vector<uint32_t> order; // index of the vessel
+		std::vector<double> x;
+		std::vector<double> y;
+		std::vector<double> vx;
+		std::vector<double> vy;
+		std::vector<double> speed;
+		double max_speed = 0.0;
+	};
+
+	double lat0_; // degrees
+	double lon0_; // degrees
+	double scale_lon_; // nautical miles per degree longitude, at the origin
+
+	// vessels, positions in nautical miles, velocities in knots
+	std::vector<id_type> ids_;
+	std::vector<double> x_; // east
+	std::vector<double> y_; // north
+	std::vector<double> vx_;
+	std::vector<double> vy_;
+
+	bool prepared_ = false;
+	sorted_columns sorted_;
+
+	void project(const vessel & v, double & x, double & y, double & vx, double & vy) const;
+	sorted_columns sort() const;
+	std::vector<encounter> screen_part(
+		const sorted_columns & c, const limits & l, std::size_t part, std::size_t parts) const;
+};
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef MARNAV_GEO_GRID_INDEX_HPP
+#define MARNAV_GEO_GRID_INDEX_HPP
+
+#include <marnav/geo/position.hpp>
+#include <marnav/geo/region.hpp>
+#include <marnav/units/units.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::geo
+{
+/// @brief Spatial index of moving targets, based on a uniform lat/lon grid.
+///
+/// Each target is identified by a number (e.g. the MMSI of an AIS target) and
+/// is located in the cell of the grid which contains its position. Moving a target
+/// within its cell costs a lookup, moving it to another cell removes it from the old
+/// and inserts it into the new cell, both in constant time.
+///
+/// Queries only visit the cells overlapping the area of interest, instead of
+/// testing all targets.
+///
+/// Example:
+/// @code
+///   geo::grid_index index;
+///
+///   // for each AIS position report
+///   index.update(mmsi, pos);
+///
+///   // all targets within 5 NM of own ship
+///   for (auto id : index.within(own_ship, units::nautical_miles{5.0})) {
+///       // ...
+///   }
+/// @endcode
+///
+/// The cell size should be in the order of the typical query range. Distances are
+/// computed on a sphere.
+///
+class grid_index
+{
+public:
+	using id_type = uint32_t;
+
+	/// Result of a nearest neighbor query.
+	struct neighbor {
+		id_type id;
+		units::nautical_miles distance;
+	};
+
+	explicit grid_index(double cell_size = 1.0);
+
+	grid_index(const grid_index &) = default;
+	grid_index & operator=(const grid_index &) = default;
+	grid_index(grid_index &&) noexcept = default;
+	grid_index & operator=(grid_index &&) noexcept = default;
+
+	/// Returns the size of the cells in degrees.
+	double cell_size() const noexcept { return cell_size_; }
+
+	/// Returns the number of targets.
+	std::size_t size() const noexcept { return items_.size(); }
+
+	bool empty() const noexcept { return items_.empty(); }
+
+	void update(id_type id, const position & p);
+	bool remove(id_type id);
+	void clear();
+
+	std::optional<position> find(id_type id) const;
+
+	std::vector<id_type> inside(const region & r) const;
+	std::vector<id_type> within(const position & center, units::nautical_miles radius) const;
+	std::vector<neighbor> nearest(const position & center, std::size_t k) const;
+
+private:
+	struct item {
+		id_type id;
+		double lat; // degrees
+		double lon; // degrees
+		uint32_t cell;
+		uint32_t slot; // index within the cell
+	};
+
+	double cell_size_;
+	uint32_t rows_;
+	uint32_t cols_;
+
+	std::vector<item> items_;
+	std::unordered_map<id_type, uint32_t> ids_; // id to index of item
+	std::vector<std::vector<uint32_t>> cells_; // indices of items, row major
+
+	uint32_t row(double lat) const noexcept;
+	uint32_t col(double lon) const noexcept;
+
+	void insert_into_cell(uint32_t index, uint32_t cell);
+	void remove_from_cell(uint32_t index) noexcept;
+
+	template <class Func>
+	void visit(const position & center, double radius, Func func) const;
+};
+}
+
+#endif
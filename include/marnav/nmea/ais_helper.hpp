@@ -3,10 +3,16 @@
 
 #include <marnav/nmea/vdm.hpp>
 #include <marnav/nmea/vdo.hpp>
+#include <marnav/ais/binary_data.hpp>
 #include <optional>
 #include <stdexcept>
 #include <vector>
 
+namespace marnav::ais
+{
+class message;
+}
+
 namespace marnav::nmea
 {
 /// @{
@@ -116,6 +122,18 @@ std::vector<std::unique_ptr<nmea::sentence>> make_vdms(
 	const std::vector<std::pair<std::string, uint32_t>> & payload,
 	std::optional<uint32_t> seq_msg_id = std::optional<uint32_t>{},
 	ais_channel radio_channel = ais_channel::B);
+
+/// Size of a buffer, which is sufficient to hold the VDM sentences of
+/// any AIS message, see `write_vdms`.
+constexpr std::size_t vdms_max_size = 512;
+
+std::size_t write_vdms(const ais::raw & bits, char * buffer, std::size_t size,
+	std::optional<uint32_t> seq_msg_id = std::optional<uint32_t>{},
+	ais_channel radio_channel = ais_channel::B);
+
+std::size_t write_vdms(const ais::message & msg, char * buffer, std::size_t size,
+	std::optional<uint32_t> seq_msg_id = std::optional<uint32_t>{},
+	ais_channel radio_channel = ais_channel::B);
 }
 
 #endif
@@ -0,0 +1,141 @@
+#ifndef MARNAV_NMEA_AIS_REASSEMBLER_HPP
+#define MARNAV_NMEA_AIS_REASSEMBLER_HPP
+
+#include <marnav/ais/binary_data.hpp>
+#include <marnav/ais/message_filter.hpp>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+namespace marnav::ais
+{
+class message;
+}
+
+namespace marnav::nmea
+{
+class vdm;
+
+/// @brief Reassembles AIS messages from (possibly interleaved) VDM/VDO fragments.
+///
+/// Fragments are grouped by the source (`s:`) of the tag block, the radio channel
+/// and the sequential message ID. Each group occupies one of a fixed number of slots,
+/// which hold the already decoded bits of the message. The payload of a fragment is
+/// decoded directly into the (inline) buffer of its slot, the complete message is
+/// handed over to `ais::make_message` without further copies.
+///
+/// The memory used is bounded by the number of slots. Incomplete messages are
+/// discarded if they are not completed within the timeout, or if all slots are
+/// occupied and a new message begins (the oldest one is discarded).
+///
+/// The slots are found by a hash table of the keys, and are kept in a list ordered
+/// by the time of their first fragment. The costs of a fragment do not depend
+/// on the number of slots. The fragments are expected to be processed in the
+/// order of their reception (`now` does not decrease).
+///
+/// Fragments must arrive in order, a fragment out of sequence discards the
+/// message it belongs to.
+///
+/// An optional filter drops unwanted messages based on the header within the
+/// first fragment. The following fragments of a dropped message are consumed
+/// without being decoded.
+///
+/// Example:
+/// @code
+///   nmea::ais_reassembler reassembler;
+///
+///   std::string data;
+///   while (source.read_sentence(data)) {
+///       auto s = nmea::make_sentence(data);
+///       if (s->id() != nmea::sentence_id::VDM)
+///           continue;
+///       auto m = reassembler.process(*nmea::sentence_cast<nmea::vdm>(s));
+///       if (!m)
+///           continue; // message not yet complete
+///       // process AIS message
+///   }
+/// @endcode
+///
+class ais_reassembler
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Counters of the processed fragments.
+	struct statistics {
+		uint64_t fragments = 0; ///< Number of fragments presented to the reassembler.
+		uint64_t completed = 0; ///< Number of complete and successfully parsed messages.
+		uint64_t dropped_sequence = 0; ///< Messages dropped because of missing fragments.
+		uint64_t evicted_timeout = 0; ///< Messages dropped because of the timeout.
+		uint64_t evicted_overflow = 0; ///< Messages dropped because all slots were in use.
+		uint64_t filtered = 0; ///< Messages dropped by the filter.
+	};
+
+	explicit ais_reassembler(
+		std::size_t slots = 16, clock::duration timeout = std::chrono::seconds{5});
+
+	ais_reassembler(const ais_reassembler &) = default;
+	ais_reassembler & operator=(const ais_reassembler &) = default;
+	ais_reassembler(ais_reassembler &&) = default;
+	ais_reassembler & operator=(ais_reassembler &&) = default;
+
+	std::unique_ptr<ais::message> process(const vdm & v, clock::time_point now = clock::now());
+
+	const statistics & get_statistics() const noexcept { return stats_; }
+	void reset_statistics() noexcept { stats_ = statistics{}; }
+
+	const ais::message_filter & get_filter() const noexcept { return filter_; }
+	void set_filter(const ais::message_filter & filter) { filter_ = filter; }
+
+	std::size_t pending() const noexcept;
+	void clear() noexcept;
+
+private:
+	struct key {
+		uint64_t source = 0;
+		uint32_t seq_msg_id = 0;
+		char channel = 0;
+
+		friend bool operator==(const key & a, const key & b) noexcept
+		{
+			return (a.source == b.source) && (a.seq_msg_id == b.seq_msg_id)
+				&& (a.channel == b.channel);
+		}
+	};
+
+	static constexpr uint32_t none = 0xffffffffu;
+
+	struct slot {
+		bool skip = false; // message dropped by the filter, fragments are not decoded
+		key id;
+		uint32_t n_fragments = 0;
+		uint32_t next_fragment = 0;
+		clock::time_point start;
+		uint32_t prev = none; // list of used slots, ordered by start
+		uint32_t next = none;
+		ais::raw bits;
+	};
+
+	clock::duration timeout_;
+	std::vector<slot> slots_;
+	std::vector<uint32_t> index_; // open addressing by key, slot or `none`
+	std::vector<uint32_t> free_; // unused slots
+	uint32_t oldest_ = none;
+	uint32_t newest_ = none;
+	ais::raw single_; // buffer for messages consisting of one fragment
+	ais::message_filter filter_;
+	statistics stats_;
+
+	std::size_t home(const key & k) const noexcept;
+	uint32_t find(const key & k) const noexcept;
+	void link(uint32_t i) noexcept;
+	void unlink(uint32_t i) noexcept;
+	void release(uint32_t i) noexcept;
+	void evict_expired(clock::time_point now) noexcept;
+	uint32_t acquire(const key & k) noexcept;
+	void append(uint32_t i, const vdm & v);
+};
+}
+
+#endif
@@ -3,9 +3,11 @@
 
 #include <marnav/nmea/sentence_id.hpp>
 #include <marnav/nmea/checksum_enum.hpp>
+#include <marnav/utils/parse_statistics.hpp>
 #include <memory>
 #include <string>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace marnav::nmea
@@ -28,6 +30,9 @@ std::vector<std::string> get_supported_sentences_str();
 std::vector<sentence_id> get_supported_sentences_id();
 std::string to_string(sentence_id id);
 sentence_id tag_to_id(const std::string & tag);
+
+std::vector<std::pair<sentence_id, utils::parse_statistics>> get_parse_statistics();
+void reset_parse_statistics();
 }
 
 #endif
@@ -157,6 +157,8 @@ enum class sentence_id : uint32_t {
 	// proprietaty extension
 
 	STALK, ///< SeaTalk over NMEA, raw data
+
+	count ///< Number of sentence IDs, not a sentence. Must be the last enumerator.
 };
 }
 
@@ -0,0 +1,93 @@
+#ifndef MARNAV_NMEA_SENTENCE_LIMITER_HPP
+#define MARNAV_NMEA_SENTENCE_LIMITER_HPP
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+
+namespace marnav::nmea
+{
+/// @brief Drops duplicated and too frequent raw NMEA sentences.
+///
+/// Sentences are grouped by a key, built from the address field (talker and tag)
+/// and optionally the source (`s:`) of the tag block. For each key only the
+/// information of the last accepted sentence is kept, which makes the cost per
+/// sentence constant (one hash over the raw data, one lookup).
+///
+/// A sentence is dropped if:
+/// - it is identical (same hash, tag block not included) to the last accepted
+///   sentence of the same key, received within the duplicate window.
+/// - it arrives earlier than the minimum interval after the last accepted
+///   sentence of the same key.
+///
+/// The sentences are not parsed, nor is the checksum checked. Raw data without
+/// recognizable address field is passed through.
+///
+/// Example:
+/// @code
+///   nmea::sentence_limiter limiter{std::chrono::milliseconds{0}};
+///   limiter.set_min_interval("HDT", std::chrono::milliseconds{100}); // max. 10 Hz
+///   limiter.set_min_interval("ROT", std::chrono::milliseconds{100}); // max. 10 Hz
+///
+///   std::string data;
+///   while (source.read_sentence(data)) {
+///       if (!limiter.accept(data))
+///           continue;
+///       // process sentence
+///   }
+/// @endcode
+///
+class sentence_limiter
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	/// Counters of the processed traffic.
+	struct statistics {
+		uint64_t received = 0; ///< Number of sentences presented to the limiter.
+		uint64_t passed = 0; ///< Number of accepted sentences.
+		uint64_t dropped_duplicate = 0; ///< Dropped because identical to the previous one.
+		uint64_t dropped_rate = 0; ///< Dropped because of the rate limitation.
+		uint64_t dropped_bytes = 0; ///< Number of bytes of all dropped sentences.
+	};
+
+	sentence_limiter() = default;
+	explicit sentence_limiter(clock::duration min_interval,
+		clock::duration duplicate_window = std::chrono::seconds{1}, bool use_source = false);
+
+	sentence_limiter(const sentence_limiter &) = default;
+	sentence_limiter & operator=(const sentence_limiter &) = default;
+	sentence_limiter(sentence_limiter &&) = default;
+	sentence_limiter & operator=(sentence_limiter &&) = default;
+
+	void set_min_interval(const std::string & tag, clock::duration t);
+
+	bool accept(const std::string & s, clock::time_point now = clock::now());
+
+	const statistics & get_statistics() const noexcept { return stats_; }
+	void reset_statistics() noexcept { stats_ = statistics{}; }
+
+	void clear();
+
+private:
+	struct entry {
+		clock::time_point last;
+		clock::duration min_interval;
+		uint64_t hash;
+	};
+
+	clock::duration default_min_interval_ = clock::duration::zero();
+	clock::duration duplicate_window_ = std::chrono::seconds{1};
+	bool use_source_ = false;
+
+	std::unordered_map<std::string, clock::duration> min_intervals_;
+	std::unordered_map<uint64_t, entry> entries_;
+	statistics stats_;
+
+	clock::duration min_interval_for(const std::string & s, std::string::size_type first,
+		std::string::size_type last) const;
+};
+}
+
+#endif
@@ -4,6 +4,7 @@
 /// Copyright (c) 2017 Mario Konrad <mario.konrad@gmx.net>
 /// The code is licensed under the BSD License (see file LICENSE)
 
+#include <algorithm>
 #include <initializer_list>
 #include <limits>
 #include <stdexcept>
@@ -11,9 +12,62 @@
 #include <type_traits>
 #include <vector>
 #include <cassert>
+#include <cstdint>
 
 namespace marnav::utils
 {
+/// @cond DEV
+namespace detail
+{
+/// Reads 64 bits from the specified blocks, beginning with the block at index `i`,
+/// the first block being the most significant. Blocks beyond `n` are read as zero.
+template <class Block>
+uint64_t load_window(const Block * data, std::size_t n, std::size_t i) noexcept
+{
+	constexpr std::size_t bits_per_block = sizeof(Block) * 8u;
+	constexpr std::size_t window_blocks = 64 / bits_per_block;
+
+	if constexpr (window_blocks == 1) {
+		return data[i];
+	} else {
+		uint64_t w = 0;
+		if (i + window_blocks <= n) {
+			for (std::size_t k = 0; k < window_blocks; ++k)
+				w = (w << bits_per_block) | data[i + k];
+		} else {
+			for (std::size_t k = 0; k < window_blocks; ++k) {
+				w <<= bits_per_block;
+				if (i + k < n)
+					w |= data[i + k];
+			}
+		}
+		return w;
+	}
+}
+
+/// Extracts up to 64 bits at the specified bit offset of the blocks, using one
+/// or two 64 bit windows instead of reading block by block. The bits must be
+/// within the `n` blocks, the range is not checked.
+template <class Block>
+uint64_t extract_bits(
+	const Block * data, std::size_t n, std::size_t ofs, std::size_t bits) noexcept
+{
+	constexpr std::size_t bits_per_block = sizeof(Block) * 8u;
+	constexpr std::size_t window_blocks = 64 / bits_per_block;
+
+	const std::size_t i = ofs / bits_per_block;
+	const std::size_t shift = ofs % bits_per_block;
+	const uint64_t w = load_window(data, n, i) << shift;
+	if (shift + bits <= 64)
+		return w >> (64 - bits);
+
+	// (64 - shift) bits from the first, the rest from the second window
+	const std::size_t rest = shift + bits - 64;
+	const uint64_t w1 = load_window(data, n, i + window_blocks);
+	return ((w >> shift) << rest) | (w1 >> (64 - rest));
+}
+}
+/// @endcond
 
 /// This is a dynamically growing bitset (theoretically of arbitrary size).
 ///
@@ -26,6 +80,9 @@ namespace marnav::utils
 /// claims nor wants to be.
 ///
 /// @tparam Block The data type of the underlying block type.
+/// @tparam Container The container holding the blocks, `std::vector` by default.
+///            Containers with fixed capacity (e.g. `static_vector`) make the
+///            bitset free of heap allocations.
 ///
 /// **Example:** appending individual bits
 /// @code
@@ -51,10 +108,13 @@ namespace marnav::utils
 /// bits.set(1, 512, 1); // set one bit to 1 at offset 512
 /// @endcode
 ///
-template <class Block,
+template <class Block, class Container = std::vector<Block>,
 	class = typename std::enable_if<!std::numeric_limits<Block>::is_signed>::type>
 class bitset
 {
+	static_assert(std::is_same<Block, typename Container::value_type>::value,
+		"container must hold blocks");
+
 public:
 	using block_type = Block;
 
@@ -65,7 +125,7 @@ public:
 	static constexpr auto bits_per_block = sizeof(block_type) * bits_per_byte;
 
 public:
-	using container = std::vector<block_type>;
+	using container = Container;
 	using size_type = typename container::size_type;
 	using data_const_iterator = typename container::const_iterator;
 
@@ -323,28 +383,51 @@ private:
 		if (ofs + bits > capacity())
 			extend(ofs + bits - capacity());
 
-		// fraction of the first block
-		size_type u_bits = bits_per_block - (ofs % bits_per_block); // part of the first block
-		if (u_bits > 0) {
-			if (bits <= u_bits) {
-				set_block(v, ofs, bits);
-				ofs += bits;
-				bits = 0;
+		// read/modify/write of one or two 64 bit windows, instead of block by block
+		if constexpr ((bits_per_block <= 64) && (sizeof(T) <= sizeof(uint64_t))) {
+			const size_type i = ofs / bits_per_block;
+			const size_type shift = ofs % bits_per_block;
+			const uint64_t value = static_cast<uint64_t>(v);
+			if (shift + bits <= 64) {
+				const size_type lsb = 64 - shift - bits;
+				const uint64_t mask = (~uint64_t{0} >> (64 - bits)) << lsb;
+				store_window(i, (load_window(i) & ~mask) | ((value << lsb) & mask));
 			} else {
-				set_block(v >> (bits - u_bits), ofs, u_bits);
-				ofs += u_bits;
-				bits -= u_bits;
+				// value spans two windows: (64 - shift) bits in the first, the rest
+				// in the most significant bits of the second one.
+				const size_type rest = shift + bits - 64;
+				const uint64_t mask0 = ~uint64_t{0} >> shift;
+				const uint64_t mask1 = ~(~uint64_t{0} >> rest);
+				store_window(i, (load_window(i) & ~mask0) | ((value >> rest) & mask0));
+				const size_type j = i + window_blocks;
+				store_window(j, (load_window(j) & ~mask1) | (value << (64 - rest)));
+			}
+			if (ofs + bits > pos_)
+				pos_ = ofs + bits;
+		} else {
+			// fraction of the first block
+			size_type u_bits = bits_per_block - (ofs % bits_per_block);
+			if (u_bits > 0) {
+				if (bits <= u_bits) {
+					set_block(v, ofs, bits);
+					ofs += bits;
+					bits = 0;
+				} else {
+					set_block(v >> (bits - u_bits), ofs, u_bits);
+					ofs += u_bits;
+					bits -= u_bits;
+				}
 			}
-		}
 
-		// all complete blocks
-		for (; bits > bits_per_block; bits -= bits_per_block, ofs += bits_per_block) {
-			set_block(v >> (bits - bits_per_block), ofs);
-		}
+			// all complete blocks
+			for (; bits > bits_per_block; bits -= bits_per_block, ofs += bits_per_block) {
+				set_block(v >> (bits - bits_per_block), ofs);
+			}
 
-		// fraction of the last block
-		if (bits > 0) {
-			set_block(v << (bits_per_block - bits), ofs);
+			// fraction of the last block
+			if (bits > 0) {
+				set_block(v << (bits_per_block - bits), ofs);
+			}
 		}
 	}
 
@@ -360,6 +443,31 @@ private:
 		set_impl(static_cast<typename std::underlying_type<T>::type>(v), ofs, bits);
 	}
 
+	/// Number of blocks within a 64 bit window.
+	static constexpr size_type window_blocks = 64 / bits_per_block;
+
+	/// Reads 64 bits, beginning with the block at the specified index, the first
+	/// block being the most significant. Blocks beyond the end are read as zero.
+	uint64_t load_window(size_type i) const noexcept
+	{
+		return detail::load_window(data_.data(), data_.size(), i);
+	}
+
+	/// Writes 64 bits, beginning with the block at the specified index. Blocks
+	/// beyond the end are not written.
+	void store_window(size_type i, uint64_t w) noexcept
+	{
+		if constexpr (window_blocks == 1) {
+			data_[i] = static_cast<block_type>(w);
+		} else {
+			for (size_type k = window_blocks; k > 0; --k) {
+				if (i + k - 1 < data_.size())
+					data_[i + k - 1] = static_cast<block_type>(w);
+				w >>= bits_per_block;
+			}
+		}
+	}
+
 	/// Reads a block from the bit set.
 	///
 	/// @return    The container to hold the data.
@@ -514,6 +622,9 @@ public: // iterators
 	/// Returns a const iterator to the end of the data itself.
 	data_const_iterator data_end() const { return data_.end(); }
 
+	/// Returns a pointer to the blocks, e.g. to be used by `bitset_view`.
+	const block_type * data() const noexcept { return data_.data(); }
+
 	const_iterator begin() const { return const_iterator(this, 0); }
 
 	const_iterator end() const { return const_iterator(this, size()); }
@@ -529,8 +640,8 @@ public: // append
 	///
 	/// @note It is not allowed to append a bitself to itself.
 	/// @note This algorithm is not efficient.
-	template <class U>
-	void append(const bitset<U> & bs)
+	template <class U, class C>
+	void append(const bitset<U, C> & bs)
 	{
 		if (reinterpret_cast<const void *>(this) == reinterpret_cast<const void *>(&bs))
 			return;
@@ -568,6 +679,40 @@ public: // append
 		}
 	}
 
+	/// Appends bits from packed data, beginning with the most significant bit
+	/// of the first block. This is the layout used by the bitset itself, therefore
+	/// the data is copied block wise if this bitset ends on a block boundary.
+	///
+	/// @param[in] first Pointer to the first block of the data.
+	/// @param[in] bits Number of bits to append. Unused (least significant) bits
+	///            of the last block are ignored.
+	void append_packed(const block_type * first, size_type bits)
+	{
+		if (bits == 0)
+			return;
+
+		const size_type n_blocks = bits / bits_per_block;
+		const size_type u_bits = bits % bits_per_block;
+
+		if (pos_ % bits_per_block == 0) {
+			const size_type i = pos_ / bits_per_block;
+			const size_type n = n_blocks + (u_bits > 0 ? 1 : 0);
+			if (data_.size() < i + n)
+				data_.resize(i + n);
+			std::copy(first, first + n, data_.begin() + i);
+			if (u_bits > 0)
+				data_[i + n_blocks] &= static_cast<block_type>(
+					std::numeric_limits<block_type>::max() << (bits_per_block - u_bits));
+			pos_ += bits;
+			return;
+		}
+
+		for (size_type i = 0; i < n_blocks; ++i)
+			append_block(first[i]);
+		if (u_bits > 0)
+			append_block(first[n_blocks] >> (bits_per_block - u_bits), u_bits);
+	}
+
 public: // set
 	/// Sets the specified bitset at the offset within this bitset.
 	///
@@ -577,8 +722,8 @@ public: // set
 	///
 	/// @note It is not allowed to set a bitself to itself.
 	/// @note This algorithm is not efficient.
-	template <class U>
-	void set(const bitset<U> & bs, size_type ofs)
+	template <class U, class C>
+	void set(const bitset<U, C> & bs, size_type ofs)
 	{
 		if (reinterpret_cast<const void *>(this) == reinterpret_cast<const void *>(&bs))
 			return;
@@ -686,43 +831,48 @@ public: // get
 				+ std::to_string(bits) + ") exceed available number of bits ("
 				+ std::to_string(pos_) + ")"};
 
-		T value = 0;
-
-		// number of bits unused within the current block
-		size_type u_bits = bits_per_block - (ofs % bits_per_block);
+		// extraction from one or two 64 bit windows, instead of block by block
+		if constexpr ((bits_per_block <= 64) && (sizeof(T) <= sizeof(uint64_t))) {
+			return static_cast<T>(detail::extract_bits(data_.data(), data_.size(), ofs, bits));
+		} else {
+			T value = 0;
+
+			// number of bits unused within the current block
+			size_type u_bits = bits_per_block - (ofs % bits_per_block);
+
+			// fraction of the first block
+			if (u_bits > 0) {
+				auto block = get_block(ofs, u_bits);
+				if (bits < u_bits) {
+					block >>= (u_bits - bits);
+					bits = 0;
+				} else {
+					bits -= u_bits;
+				}
+				value += block;
+				ofs += u_bits;
+			}
 
-		// fraction of the first block
-		if (u_bits > 0) {
-			auto block = get_block(ofs, u_bits);
-			if (bits < u_bits) {
-				block >>= (u_bits - bits);
-				bits = 0;
-			} else {
-				bits -= u_bits;
+			// all complete blocks inbetween, only possible if sizeof(T) exceeds
+			// the block size (mupltiple blocks in one T).
+			// since this check is possible at compile time, modern compilers
+			// probably will eliminated it completely.
+			if (sizeof(T) * bits_per_byte > bits_per_block) {
+				for (; bits >= bits_per_block; bits -= bits_per_block) {
+					value <<= bits_per_block;
+					value += get_block(ofs);
+					ofs += bits_per_block;
+				}
 			}
-			value += block;
-			ofs += u_bits;
-		}
 
-		// all complete blocks inbetween, only possible if sizeof(T) exceeds
-		// the block size (mupltiple blocks in one T).
-		// since this check is possible at compile time, modern compilers
-		// probably will eliminated it completely.
-		if (sizeof(T) * bits_per_byte > bits_per_block) {
-			for (; bits >= bits_per_block; bits -= bits_per_block) {
-				value <<= bits_per_block;
-				value += get_block(ofs);
-				ofs += bits_per_block;
+			// fraction of the last block
+			if (bits > 0) {
+				value <<= bits;
+				value += get_block(ofs, bits);
 			}
-		}
 
-		// fraction of the last block
-		if (bits > 0) {
-			value <<= bits;
-			value += get_block(ofs, bits);
+			return value;
 		}
-
-		return value;
 	}
 
 	/// Specialization of `get` for enumerations.
@@ -767,9 +917,9 @@ public: // comparison operators
 	/// Since the blocks differ, a comparison bit by bit is done.
 	///
 	/// @note This is implemented for readablility, not max performance.
-	template <class XBlock,
+	template <class XBlock, class XContainer,
 		class = typename std::enable_if<!std::numeric_limits<XBlock>::is_signed>::type>
-	bool operator==(const bitset<XBlock> & other) const
+	bool operator==(const bitset<XBlock, XContainer> & other) const
 	{
 		if (size() != other.size())
 			return false;
@@ -790,9 +940,9 @@ public: // comparison operators
 	/// Since the blocks differ, a comparison bit by bit is done.
 	///
 	/// @note This is implemented for readablility, not max performance.
-	template <class XBlock,
+	template <class XBlock, class XContainer,
 		class = typename std::enable_if<!std::numeric_limits<XBlock>::is_signed>::type>
-	bool operator!=(const bitset<XBlock> & other) const
+	bool operator!=(const bitset<XBlock, XContainer> & other) const
 	{
 		return !(*this == other);
 	}
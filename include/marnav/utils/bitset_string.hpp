@@ -13,8 +13,8 @@ namespace marnav::utils
 ///
 /// @param[in] bits The bits to render.
 /// @return String representing the bitset as continous stream of '0' and '1'.
-template <class T>
-std::string to_string(const bitset<T> & bits)
+template <class T, class C>
+std::string to_string(const bitset<T, C> & bits)
 {
 	std::string result;
 	result.reserve(bits.size());
@@ -30,8 +30,8 @@ std::string to_string(const bitset<T> & bits)
 /// @param[in] delm Delimitter to separate the packs.
 /// @return String representing the bitset as stream of '0' and '1', separated by
 ///   the delimitter.
-template <class T>
-std::string to_string(const bitset<T> & bits, std::size_t pack, char delm = ' ')
+template <class T, class C>
+std::string to_string(const bitset<T, C> & bits, std::size_t pack, char delm = ' ')
 {
 	if ((pack == 0) || (pack >= bits.size()))
 		return to_string(bits);
@@ -0,0 +1,183 @@
+#ifndef MARNAV_UTILS_BITSET_VIEW_HPP
+#define MARNAV_UTILS_BITSET_VIEW_HPP
+
+#include <marnav/utils/bitset.hpp>
+
+namespace marnav::utils
+{
+/// A read only, non owning view of bits stored in blocks, e.g. the blocks of
+/// a `bitset` or any other memory holding bits in the same layout.
+///
+/// The view consists of a pointer to the blocks, the offset of the first bit
+/// and the number of bits. Reading data uses the same interface as `bitset`,
+/// offsets are relative to the beginning of the view. This makes it possible
+/// to decode parts of a bitset in place, without copying them to a bitset
+/// of their own.
+///
+/// The view does not own the data, the blocks must outlive the view and
+/// modifications of the viewed bitset, which reallocate the blocks,
+/// invalidate the view.
+///
+/// @tparam Block The data type of the underlying block type.
+///
+/// **Example:** reading a part of a bitset
+/// @code
+/// bitset<uint8_t> bits;
+/// bits.append(0x5, 4);
+/// bits.append(0xab, 8);
+/// bitset_view<uint8_t> view{bits, 4, 8};
+/// auto result = view.get<uint8_t>(0, 8); // 0xab
+/// @endcode
+///
+template <class Block,
+	class = typename std::enable_if<!std::numeric_limits<Block>::is_signed>::type>
+class bitset_view
+{
+public:
+	using block_type = Block;
+	using size_type = std::size_t;
+
+	static constexpr auto bits_per_byte = 8u;
+	static constexpr auto bits_per_block = sizeof(block_type) * bits_per_byte;
+
+	static_assert(bits_per_block <= 64, "block type must not exceed 64 bits");
+
+	bitset_view() = default;
+
+	/// Constructs a view of the specified blocks.
+	///
+	/// @param[in] data Pointer to the blocks.
+	/// @param[in] ofs Offset of the first bit of the view within the blocks.
+	/// @param[in] bits Number of bits of the view.
+	bitset_view(const block_type * data, size_type ofs, size_type bits) noexcept
+		: data_(data + ofs / bits_per_block)
+		, ofs_(ofs % bits_per_block)
+		, size_(bits)
+	{
+	}
+
+	/// Constructs a view of the entire bitset.
+	template <class Container>
+	bitset_view(const bitset<Block, Container> & bits) noexcept
+		: bitset_view(bits.data(), 0, bits.size())
+	{
+	}
+
+	/// Constructs a view of a part of the bitset.
+	///
+	/// @exception std::out_of_range Offset and bits exceed the size of the bitset.
+	template <class Container>
+	bitset_view(const bitset<Block, Container> & bits, size_type ofs, size_type count)
+		: bitset_view(bits.data(), ofs, count)
+	{
+		if (ofs + count > bits.size())
+			throw std::out_of_range{"view exceeds the size of the bitset"};
+	}
+
+	bitset_view(const bitset_view &) = default;
+	bitset_view & operator=(const bitset_view &) = default;
+	bitset_view(bitset_view &&) = default;
+	bitset_view & operator=(bitset_view &&) = default;
+
+	/// Returns the number of bits of the view.
+	size_type size() const noexcept { return size_; }
+
+	/// Returns true if the view contains no bits.
+	bool empty() const noexcept { return size_ == 0; }
+
+	/// Returns a view of a part of this view.
+	///
+	/// @exception std::out_of_range Offset and bits exceed the size of the view.
+	bitset_view subview(size_type ofs, size_type bits) const
+	{
+		if (ofs + bits > size_)
+			throw std::out_of_range{"subview exceeds the size of the view"};
+		return bitset_view{data_, ofs_ + ofs, bits};
+	}
+
+public: // get
+	/// Returns the bit at the specified position.
+	///
+	/// @exception std::out_of_range Specified index is out of range.
+	bool get_bit(size_type i) const
+	{
+		if (i >= size_)
+			throw std::out_of_range{"index out of range"};
+
+		const size_type ofs = ofs_ + i;
+		const size_type n_bit = bits_per_block - (ofs % bits_per_block) - 1;
+		return ((data_[ofs / bits_per_block] >> n_bit) & 1) ? true : false;
+	}
+
+	/// Simply an other name for get_bit.
+	bool test(size_type i) const { return get_bit(i); }
+
+	/// Reads data from the view, same as `bitset::get`.
+	///
+	/// @param[in] ofs The offset in bits, relative to the beginning of the view.
+	/// @param[in] bits Number of bits to be read.
+	/// @return The data read from the view.
+	/// @exception std::invalid_argument Number of bits exceed the number of
+	///            bits provided by the return value.
+	/// @exception std::out_of_range Offset and bits exceed the size of the view.
+	template <class T>
+	typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value,
+		T>::type
+	get(size_type ofs, size_type bits = sizeof(T) * bits_per_byte) const
+	{
+		static_assert(sizeof(T) <= sizeof(uint64_t), "type must not exceed 64 bits");
+
+		if (bits <= 0)
+			return T{};
+		if (bits > sizeof(T) * bits_per_byte)
+			throw std::invalid_argument{"number of bits (" + std::to_string(bits)
+				+ ") exceed number of available bits ("
+				+ std::to_string(sizeof(T) * bits_per_byte) + ")"};
+		if (ofs + bits > size_)
+			throw std::out_of_range{"offset (" + std::to_string(ofs) + ") and bits ("
+				+ std::to_string(bits) + ") exceed available number of bits ("
+				+ std::to_string(size_) + ")"};
+
+		return static_cast<T>(detail::extract_bits(data_, n_blocks(), ofs_ + ofs, bits));
+	}
+
+	/// Specialization of `get` for enumerations.
+	template <class T>
+	typename std::enable_if<std::is_enum<T>::value, T>::type get(
+		size_type ofs, size_type bits = sizeof(T) * bits_per_byte) const
+	{
+		return static_cast<T>(get<typename std::underlying_type<T>::type>(ofs, bits));
+	}
+
+	/// Specialization of `get` for bool.
+	template <class T, typename std::enable_if<std::is_same<T, bool>::value, int>::type = 0>
+	void get(T & value, size_type ofs, size_type = 1) const
+	{
+		value = get_bit(ofs);
+	}
+
+	template <class T, typename std::enable_if<!std::is_same<T, bool>::value, int>::type = 0>
+	void get(T & value, size_type ofs, size_type bits = sizeof(T) * bits_per_byte) const
+	{
+		value = get<T>(ofs, bits);
+	}
+
+	bool get(size_type ofs) const { return get_bit(ofs); }
+
+	/// Returns the bit at the specified position.
+	bool operator[](size_type i) const { return get_bit(i); }
+
+private:
+	const block_type * data_ = nullptr; // block containing the first bit
+	size_type ofs_ = 0; // offset of the first bit within the first block
+	size_type size_ = 0; // number of bits
+
+	/// Number of blocks touched by the view.
+	size_type n_blocks() const noexcept
+	{
+		return (ofs_ + size_ + bits_per_block - 1) / bits_per_block;
+	}
+};
+}
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef MARNAV_UTILS_PARSE_STATISTICS_HPP
+#define MARNAV_UTILS_PARSE_STATISTICS_HPP
+
+#include <array>
+#include <cstdint>
+
+namespace marnav::utils
+{
+/// @brief Snapshot of the parse statistics of one sentence or message type.
+///
+/// Parse statistics are only collected if the library was built with
+/// instrumentation (CMake option `ENABLE_INSTRUMENTATION`), see
+/// `is_instrumentation_enabled`.
+struct parse_statistics {
+	constexpr static std::size_t latency_buckets = 32;
+
+	uint64_t parsed = 0; ///< Number of successful parses.
+	uint64_t failed_checksum = 0; ///< Failures because of wrong checksums.
+	uint64_t failed_unknown = 0; ///< Failures because of unknown/unsupported types.
+	uint64_t failed_invalid = 0; ///< Failures because of malformed data or invalid fields.
+	uint64_t latency_total_ns = 0; ///< Sum of all parse latencies, in nanoseconds.
+
+	/// Histogram of the parse latencies. Bucket `0` counts latencies of zero,
+	/// bucket `i` counts latencies of `[2^(i-1), 2^i)` nanoseconds. The last
+	/// bucket contains all larger latencies as well.
+	std::array<uint64_t, latency_buckets> latency = {};
+
+	uint64_t failed() const noexcept
+	{
+		return failed_checksum + failed_unknown + failed_invalid;
+	}
+
+	uint64_t total() const noexcept { return parsed + failed(); }
+};
+
+bool is_instrumentation_enabled() noexcept;
+}
+
+#endif
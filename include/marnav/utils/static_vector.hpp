@@ -0,0 +1,148 @@
+#ifndef MARNAV_UTILS_STATIC_VECTOR_HPP
+#define MARNAV_UTILS_STATIC_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <stdexcept>
+#include <cstddef>
+
+namespace marnav::utils
+{
+/// A vector with fixed capacity and inline storage, it never allocates memory.
+///
+/// Provides the subset of the `std::vector` interface which is used by
+/// `utils::bitset`, therefore it is suitable as its container.
+///
+/// Exceeding the capacity throws `std::length_error`.
+///
+/// @tparam T Type of the elements, must be default constructible.
+/// @tparam N Capacity, maximum number of elements.
+///
+/// **Example:** bitset without heap allocations
+/// @code
+/// bitset<uint8_t, static_vector<uint8_t, 16>> bits; // up to 128 bits
+/// bits.append(0xff, 8);
+/// @endcode
+///
+template <class T, std::size_t N>
+class static_vector
+{
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type &;
+	using const_reference = const value_type &;
+	using iterator = value_type *;
+	using const_iterator = const value_type *;
+
+	static_vector() = default;
+
+	static_vector(size_type n, const value_type & value = value_type{}) { resize(n, value); }
+
+	template <class InputIt>
+	static_vector(InputIt first, InputIt last)
+	{
+		assign(first, last);
+	}
+
+	static_vector(std::initializer_list<value_type> init) { assign(init); }
+
+	static_vector(const static_vector &) = default;
+	static_vector & operator=(const static_vector &) = default;
+	static_vector(static_vector &&) = default;
+	static_vector & operator=(static_vector &&) = default;
+
+	static constexpr size_type capacity() noexcept { return N; }
+	static constexpr size_type max_size() noexcept { return N; }
+
+	size_type size() const noexcept { return size_; }
+	bool empty() const noexcept { return size_ == 0; }
+
+	/// Does nothing, except checking the capacity.
+	///
+	/// @exception std::length_error The specified number exceeds the capacity.
+	void reserve(size_type n) const
+	{
+		if (n > N)
+			throw std::length_error{"static_vector: capacity exceeded"};
+	}
+
+	void clear() noexcept { size_ = 0; }
+
+	void resize(size_type n, const value_type & value = value_type{})
+	{
+		reserve(n);
+		if (n > size_)
+			std::fill(begin() + size_, begin() + n, value);
+		size_ = n;
+	}
+
+	void push_back(const value_type & value)
+	{
+		reserve(size_ + 1);
+		data_[size_++] = value;
+	}
+
+	void pop_back() noexcept { --size_; }
+
+	template <class InputIt>
+	void assign(InputIt first, InputIt last)
+	{
+		clear();
+		for (; first != last; ++first)
+			push_back(*first);
+	}
+
+	void assign(std::initializer_list<value_type> init) { assign(init.begin(), init.end()); }
+
+	reference operator[](size_type i) noexcept { return data_[i]; }
+	const_reference operator[](size_type i) const noexcept { return data_[i]; }
+
+	reference at(size_type i)
+	{
+		if (i >= size_)
+			throw std::out_of_range{"static_vector: index out of range"};
+		return data_[i];
+	}
+
+	const_reference at(size_type i) const
+	{
+		if (i >= size_)
+			throw std::out_of_range{"static_vector: index out of range"};
+		return data_[i];
+	}
+
+	reference front() noexcept { return data_[0]; }
+	const_reference front() const noexcept { return data_[0]; }
+	reference back() noexcept { return data_[size_ - 1]; }
+	const_reference back() const noexcept { return data_[size_ - 1]; }
+
+	value_type * data() noexcept { return data_.data(); }
+	const value_type * data() const noexcept { return data_.data(); }
+
+	iterator begin() noexcept { return data_.data(); }
+	iterator end() noexcept { return data_.data() + size_; }
+	const_iterator begin() const noexcept { return data_.data(); }
+	const_iterator end() const noexcept { return data_.data() + size_; }
+	const_iterator cbegin() const noexcept { return begin(); }
+	const_iterator cend() const noexcept { return end(); }
+
+	friend bool operator==(const static_vector & a, const static_vector & b)
+	{
+		return (a.size_ == b.size_) && std::equal(a.begin(), a.end(), b.begin());
+	}
+
+	friend bool operator!=(const static_vector & a, const static_vector & b)
+	{
+		return !(a == b);
+	}
+
+private:
+	std::array<value_type, N> data_ = {};
+	size_type size_ = 0;
+};
+}
+
+#endif
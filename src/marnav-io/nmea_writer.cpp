@@ -0,0 +1,124 @@
+#include <marnav-io/nmea_writer.hpp>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace marnav::io
+{
+/// Initializes the writer, opens the device (if valid).
+///
+/// @param[in] d The device to write data to, will be opened.
+/// @param[in] flush_size Number of buffered bytes at which the buffer is flushed.
+/// @param[in] flush_interval Maximum time data remains in the buffer, checked at
+///   every write and poll.
+nmea_writer::nmea_writer(std::unique_ptr<device> && d, std::string::size_type flush_size,
+	clock::duration flush_interval)
+	: flush_size_(std::max(flush_size, std::string::size_type{1}))
+	, flush_interval_(flush_interval)
+	, dev_(std::move(d))
+{
+	buffer_.reserve(flush_size_ + nmea::sentence::max_length + 2u);
+	if (dev_)
+		dev_->open();
+}
+
+/// Writes pending data, errors are ignored.
+nmea_writer::~nmea_writer()
+{
+	try {
+		close();
+	} catch (...) {
+		// nothing to do about it
+	}
+}
+
+/// Writes all pending data and closes the device.
+///
+/// @exception std::runtime_error Write error.
+void nmea_writer::close()
+{
+	if (!dev_)
+		return;
+	flush();
+	dev_->close();
+	dev_.reset();
+}
+
+/// Appends the raw sentence to the buffer, CRLF is appended if not already present.
+/// The buffer is flushed if one of the thresholds is reached.
+///
+/// @param[in] s The sentence to write.
+/// @param[in] now The current time, used to check the flush interval.
+/// @exception std::runtime_error The device is invalid or write error.
+void nmea_writer::write(const std::string & s, clock::time_point now)
+{
+	if (buffer_.empty())
+		first_pending_ = now;
+
+	buffer_ += s;
+	if ((s.size() < 2u) || (s[s.size() - 2] != '\r') || (s[s.size() - 1] != '\n'))
+		buffer_ += "\r\n";
+	++stats_.sentences;
+
+	if ((buffer_.size() >= flush_size_) || (now - first_pending_ >= flush_interval_))
+		flush();
+}
+
+/// Renders the sentence and appends it to the buffer.
+///
+/// @see write(const std::string &, clock::time_point)
+void nmea_writer::write(const nmea::sentence & s, clock::time_point now)
+{
+	write(nmea::to_string(s), now);
+}
+
+/// Flushes the buffer if the pending data has exceeded the flush interval.
+/// This is meant to be called periodically, in case no data is written.
+///
+/// @param[in] now The current time.
+/// @retval true The buffer was flushed.
+/// @retval false Nothing to do.
+/// @exception std::runtime_error The device is invalid or write error.
+bool nmea_writer::poll(clock::time_point now)
+{
+	if (buffer_.empty() || (now - first_pending_ < flush_interval_))
+		return false;
+	flush();
+	return true;
+}
+
+/// Writes all pending data to the device. Normally this needs exactly one
+/// call to `device::write`, more only if the device accepts partial writes.
+///
+/// @exception std::runtime_error The device is invalid or write error.
+void nmea_writer::flush()
+{
+	if (buffer_.empty())
+		return;
+	if (!dev_)
+		throw std::runtime_error{"device invalid"};
+
+	const auto t0 = clock::now();
+
+	std::string::size_type ofs = 0;
+	while (ofs < buffer_.size()) {
+		const auto n = static_cast<uint32_t>(std::min(buffer_.size() - ofs,
+			std::string::size_type{std::numeric_limits<uint32_t>::max()}));
+		const int rc = dev_->write(buffer_.data() + ofs, n);
+		++stats_.writes;
+		if (rc <= 0) {
+			buffer_.erase(0, ofs);
+			throw std::runtime_error{"write error"};
+		}
+		ofs += static_cast<std::string::size_type>(rc);
+		stats_.bytes += static_cast<uint64_t>(rc);
+	}
+	buffer_.clear();
+
+	// time spent writing, the time the data was waiting in the buffer is not included
+	const auto duration = clock::now() - t0;
+	++stats_.flushes;
+	stats_.last_write_duration = duration;
+	stats_.max_write_duration = std::max(stats_.max_write_duration, duration);
+}
+}
@@ -21,9 +21,10 @@
 #include <marnav/ais/message_22.hpp>
 #include <marnav/ais/message_23.hpp>
 #include <marnav/ais/message_24.hpp>
+#include "../utils/parse_counters.hpp"
 
 #include <algorithm>
-#include <functional>
+#include <array>
 
 /// @example parse_ais.cpp
 /// This example shows how to parse AIS messages from NMEA sentences.
@@ -37,6 +38,27 @@
 
 namespace marnav::ais
 {
+/// @cond DEV
+namespace
+{
+/// Returns the six bit values for all possible payload characters, the same
+/// as `decode_armoring` does.
+static constexpr std::array<uint8_t, 256> make_armoring_table() noexcept
+{
+	std::array<uint8_t, 256> t{};
+	for (std::size_t i = 0; i < t.size(); ++i) {
+		auto value = static_cast<char>(i) - '0';
+		if (value > 40)
+			value -= 8;
+		t[i] = static_cast<uint8_t>(value & 0x3f);
+	}
+	return t;
+}
+
+static constexpr std::array<uint8_t, 256> armoring_table = make_armoring_table();
+}
+/// @endcond
+
 uint8_t decode_armoring(char c)
 {
 	auto value = c - '0';
@@ -53,6 +75,94 @@ char encode_armoring(uint8_t value)
 	return value + '0';
 }
 
+/// Decodes the armored payload of one NMEA sentence and appends the bits.
+///
+/// Four characters are decoded at once into three bytes, which are appended
+/// to the bitset block wise.
+///
+/// @param[in,out] bits The container to append the decoded data to.
+/// @param[in] payload The armored payload.
+/// @param[in] fill_bits Number of fill bits of the last character of the payload.
+/// @exception std::invalid_argument Invalid number of fill bits, or the data would
+///   exceed the maximum size of AIS messages.
+void append_payload(raw & bits, const std::string & payload, uint32_t fill_bits)
+{
+	static_assert(sizeof(raw::block_type) == 1, "block wise decoding needs byte blocks");
+
+	if (payload.empty())
+		return;
+	if (fill_bits > 5)
+		throw std::invalid_argument{"invalid number of fill bits in append_payload"};
+	if (bits.size() + payload.size() * 6 - fill_bits > raw_max_bits)
+		throw std::invalid_argument{"payload exceeds maximum message size in append_payload"};
+
+	// number of characters decoded per chunk, must be a multiple of 4
+	constexpr std::size_t chunk_size = 64;
+	std::array<raw::block_type, chunk_size / 4 * 3> buffer;
+
+	const auto & table = armoring_table;
+	const auto n = payload.size();
+	const auto * p = reinterpret_cast<const uint8_t *>(payload.data());
+
+	for (std::size_t ofs = 0; ofs < n; ofs += chunk_size) {
+		const std::size_t len = std::min(chunk_size, n - ofs);
+		const uint8_t * c = p + ofs;
+		auto * out = buffer.data();
+
+		std::size_t i = 0;
+		for (; i + 4 <= len; i += 4, c += 4) {
+			const uint32_t v = (table[c[0]] << 18) | (table[c[1]] << 12)
+				| (table[c[2]] << 6) | table[c[3]];
+			*out++ = static_cast<uint8_t>(v >> 16);
+			*out++ = static_cast<uint8_t>(v >> 8);
+			*out++ = static_cast<uint8_t>(v);
+		}
+
+		// remaining characters, left aligned within three bytes
+		if (i < len) {
+			uint32_t v = 0;
+			for (std::size_t k = 0; k < 4; ++k)
+				v = (v << 6) | ((i + k < len) ? table[c[k]] : 0u);
+			*out++ = static_cast<uint8_t>(v >> 16);
+			*out++ = static_cast<uint8_t>(v >> 8);
+			*out++ = static_cast<uint8_t>(v);
+		}
+
+		const auto n_bits = len * 6 - ((ofs + len == n) ? fill_bits : 0u);
+		bits.append_packed(buffer.data(), n_bits);
+	}
+}
+
+/// Decodes the header of an AIS message (type, repeat indicator and MMSI)
+/// directly from the armored payload of the first fragment, without decoding
+/// the message.
+///
+/// This is meant for filtering messages before they are reassembled or
+/// decoded, it does not allocate memory.
+///
+/// @param[in] payload The armored payload of the first (or only) fragment.
+/// @return The header of the message.
+/// @exception std::invalid_argument The payload is too short to contain the header.
+message_header peek_header(const std::string & payload)
+{
+	if (payload.size() < payload_header_size)
+		throw std::invalid_argument{"payload too short in ais/peek_header"};
+
+	const auto & table = armoring_table;
+	const auto * c = reinterpret_cast<const uint8_t *>(payload.data());
+
+	// 42 bits: type (6), repeat indicator (2), MMSI (30), 4 bits of the next field
+	uint64_t v = 0;
+	for (std::size_t i = 0; i < payload_header_size; ++i)
+		v = (v << 6) | table[c[i]];
+
+	message_header h;
+	h.type = static_cast<message_id>(v >> 36);
+	h.repeat_indicator = static_cast<uint32_t>((v >> 34) & 0x3);
+	h.mmsi = utils::mmsi{static_cast<uint32_t>((v >> 4) & 0x3fffffff)};
+	return h;
+}
+
 /// @cond DEV
 
 namespace
@@ -60,79 +170,94 @@ namespace
 static raw collect(const std::vector<std::pair<std::string, uint32_t>> & v)
 {
 	raw result;
-	result.reserve(64); // 64 bytes (512) are enough for AIS messages
+	for (auto const & item : v)
+		append_payload(result, item.first, item.second);
 
-	for (auto const & item : v) {
-		const std::string & payload = item.first;
-		const uint32_t pad = item.second;
+	return result;
+}
 
-		auto end = payload.cend();
-		auto last = end - 1;
-		for (auto i = payload.cbegin(); i != end; ++i) {
+using parse_function = std::unique_ptr<message> (*)(const raw &);
 
-			uint8_t value = decode_armoring(*i);
+/// Parser and valid range of the number of bits of a message type.
+struct message_entry {
+	parse_function parse = nullptr;
+	std::size_t min_bits = 0;
+	std::size_t max_bits = 0;
+};
 
-			if (i == last) {
-				result.append(value >> pad, 6 - pad);
-			} else {
-				result.append(value, 6);
-			}
-		}
-	}
+/// Message types are encoded in six bits, the table covers all of them.
+using message_table = std::array<message_entry, 64>;
 
-	return result;
+template <class T>
+static constexpr void register_message(
+	message_table & t, std::size_t min_bits, std::size_t max_bits) noexcept
+{
+	t[static_cast<std::size_t>(T::ID)] = {&detail::factory::parse<T>, min_bits, max_bits};
 }
 
-static std::function<std::unique_ptr<message>(const raw &)> instantiate_message(
-	message_id type, size_t size)
+static constexpr message_table make_message_table() noexcept
 {
-#define REGISTER_MESSAGE(m)              \
-	{                                    \
-		m::ID, detail::factory::parse<m> \
-	}
+	message_table t{};
 
-	struct entry {
-		const message_id id;
-		const std::function<std::unique_ptr<message>(const raw &)> parse;
-	};
-
-	static const std::vector<entry> known_messages = {
-		REGISTER_MESSAGE(message_01),
-		REGISTER_MESSAGE(message_02),
-		REGISTER_MESSAGE(message_03),
-		REGISTER_MESSAGE(message_04),
-		REGISTER_MESSAGE(message_05),
-		REGISTER_MESSAGE(message_06),
-		REGISTER_MESSAGE(message_07),
-		REGISTER_MESSAGE(message_08),
-		REGISTER_MESSAGE(message_09),
-		REGISTER_MESSAGE(message_10),
-		REGISTER_MESSAGE(message_11),
-		REGISTER_MESSAGE(message_12),
-		REGISTER_MESSAGE(message_13),
-		REGISTER_MESSAGE(message_14),
-		REGISTER_MESSAGE(message_17),
-		REGISTER_MESSAGE(message_18),
-		REGISTER_MESSAGE(message_19),
-		REGISTER_MESSAGE(message_20),
-		REGISTER_MESSAGE(message_21),
-		REGISTER_MESSAGE(message_22),
-		REGISTER_MESSAGE(message_23),
-		REGISTER_MESSAGE(message_24),
-	};
-
-#undef REGISTER_MESSAGE
-
-	using namespace std;
-	auto const & i = std::find_if(begin(known_messages), end(known_messages),
-		[type](const entry & e) { return e.id == type; });
-
-	if (i == end(known_messages))
+	// clang-format off
+	register_message<message_01>(t, message_01::SIZE_BITS,      message_01::SIZE_BITS);
+	register_message<message_02>(t, message_02::SIZE_BITS,      message_02::SIZE_BITS);
+	register_message<message_03>(t, message_03::SIZE_BITS,      message_03::SIZE_BITS);
+	register_message<message_04>(t, message_04::SIZE_BITS,      message_04::SIZE_BITS);
+	register_message<message_05>(t, message_05::SIZE_BITS_MIN,  message_05::SIZE_BITS);
+	register_message<message_06>(t, message_06::SIZE_BITS_HEAD, message_06::SIZE_BITS_MAX);
+	register_message<message_07>(t, message_07::SIZE_BITS_MIN,  message_07::SIZE_BITS_MAX);
+	register_message<message_08>(t, message_08::SIZE_BITS_HEAD, message_08::SIZE_BITS_MAX);
+	register_message<message_09>(t, message_09::SIZE_BITS,      message_09::SIZE_BITS);
+	register_message<message_10>(t, message_10::SIZE_BITS,      message_10::SIZE_BITS);
+	register_message<message_11>(t, message_11::SIZE_BITS,      message_11::SIZE_BITS);
+	register_message<message_12>(t, message_12::SIZE_BITS_HEAD, message_12::SIZE_BITS_MAX);
+	register_message<message_13>(t, message_13::SIZE_BITS_MIN,  message_13::SIZE_BITS_MAX);
+	register_message<message_14>(t, message_14::SIZE_BITS_HEAD, message_14::SIZE_BITS_MAX);
+	register_message<message_17>(t, message_17::SIZE_BITS_MIN,  message_17::SIZE_BITS_MAX);
+	register_message<message_18>(t, message_18::SIZE_BITS,      message_18::SIZE_BITS);
+	register_message<message_19>(t, message_19::SIZE_BITS,      message_19::SIZE_BITS);
+	register_message<message_20>(t, message_20::SIZE_BITS_MIN,  message_20::SIZE_BITS_MAX);
+	register_message<message_21>(t, message_21::SIZE_BITS_MIN,  message_21::SIZE_BITS_MAX);
+	register_message<message_22>(t, message_22::SIZE_BITS,      message_22::SIZE_BITS);
+	register_message<message_23>(t, message_23::SIZE_BITS,      message_23::SIZE_BITS);
+	register_message<message_24>(t, message_24::SIZE_BITS_IGNORED_SPARES_OF_TYPE_A, message_24::SIZE_BITS);
+	// clang-format on
+
+	return t;
+}
+
+static constexpr message_table known_messages = make_message_table();
+
+/// Returns the parser for the specified message type. The number of bits is
+/// checked against the valid range of the message type, before the message
+/// is constructed. The message itself may check its size more precisely.
+static parse_function instantiate_message(message_id type, std::size_t size)
+{
+	const auto & entry = known_messages[static_cast<std::size_t>(type) % known_messages.size()];
+
+	if (!entry.parse)
 		throw unknown_message{"unknown message in ais/instantiate_message: "
 			+ std::to_string(static_cast<uint8_t>(type)) + " (" + std::to_string(size)
 			+ " bits)"};
 
-	return i->parse;
+	if ((size < entry.min_bits) || (size > entry.max_bits))
+		throw std::invalid_argument{"invalid number of bits in ais/instantiate_message: "
+			+ std::to_string(static_cast<uint8_t>(type)) + " (" + std::to_string(size)
+			+ " bits)"};
+
+	return entry.parse;
+}
+
+/// Parse statistics for all message types (six bits), including unknown ones.
+/// Failures which cannot be associated with a message type are counted for
+/// message_id::NONE.
+static std::array<utils::detail::parse_counters, std::tuple_size<message_table>::value>
+	statistics;
+
+static utils::detail::parse_counters & counters(message_id id) noexcept
+{
+	return statistics[static_cast<std::size_t>(id) % statistics.size()];
 }
 }
 
@@ -148,9 +273,54 @@ static std::function<std::unique_ptr<message>(const raw &)> instantiate_message(
 ///   the message.
 std::unique_ptr<message> make_message(const std::vector<std::pair<std::string, uint32_t>> & v)
 {
-	auto bits = collect(v);
+#if defined(MARNAV_INSTRUMENTATION)
+	// failures of decoding the payload cannot be associated with a message type
+	using clock = utils::detail::parse_counters::clock;
+	const auto t0 = clock::now();
+	raw bits;
+	try {
+		bits = collect(v);
+	} catch (...) {
+		counters(message_id::NONE)
+			.record(utils::detail::parse_result::invalid, clock::now() - t0);
+		throw;
+	}
+	return make_message(bits);
+#else
+	return make_message(collect(v));
+#endif
+}
+
+/// Creates the AIS message from the specified, already decoded, data.
+///
+/// @param[in] bits The complete message data.
+/// @return The constructed AIS message.
+/// @exception unknown_message Will be thrown if the AIS message is not supported.
+/// @exception std::invalid_argument Error has been occurred during parsing of
+///   the message.
+std::unique_ptr<message> make_message(const raw & bits)
+{
+#if defined(MARNAV_INSTRUMENTATION)
+	using utils::detail::parse_result;
+	using clock = utils::detail::parse_counters::clock;
+	const auto t0 = clock::now();
+	auto type = message_id::NONE;
+	try {
+		type = static_cast<message_id>(bits.get<uint8_t>(0, 6));
+		auto result = instantiate_message(type, bits.size())(bits);
+		counters(type).record(parse_result::success, clock::now() - t0);
+		return result;
+	} catch (unknown_message &) {
+		counters(type).record(parse_result::unknown, clock::now() - t0);
+		throw;
+	} catch (...) {
+		counters(type).record(parse_result::invalid, clock::now() - t0);
+		throw;
+	}
+#else
 	auto type = static_cast<message_id>(bits.get<uint8_t>(0, 6));
 	return instantiate_message(type, bits.size())(bits);
+#endif
 }
 
 /// Encodes the specified message and returns a container with payload and padding
@@ -197,4 +367,46 @@ std::vector<std::pair<std::string, uint32_t>> encode_message(const message & msg
 
 	return result;
 }
+
+/// Encodes the specified message and returns its bits, without armoring them.
+///
+/// Since the bits are stored inline, this does not allocate memory. The bits
+/// may be rendered to NMEA sentences by `nmea::write_vdms`.
+///
+/// @param[in] msg The message to encode.
+/// @return The bits of the message.
+/// @exception std::invalid_argument The message is not able to encode.
+raw encode_bits(const message & msg)
+{
+	auto bits = msg.get_data();
+	if (bits.size() == 0)
+		throw std::invalid_argument{"message not able to encode"};
+	return bits;
+}
+
+/// Returns a snapshot of the parse statistics of `make_message`, only message IDs
+/// with recorded parses are contained. Unknown message types are reported with
+/// their value, which is not necessarily an enumerator of `message_id`. Failures
+/// which could not be associated with a message type are reported for
+/// `message_id::NONE`.
+///
+/// The statistics are empty if the library was built without instrumentation,
+/// see `utils::is_instrumentation_enabled`.
+std::vector<std::pair<message_id, utils::parse_statistics>> get_parse_statistics()
+{
+	std::vector<std::pair<message_id, utils::parse_statistics>> result;
+	for (std::size_t i = 0; i < statistics.size(); ++i) {
+		const auto s = statistics[i].snapshot();
+		if (s.total() > 0)
+			result.emplace_back(static_cast<message_id>(i), s);
+	}
+	return result;
+}
+
+/// Resets the parse statistics of all messages.
+void reset_parse_statistics()
+{
+	for (auto & c : statistics)
+		c.reset();
+}
 }
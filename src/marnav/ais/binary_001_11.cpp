@@ -4,7 +4,7 @@
 
 namespace marnav::ais
 {
-void binary_001_11::read_from(const raw & payload)
+void binary_001_11::read_from(const raw_view & payload)
 {
 	if (payload.size() != SIZE_BITS)
 		throw std::invalid_argument{"wrong number of bits in playload of binary_001_11"};
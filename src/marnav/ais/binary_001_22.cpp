@@ -0,0 +1,226 @@
+#include <marnav/ais/binary_001_22.hpp>
+#include <marnav/ais/angle.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+// offsets within a sub-area
+constexpr std::size_t shape_bits = 3;
+constexpr std::size_t scale_offset = 3;
+constexpr std::size_t lon_offset = 5;
+constexpr std::size_t lon_bits = 25;
+constexpr std::size_t lat_offset = 30;
+constexpr std::size_t lat_bits = 24;
+constexpr std::size_t precision_offset = 54;
+constexpr std::size_t shape_data_offset = 57;
+constexpr std::size_t point_bits = 20;
+constexpr std::size_t text_sixbits = 14;
+}
+/// @endcond
+
+/// Reads the header and all sub-areas. Trailing bits, not sufficient for a
+/// complete sub-area (padding), are ignored.
+///
+/// @exception std::invalid_argument The payload is too short or contains
+///   a sub-area of unknown shape.
+void binary_001_22::read_from(const raw_view & payload)
+{
+	static_assert(is_valid_layout<decltype(fields(*this))>(0, SIZE_BITS_HEAD),
+		"invalid layout of binary_001_22");
+
+	if (payload.size() < SIZE_BITS_HEAD)
+		throw std::invalid_argument{"wrong number of bits in playload of binary_001_22"};
+
+	get_fields(payload, fields(*this));
+
+	const auto n = std::min<std::size_t>(
+		(payload.size() - SIZE_BITS_HEAD) / SIZE_BITS_AREA, MAX_AREAS);
+
+	areas_.clear();
+	areas_.reserve(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto area = payload.subview(SIZE_BITS_HEAD + i * SIZE_BITS_AREA, SIZE_BITS_AREA);
+
+		sub_area a;
+		const auto type = area.get<uint8_t>(0, shape_bits);
+		if (type > static_cast<uint8_t>(shape::text))
+			throw std::invalid_argument{"unknown shape of sub-area in binary_001_22"};
+		a.type = static_cast<shape>(type);
+
+		switch (a.type) {
+			case shape::circle:
+			case shape::rectangle:
+			case shape::sector:
+				a.scale = area.get<uint32_t>(scale_offset, 2);
+				a.position = geo::position{
+					to_geo_latitude(area.get<uint32_t>(lat_offset, lat_bits), lat_bits,
+						angle_scale::I3),
+					to_geo_longitude(area.get<uint32_t>(lon_offset, lon_bits), lon_bits,
+						angle_scale::I3)};
+				a.precision = area.get<uint32_t>(precision_offset, 3);
+				if (a.type == shape::rectangle) {
+					a.east_dimension = area.get<uint32_t>(shape_data_offset, 8);
+					a.north_dimension = area.get<uint32_t>(shape_data_offset + 8, 8);
+					a.orientation = area.get<uint32_t>(shape_data_offset + 16, 9);
+				} else {
+					a.radius = area.get<uint32_t>(shape_data_offset, 12);
+					if (a.type == shape::sector) {
+						a.left_bound = area.get<uint32_t>(shape_data_offset + 12, 9);
+						a.right_bound = area.get<uint32_t>(shape_data_offset + 21, 9);
+					}
+				}
+				break;
+
+			case shape::polyline:
+			case shape::polygon:
+				a.scale = area.get<uint32_t>(scale_offset, 2);
+				for (std::size_t j = 0; j < a.points.size(); ++j) {
+					const auto ofs = scale_offset + 2 + j * point_bits;
+					a.points[j].angle = area.get<uint32_t>(ofs, 10);
+					a.points[j].distance = area.get<uint32_t>(ofs + 10, 10);
+				}
+				break;
+
+			case shape::text:
+				a.text = read_trimmed_string(area, shape_bits, text_sixbits);
+				break;
+		}
+		areas_.push_back(a);
+	}
+}
+
+void binary_001_22::write_to(raw & payload) const
+{
+	payload = raw(SIZE_BITS_HEAD + SIZE_BITS_AREA * areas_.size());
+	set_fields(payload, fields(*this));
+
+	for (std::size_t i = 0; i < areas_.size(); ++i) {
+		const auto & a = areas_[i];
+		const auto base = SIZE_BITS_HEAD + i * SIZE_BITS_AREA;
+
+		payload.set(static_cast<uint8_t>(a.type), base, shape_bits);
+		switch (a.type) {
+			case shape::circle:
+			case shape::rectangle:
+			case shape::sector:
+				payload.set(a.scale, base + scale_offset, 2);
+				payload.set(to_longitude_minutes(a.position.lon(), lon_bits, angle_scale::I3),
+					base + lon_offset, lon_bits);
+				payload.set(to_latitude_minutes(a.position.lat(), lat_bits, angle_scale::I3),
+					base + lat_offset, lat_bits);
+				payload.set(a.precision, base + precision_offset, 3);
+				if (a.type == shape::rectangle) {
+					payload.set(a.east_dimension, base + shape_data_offset, 8);
+					payload.set(a.north_dimension, base + shape_data_offset + 8, 8);
+					payload.set(a.orientation, base + shape_data_offset + 16, 9);
+				} else {
+					payload.set(a.radius, base + shape_data_offset, 12);
+					if (a.type == shape::sector) {
+						payload.set(a.left_bound, base + shape_data_offset + 12, 9);
+						payload.set(a.right_bound, base + shape_data_offset + 21, 9);
+					}
+				}
+				break;
+
+			case shape::polyline:
+			case shape::polygon:
+				payload.set(a.scale, base + scale_offset, 2);
+				for (std::size_t j = 0; j < a.points.size(); ++j) {
+					const auto ofs = base + scale_offset + 2 + j * point_bits;
+					payload.set(a.points[j].angle, ofs, 10);
+					payload.set(a.points[j].distance, ofs + 10, 10);
+				}
+				break;
+
+			case shape::text:
+				write_string(payload, base + shape_bits, text_sixbits, a.text);
+				break;
+		}
+	}
+}
+
+std::optional<uint32_t> binary_001_22::get_month() const
+{
+	if (month_ == month_not_available)
+		return {};
+	return {month_};
+}
+
+std::optional<uint32_t> binary_001_22::get_day() const
+{
+	if (day_ == day_not_available)
+		return {};
+	return {day_};
+}
+
+std::optional<uint32_t> binary_001_22::get_hour() const
+{
+	if (hour_ >= hour_not_available)
+		return {};
+	return {hour_};
+}
+
+std::optional<uint32_t> binary_001_22::get_minute() const
+{
+	if (minute_ >= minute_not_available)
+		return {};
+	return {minute_};
+}
+
+/// Returns the duration of the notice in minutes, empty if the notice is
+/// valid indefinitely.
+std::optional<uint32_t> binary_001_22::get_duration() const
+{
+	if (duration_ == duration_indefinite)
+		return {};
+	return {duration_};
+}
+
+/// Sets the month. Value must be either empty optional or a value between `1` and `12`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_22::set_month(std::optional<uint32_t> t)
+{
+	month_ = (!t || *t > 12u) ? month_not_available : *t;
+}
+
+/// Sets the day. Value must be either empty optional or a value between `1` and `31`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_22::set_day(std::optional<uint32_t> t)
+{
+	day_ = (!t || *t > 31u) ? day_not_available : *t;
+}
+
+/// Sets the hour. Value must be either empty optional or a value between `0` and `23`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_22::set_hour(std::optional<uint32_t> t)
+{
+	hour_ = (!t || *t > 23u) ? hour_not_available : *t;
+}
+
+/// Sets the minute. Value must be either empty optional or a value between `0` and `59`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_22::set_minute(std::optional<uint32_t> t)
+{
+	minute_ = (!t || *t > 59u) ? minute_not_available : *t;
+}
+
+/// Sets the duration in minutes, an empty optional means indefinitely.
+void binary_001_22::set_duration(std::optional<uint32_t> t)
+{
+	duration_ = (!t || *t >= duration_indefinite) ? duration_indefinite : *t;
+}
+
+/// Sets the sub-areas of the notice.
+///
+/// @exception std::invalid_argument More than `MAX_AREAS` sub-areas.
+void binary_001_22::set_areas(const std::vector<sub_area> & t)
+{
+	if (t.size() > MAX_AREAS)
+		throw std::invalid_argument{"too many sub-areas in binary_001_22"};
+	areas_ = t;
+}
+}
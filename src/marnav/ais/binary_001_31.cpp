@@ -0,0 +1,503 @@
+#include <marnav/ais/binary_001_31.hpp>
+#include <marnav/ais/angle.hpp>
+#include "sign_extend.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+/// Returns the lower `bits` bits of the value in 0.1 units (two's complement).
+static uint32_t from_signed_tenths(double value, std::size_t bits) noexcept
+{
+	return static_cast<uint32_t>(static_cast<int32_t>(std::round(value * 10.0)))
+		& ((1u << bits) - 1);
+}
+}
+/// @endcond
+
+void binary_001_31::read_from(const raw_view & payload)
+{
+	static_assert(is_valid_layout<decltype(fields(*this))>(0, SIZE_BITS - 10),
+		"invalid layout of binary_001_31");
+
+	if (payload.size() != SIZE_BITS)
+		throw std::invalid_argument{"wrong number of bits in playload of binary_001_31"};
+
+	get_fields(payload, fields(*this));
+}
+
+void binary_001_31::write_to(raw & payload) const
+{
+	payload = raw(SIZE_BITS);
+	set_fields(payload, fields(*this));
+}
+
+std::optional<geo::position> binary_001_31::get_position() const
+{
+	if ((lat_ == lat_not_available) || (lon_ == lon_not_available))
+		return {};
+	return {{to_geo_latitude(lat_, lat_.count, angle_scale::I3),
+		to_geo_longitude(lon_, lon_.count, angle_scale::I3)}};
+}
+
+std::optional<uint32_t> binary_001_31::get_day() const
+{
+	if (day_ == day_not_available)
+		return {};
+	return {day_};
+}
+
+std::optional<uint32_t> binary_001_31::get_hour() const
+{
+	if (hour_ >= hour_not_available)
+		return {};
+	return {hour_};
+}
+
+std::optional<uint32_t> binary_001_31::get_minute() const
+{
+	if (minute_ >= minute_not_available)
+		return {};
+	return {minute_};
+}
+
+/// Returns the average wind speed of the last 10 minutes in knots, `126` means
+/// 126 knots or more.
+std::optional<uint32_t> binary_001_31::get_wind_speed_avg() const
+{
+	if (wind_speed_avg_ == wind_speed_not_available)
+		return {};
+	return {wind_speed_avg_};
+}
+
+/// Returns the maximum wind gust of the last 10 minutes in knots.
+std::optional<uint32_t> binary_001_31::get_wind_gust() const
+{
+	if (wind_gust_ == wind_speed_not_available)
+		return {};
+	return {wind_gust_};
+}
+
+std::optional<uint32_t> binary_001_31::get_wind_direction() const
+{
+	if (wind_direction_ >= wind_direction_not_available)
+		return {};
+	return {wind_direction_};
+}
+
+std::optional<uint32_t> binary_001_31::get_wind_gust_direction() const
+{
+	if (wind_gust_direction_ >= wind_direction_not_available)
+		return {};
+	return {wind_gust_direction_};
+}
+
+/// Returns the air temperature in degrees Celsius between `-60.0` and `+60.0`.
+std::optional<double> binary_001_31::get_air_temperature() const
+{
+	if (air_temperature_ == air_temperature_not_available)
+		return {};
+	return 0.1 * detail::sign_extend(air_temperature_, air_temperature_.count);
+}
+
+/// Returns the relative humidity in percent.
+std::optional<uint32_t> binary_001_31::get_humidity() const
+{
+	if (humidity_ >= humidity_not_available)
+		return {};
+	return {humidity_};
+}
+
+/// Returns the dew point in degrees Celsius between `-20.0` and `+50.0`.
+std::optional<double> binary_001_31::get_dew_point() const
+{
+	if (dew_point_ == dew_point_not_available)
+		return {};
+	return 0.1 * detail::sign_extend(dew_point_, dew_point_.count);
+}
+
+/// Returns the air pressure in `hPa`, `799` means 799 hPa or less, `1201`
+/// means 1201 hPa or more.
+std::optional<uint32_t> binary_001_31::get_pressure() const
+{
+	if (pressure_ > 402u)
+		return {};
+	return {799 + pressure_};
+}
+
+std::optional<binary_001_31::trend> binary_001_31::get_pressure_trend() const
+{
+	if (pressure_trend_ == trend::not_available)
+		return {};
+	return {pressure_trend_};
+}
+
+/// Returns the horizontal visibility in nautical miles. If `get_visibility_greater`
+/// is set, the visibility is greater than the returned value.
+std::optional<double> binary_001_31::get_visibility() const
+{
+	if (visibility_ == visibility_not_available)
+		return {};
+	return 0.1 * visibility_;
+}
+
+/// Returns the deviation of the water level from the reference datum in meters,
+/// between `-10.0` and `+30.0`.
+std::optional<double> binary_001_31::get_water_level() const
+{
+	if (water_level_ >= water_level_not_available)
+		return {};
+	return -10.0 + 0.01 * water_level_;
+}
+
+std::optional<binary_001_31::trend> binary_001_31::get_water_level_trend() const
+{
+	if (water_level_trend_ == trend::not_available)
+		return {};
+	return {water_level_trend_};
+}
+
+/// Returns the speed in knots.
+std::optional<double> binary_001_31::get_surface_current_speed() const
+{
+	if (surface_current_speed_ == current_speed_not_available)
+		return {};
+	return 0.1 * surface_current_speed_;
+}
+
+std::optional<uint32_t> binary_001_31::get_surface_current_direction() const
+{
+	if (surface_current_direction_ >= current_direction_not_available)
+		return {};
+	return {surface_current_direction_};
+}
+
+/// Returns the speed in knots.
+std::optional<double> binary_001_31::get_current_2_speed() const
+{
+	if (current_2_speed_ == current_speed_not_available)
+		return {};
+	return 0.1 * current_2_speed_;
+}
+
+std::optional<uint32_t> binary_001_31::get_current_2_direction() const
+{
+	if (current_2_direction_ >= current_direction_not_available)
+		return {};
+	return {current_2_direction_};
+}
+
+/// Returns the depth in meters.
+std::optional<uint32_t> binary_001_31::get_current_2_depth() const
+{
+	if (current_2_depth_ == current_depth_not_available)
+		return {};
+	return {current_2_depth_};
+}
+
+/// Returns the speed in knots.
+std::optional<double> binary_001_31::get_current_3_speed() const
+{
+	if (current_3_speed_ == current_speed_not_available)
+		return {};
+	return 0.1 * current_3_speed_;
+}
+
+std::optional<uint32_t> binary_001_31::get_current_3_direction() const
+{
+	if (current_3_direction_ >= current_direction_not_available)
+		return {};
+	return {current_3_direction_};
+}
+
+/// Returns the depth in meters.
+std::optional<uint32_t> binary_001_31::get_current_3_depth() const
+{
+	if (current_3_depth_ == current_depth_not_available)
+		return {};
+	return {current_3_depth_};
+}
+
+/// Returns the wave height in meters.
+std::optional<double> binary_001_31::get_wave_height() const
+{
+	if (wave_height_ == wave_height_not_available)
+		return {};
+	return 0.1 * wave_height_;
+}
+
+/// Returns the wave period in seconds.
+std::optional<uint32_t> binary_001_31::get_wave_period() const
+{
+	if (wave_period_ == wave_period_not_available)
+		return {};
+	return {wave_period_};
+}
+
+std::optional<uint32_t> binary_001_31::get_wave_direction() const
+{
+	if (wave_direction_ >= wave_direction_not_available)
+		return {};
+	return {wave_direction_};
+}
+
+/// Returns the swell height in meters.
+std::optional<double> binary_001_31::get_swell_height() const
+{
+	if (swell_height_ == wave_height_not_available)
+		return {};
+	return 0.1 * swell_height_;
+}
+
+/// Returns the swell period in seconds.
+std::optional<uint32_t> binary_001_31::get_swell_period() const
+{
+	if (swell_period_ == wave_period_not_available)
+		return {};
+	return {swell_period_};
+}
+
+std::optional<uint32_t> binary_001_31::get_swell_direction() const
+{
+	if (swell_direction_ >= wave_direction_not_available)
+		return {};
+	return {swell_direction_};
+}
+
+/// Returns the sea state according to the Beaufort scale, between `0` and `12`.
+std::optional<uint32_t> binary_001_31::get_sea_state() const
+{
+	if (sea_state_ >= sea_state_not_available)
+		return {};
+	return {sea_state_};
+}
+
+/// Returns the water temperature in degrees Celsius between `-10.0` and `+50.0`.
+std::optional<double> binary_001_31::get_water_temperature() const
+{
+	if (water_temperature_ == water_temperature_not_available)
+		return {};
+	return 0.1 * detail::sign_extend(water_temperature_, water_temperature_.count);
+}
+
+std::optional<binary_001_31::precipitation> binary_001_31::get_precipitation() const
+{
+	if (precipitation_type_ == precipitation::not_available)
+		return {};
+	return {precipitation_type_};
+}
+
+/// Returns the salinity in parts per thousand.
+std::optional<double> binary_001_31::get_salinity() const
+{
+	if (salinity_ >= salinity_not_available)
+		return {};
+	return 0.1 * salinity_;
+}
+
+std::optional<binary_001_31::ice> binary_001_31::get_ice() const
+{
+	if (ice_info_ == ice::not_available)
+		return {};
+	return {ice_info_};
+}
+
+void binary_001_31::set_position(std::optional<geo::position> t)
+{
+	if (!t) {
+		lat_ = lat_not_available;
+		lon_ = lon_not_available;
+	} else {
+		lat_ = to_latitude_minutes(t->lat(), lat_.count, angle_scale::I3);
+		lon_ = to_longitude_minutes(t->lon(), lon_.count, angle_scale::I3);
+	}
+}
+
+/// Sets the day. Value must be either empty optional or a value between `1` and `31`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_31::set_day(std::optional<uint32_t> t)
+{
+	day_ = (!t || *t > 31u) ? day_not_available : *t;
+}
+
+/// Sets the hour. Value must be either empty optional or a value between `0` and `23`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_31::set_hour(std::optional<uint32_t> t)
+{
+	hour_ = (!t || *t > 23u) ? hour_not_available : *t;
+}
+
+/// Sets the minute. Value must be either empty optional or a value between `0` and `59`.
+/// A value out of range is treated the same as an empty optional.
+void binary_001_31::set_minute(std::optional<uint32_t> t)
+{
+	minute_ = (!t || *t > 59u) ? minute_not_available : *t;
+}
+
+/// Sets the wind speed in knots, values above `126` are limited.
+void binary_001_31::set_wind_speed_avg(std::optional<uint32_t> t)
+{
+	wind_speed_avg_ = !t ? wind_speed_not_available : std::min(*t, 126u);
+}
+
+/// Sets the wind gust in knots, values above `126` are limited.
+void binary_001_31::set_wind_gust(std::optional<uint32_t> t)
+{
+	wind_gust_ = !t ? wind_speed_not_available : std::min(*t, 126u);
+}
+
+void binary_001_31::set_wind_direction(std::optional<uint32_t> t)
+{
+	wind_direction_ = (!t || *t > 359u) ? wind_direction_not_available : *t;
+}
+
+void binary_001_31::set_wind_gust_direction(std::optional<uint32_t> t)
+{
+	wind_gust_direction_ = (!t || *t > 359u) ? wind_direction_not_available : *t;
+}
+
+void binary_001_31::set_air_temperature(std::optional<double> t)
+{
+	air_temperature_ = !t ? air_temperature_not_available
+						  : from_signed_tenths(*t, air_temperature_.count);
+}
+
+void binary_001_31::set_humidity(std::optional<uint32_t> t)
+{
+	humidity_ = (!t || *t > 100u) ? humidity_not_available : *t;
+}
+
+void binary_001_31::set_dew_point(std::optional<double> t)
+{
+	dew_point_ = !t ? dew_point_not_available : from_signed_tenths(*t, dew_point_.count);
+}
+
+/// Sets the air pressure in `hPa`, values are limited to the range of `799` to `1201`.
+void binary_001_31::set_pressure(std::optional<uint32_t> t)
+{
+	pressure_ = !t ? pressure_not_available : std::clamp(*t, 799u, 1201u) - 799u;
+}
+
+void binary_001_31::set_pressure_trend(std::optional<trend> t)
+{
+	pressure_trend_ = !t ? trend::not_available : *t;
+}
+
+void binary_001_31::set_visibility(std::optional<double> t)
+{
+	visibility_ = !t ? visibility_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_water_level(std::optional<double> t)
+{
+	water_level_ = !t ? water_level_not_available
+					  : static_cast<uint32_t>(std::round((*t + 10.0) / 0.01));
+}
+
+void binary_001_31::set_water_level_trend(std::optional<trend> t)
+{
+	water_level_trend_ = !t ? trend::not_available : *t;
+}
+
+void binary_001_31::set_surface_current_speed(std::optional<double> t)
+{
+	surface_current_speed_
+		= !t ? current_speed_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_surface_current_direction(std::optional<uint32_t> t)
+{
+	surface_current_direction_ = (!t || *t > 359u) ? current_direction_not_available : *t;
+}
+
+void binary_001_31::set_current_2_speed(std::optional<double> t)
+{
+	current_2_speed_
+		= !t ? current_speed_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_current_2_direction(std::optional<uint32_t> t)
+{
+	current_2_direction_ = (!t || *t > 359u) ? current_direction_not_available : *t;
+}
+
+void binary_001_31::set_current_2_depth(std::optional<uint32_t> t)
+{
+	current_2_depth_ = !t ? current_depth_not_available : *t;
+}
+
+void binary_001_31::set_current_3_speed(std::optional<double> t)
+{
+	current_3_speed_
+		= !t ? current_speed_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_current_3_direction(std::optional<uint32_t> t)
+{
+	current_3_direction_ = (!t || *t > 359u) ? current_direction_not_available : *t;
+}
+
+void binary_001_31::set_current_3_depth(std::optional<uint32_t> t)
+{
+	current_3_depth_ = !t ? current_depth_not_available : *t;
+}
+
+void binary_001_31::set_wave_height(std::optional<double> t)
+{
+	wave_height_ = !t ? wave_height_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_wave_period(std::optional<uint32_t> t)
+{
+	wave_period_ = !t ? wave_period_not_available : *t;
+}
+
+void binary_001_31::set_wave_direction(std::optional<uint32_t> t)
+{
+	wave_direction_ = (!t || *t > 359u) ? wave_direction_not_available : *t;
+}
+
+void binary_001_31::set_swell_height(std::optional<double> t)
+{
+	swell_height_ = !t ? wave_height_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_swell_period(std::optional<uint32_t> t)
+{
+	swell_period_ = !t ? wave_period_not_available : *t;
+}
+
+void binary_001_31::set_swell_direction(std::optional<uint32_t> t)
+{
+	swell_direction_ = (!t || *t > 359u) ? wave_direction_not_available : *t;
+}
+
+void binary_001_31::set_sea_state(std::optional<uint32_t> t)
+{
+	sea_state_ = (!t || *t > 12u) ? sea_state_not_available : *t;
+}
+
+void binary_001_31::set_water_temperature(std::optional<double> t)
+{
+	water_temperature_ = !t ? water_temperature_not_available
+							: from_signed_tenths(*t, water_temperature_.count);
+}
+
+void binary_001_31::set_precipitation(std::optional<precipitation> t)
+{
+	precipitation_type_ = !t ? precipitation::not_available : *t;
+}
+
+void binary_001_31::set_salinity(std::optional<double> t)
+{
+	salinity_ = !t ? salinity_not_available : static_cast<uint32_t>(std::round(*t / 0.1));
+}
+
+void binary_001_31::set_ice(std::optional<ice> t)
+{
+	ice_info_ = !t ? ice::not_available : *t;
+}
+}
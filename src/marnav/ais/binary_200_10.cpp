@@ -10,7 +10,7 @@ binary_200_10::binary_200_10()
 {
 }
 
-void binary_200_10::read_from(const raw & payload)
+void binary_200_10::read_from(const raw_view & payload)
 {
 	if (payload.size() != SIZE_BITS)
 		throw std::invalid_argument{"wrong number of bits in playload of binary_200_10"};
@@ -1,130 +1,87 @@
 #include <marnav/ais/binary_data.hpp>
 #include <algorithm>
+#include <array>
+#include <stdexcept>
 
 namespace marnav::ais
 {
 /// @cond DEV
 namespace
 {
-struct sixbit_entry {
-	uint8_t value;
-	char c;
-};
+/// Characters of the six bit ASCII encoding, indexed by their value.
+constexpr char sixbit_ascii[]
+	= "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_ !\"#$%&'()*+,-./0123456789:;<=>?";
 
-class sixbit_span
+static_assert(sizeof(sixbit_ascii) == 64 + 1, "invalid six bit ASCII table");
+
+/// Returns the table of the six bit values, indexed by the character,
+/// `0xff` for characters which cannot be encoded.
+static constexpr std::array<uint8_t, 256> make_ascii_sixbit_table() noexcept
 {
-public:
-	constexpr sixbit_span(const sixbit_entry * first, const sixbit_entry * last)
-		: first_(first)
-		, last_(last)
-	{
-	}
+	std::array<uint8_t, 256> t{};
+	for (auto & value : t)
+		value = 0xff;
+	for (uint8_t i = 0; i < 64; ++i)
+		t[static_cast<uint8_t>(sixbit_ascii[i])] = i;
+	return t;
+}
 
-	constexpr const sixbit_entry * begin() const { return first_; }
-	constexpr const sixbit_entry * end() const { return last_; }
+constexpr std::array<uint8_t, 256> ascii_sixbit = make_ascii_sixbit_table();
 
-private:
-	const sixbit_entry * first_ = nullptr;
-	const sixbit_entry * last_ = nullptr;
-};
+/// Number of sixbits extracted from the data at once, fits into 64 bits.
+constexpr raw::size_type sixbits_per_read = 10;
 
-static sixbit_span sixbit_table()
+/// Decodes a string, reading up to ten characters at once. If requested, the string
+/// is trimmed while decoding: it ends before the first `@`, trailing spaces are
+/// removed.
+static std::string decode_string(
+	const raw_view & bits, raw::size_type ofs, raw::size_type count_sixbits, bool trim)
 {
-	// construct-on-first-use with static, in this case not a problem on destruction,
-	// because // the table contains only primitive types, no complex destruction involved,
-	// and access functions (see below) return values not references or pointers.
+	if (ofs + count_sixbits * 6 > bits.size())
+		throw std::out_of_range{"string exceeds data in ais/read_string"};
 
-	static constexpr sixbit_entry SIXBIT_ASCII_TABLE[] = {
-		{0, '@'},
-		{1, 'A'},
-		{2, 'B'},
-		{3, 'C'},
-		{4, 'D'},
-		{5, 'E'},
-		{6, 'F'},
-		{7, 'G'},
-		{8, 'H'},
-		{9, 'I'},
-		{10, 'J'},
-		{11, 'K'},
-		{12, 'L'},
-		{13, 'M'},
-		{14, 'N'},
-		{15, 'O'},
-		{16, 'P'},
-		{17, 'Q'},
-		{18, 'R'},
-		{19, 'S'},
-		{20, 'T'},
-		{21, 'U'},
-		{22, 'V'},
-		{23, 'W'},
-		{24, 'X'},
-		{25, 'Y'},
-		{26, 'Z'},
-		{27, '['},
-		{28, '\\'},
-		{29, ']'},
-		{30, '^'},
-		{31, '_'},
-		{32, ' '},
-		{33, '!'},
-		{34, '\"'},
-		{35, '#'},
-		{36, '$'},
-		{37, '%'},
-		{38, '&'},
-		{39, '\''},
-		{40, '('},
-		{41, ')'},
-		{42, '*'},
-		{43, '+'},
-		{44, ','},
-		{45, '-'},
-		{46, '.'},
-		{47, '/'},
-		{48, '0'},
-		{49, '1'},
-		{50, '2'},
-		{51, '3'},
-		{52, '4'},
-		{53, '5'},
-		{54, '6'},
-		{55, '7'},
-		{56, '8'},
-		{57, '9'},
-		{58, ':'},
-		{59, ';'},
-		{60, '<'},
-		{61, '='},
-		{62, '>'},
-		{63, '?'},
-	};
-	return {SIXBIT_ASCII_TABLE,
-		SIXBIT_ASCII_TABLE + (sizeof(SIXBIT_ASCII_TABLE) / sizeof(sixbit_entry))};
+	std::string s(count_sixbits, '\0');
+	raw::size_type size = 0; // number of characters to keep, if trimmed
+	for (raw::size_type i = 0; i < count_sixbits; i += sixbits_per_read) {
+		const auto n = std::min(sixbits_per_read, count_sixbits - i);
+		const auto word = bits.get<uint64_t>(ofs + i * 6, n * 6);
+		for (raw::size_type j = 0; j < n; ++j) {
+			const char c = sixbit_ascii[(word >> ((n - 1 - j) * 6)) & 0x3f];
+			if (trim) {
+				if (c == '@') {
+					s.resize(size);
+					return s;
+				}
+				if (c != ' ')
+					size = i + j + 1;
+			}
+			s[i + j] = c;
+		}
+	}
+	if (trim)
+		s.resize(size);
+	return s;
 }
 }
 /// @endcond
 
 char decode_sixbit_ascii(uint8_t value)
 {
-	for (const auto p : sixbit_table())
-		if (p.value == value)
-			return p.c;
-	return static_cast<char>(0xff);
+	return (value < 64) ? sixbit_ascii[value] : static_cast<char>(0xff);
 }
 
 uint8_t encode_sixbit_ascii(char c)
 {
-	for (const auto p : sixbit_table())
-		if (p.c == c)
-			return p.value;
-	return 0xffu;
+	return ascii_sixbit[static_cast<uint8_t>(c)];
 }
 
+/// Returns the string up to the first fill character `@`, without trailing spaces.
 std::string trim_ais_string(const std::string & s)
 {
-	return s.substr(0, s.find_first_of("@"));
+	auto n = std::min(s.find('@'), s.size());
+	while ((n > 0) && (s[n - 1] == ' '))
+		--n;
+	return s.substr(0, n);
 }
 
 /// Reads a string from the AIS message at the specified offset.
@@ -134,21 +91,26 @@ std::string trim_ais_string(const std::string & s)
 /// @param[in] ofs The offset at which the string is being read.
 /// @param[in] count_sixbits Number of sixbits to be read.
 /// @return The decoded string.
-///
-/// @todo consider to hide characters after '@'
+/// @exception std::out_of_range The string exceeds the data.
 std::string binary_data::read_string(
-	const raw & bits, raw::size_type ofs, raw::size_type count_sixbits)
+	const raw_view & bits, raw::size_type ofs, raw::size_type count_sixbits)
 {
-	std::string s;
-	s.reserve(count_sixbits);
-
-	for (raw::size_type i = 0; i < count_sixbits; ++i) {
-		uint8_t sixbit = 0;
-		bits.get(sixbit, ofs + i * 6, 6);
-		s += decode_sixbit_ascii(sixbit);
-	}
+	return decode_string(bits, ofs, count_sixbits, false);
+}
 
-	return s;
+/// Reads a string from the AIS message at the specified offset, like `read_string`,
+/// and trims it while decoding, like `trim_ais_string`. The characters after the
+/// first `@` are not decoded.
+///
+/// @param[in] bits The AIS message.
+/// @param[in] ofs The offset at which the string is being read.
+/// @param[in] count_sixbits Maximum number of sixbits to be read.
+/// @return The decoded and trimmed string.
+/// @exception std::out_of_range The string exceeds the data.
+std::string binary_data::read_trimmed_string(
+	const raw_view & bits, raw::size_type ofs, raw::size_type count_sixbits)
+{
+	return decode_string(bits, ofs, count_sixbits, true);
 }
 
 /// Writes the specified string into the AIS message. If the string does not fill
@@ -0,0 +1,129 @@
+#include <marnav/ais/binary_registry.hpp>
+#include <marnav/ais/binary_001_11.hpp>
+#include <marnav/ais/binary_001_22.hpp>
+#include <marnav/ais/binary_001_31.hpp>
+#include <marnav/ais/binary_200_10.hpp>
+#include <marnav/ais/message_06.hpp>
+#include <marnav/ais/message_08.hpp>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+constexpr std::size_t no_index = 2;
+
+/// Returns the index of the tables for the message type, `no_index` if the
+/// message is not a binary message.
+static std::size_t type_index(message_id type) noexcept
+{
+	switch (type) {
+		case message_id::binary_addressed_message:
+			return 0;
+		case message_id::binary_broadcast_message:
+			return 1;
+		default:
+			return no_index;
+	}
+}
+}
+/// @endcond
+
+/// Returns a registry containing all payloads provided by this library, registered
+/// for broadcast messages (type 8).
+binary_registry binary_registry::standard()
+{
+	binary_registry registry;
+	registry.add<binary_001_11>();
+	registry.add<binary_001_22>();
+	registry.add<binary_001_31>();
+	registry.add<binary_200_10>();
+	return registry;
+}
+
+/// Registers the factory for the specified message type, DAC and FID, an already
+/// registered factory is replaced.
+///
+/// @exception std::invalid_argument Not a binary message type, DAC or FID out of range,
+///   or no factory specified.
+void binary_registry::add(message_id type, uint32_t dac, uint32_t fid, factory f)
+{
+	const auto t = type_index(type);
+	if (t == no_index)
+		throw std::invalid_argument{"not a binary message in ais/binary_registry"};
+	if ((dac >= NUM_DAC) || (fid >= NUM_FID))
+		throw std::invalid_argument{"DAC/FID out of range in ais/binary_registry"};
+	if (!f)
+		throw std::invalid_argument{"invalid factory in ais/binary_registry"};
+
+	auto & index = index_[t];
+	if (index[dac] == 0) {
+		tables_.emplace_back();
+		index[dac] = static_cast<uint16_t>(tables_.size());
+	}
+	tables_[index[dac] - 1][fid] = f;
+}
+
+binary_registry::factory binary_registry::find(
+	message_id type, uint32_t dac, uint32_t fid) const noexcept
+{
+	const auto t = type_index(type);
+	if ((t == no_index) || (dac >= NUM_DAC) || (fid >= NUM_FID))
+		return nullptr;
+	const auto i = index_[t][dac];
+	return i ? tables_[i - 1][fid] : nullptr;
+}
+
+/// Returns true if a payload is registered for the specified message type, DAC and FID.
+bool binary_registry::contains(message_id type, uint32_t dac, uint32_t fid) const noexcept
+{
+	return find(type, dac, fid) != nullptr;
+}
+
+/// Returns a default constructed payload for the specified message type, DAC and FID,
+/// or `nullptr` if there is none registered.
+std::unique_ptr<binary_payload> binary_registry::make(
+	message_id type, uint32_t dac, uint32_t fid) const
+{
+	const auto f = find(type, dac, fid);
+	return f ? f() : nullptr;
+}
+
+/// Decodes the payload of a binary message (type 6 or 8).
+///
+/// @param[in] bits The raw data of the entire message.
+/// @return The decoded payload, `nullptr` if there is no payload registered
+///   for the type, DAC and FID of the message.
+/// @exception std::invalid_argument The data is not a binary message, or the
+///   payload is invalid.
+std::unique_ptr<binary_payload> binary_registry::decode(const raw & bits) const
+{
+	if (bits.size() < 6)
+		throw std::invalid_argument{"invalid number of bits in ais/binary_registry"};
+
+	const auto type = static_cast<message_id>(bits.get<uint8_t>(0, 6));
+	std::size_t head = 0;
+	switch (type) {
+		case message_06::ID:
+			head = message_06::SIZE_BITS_HEAD;
+			break;
+		case message_08::ID:
+			head = message_08::SIZE_BITS_HEAD;
+			break;
+		default:
+			throw std::invalid_argument{"not a binary message in ais/binary_registry"};
+	}
+	if (bits.size() < head)
+		throw std::invalid_argument{"invalid number of bits in ais/binary_registry"};
+
+	// DAC and FID are the last fields of the header of both messages
+	const auto dac = bits.get<uint32_t>(head - 16, 10);
+	const auto fid = bits.get<uint32_t>(head - 6, 6);
+
+	auto payload = make(type, dac, fid);
+	if (payload)
+		payload->read_from(raw_view{bits, head, bits.size() - head});
+	return payload;
+}
+}
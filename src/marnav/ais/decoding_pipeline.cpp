@@ -0,0 +1,280 @@
+#include <marnav/ais/decoding_pipeline.hpp>
+#include <marnav/ais/ais.hpp>
+#include "../utils/spsc_queue.hpp"
+#include <chrono>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+/// Waits for work: spins first, then yields the processor, finally sleeps.
+static void backoff(uint32_t idle)
+{
+	if (idle < 64)
+		return;
+	if (idle < 1024) {
+		std::this_thread::yield();
+		return;
+	}
+	std::this_thread::sleep_for(std::chrono::microseconds{50});
+}
+}
+/// @endcond
+
+/// Element of the queue, a message either as raw data or as NMEA payloads. The
+/// elements are reused, the strings keep their capacity.
+struct decoding_pipeline::entry {
+	raw bits;
+	std::vector<std::pair<std::string, uint32_t>> payload;
+	std::size_t fragments = 0; ///< Number of valid payloads, zero if `bits` is used.
+};
+
+/// Queue and counters of one shard. The counters `messages` and `dropped` are
+/// written by the producer, `decoded`, `failed` and `handler_failed` by the worker. A message is
+/// counted before it is published, the number of processed messages therefore
+/// never exceeds the number of messages.
+struct decoding_pipeline::shard {
+	shard(std::size_t i, std::size_t capacity)
+		: index(i)
+		, queue(capacity)
+	{
+	}
+
+	const std::size_t index;
+	utils::detail::spsc_queue<entry> queue;
+
+	std::atomic<uint64_t> messages{0};
+	std::atomic<uint64_t> dropped{0};
+
+	alignas(64) raw bits; // decoded payloads, used by the worker only
+	std::atomic<uint64_t> decoded{0};
+	std::atomic<uint64_t> failed{0};
+	std::atomic<uint64_t> handler_failed{0};
+
+	uint64_t done() const noexcept
+	{
+		return decoded.load(std::memory_order_acquire) + failed.load(std::memory_order_acquire)
+			+ handler_failed.load(std::memory_order_acquire);
+	}
+};
+
+/// Starts one worker thread per shard.
+///
+/// @param[in] shards Number of shards, i.e. worker threads.
+/// @param[in] h The handler of the decoded messages.
+/// @param[in] queue_capacity Number of messages per shard, rounded up to a power of two.
+/// @param[in] policy Behaviour if the queue of a shard is full.
+/// @exception std::invalid_argument Number of shards or queue capacity is zero,
+///   or the handler is empty.
+decoding_pipeline::decoding_pipeline(
+	std::size_t shards, handler h, std::size_t queue_capacity, overflow policy)
+	: handler_(std::move(h))
+	, policy_(policy)
+{
+	if (shards == 0)
+		throw std::invalid_argument{"invalid number of shards in ais/decoding_pipeline"};
+	if (queue_capacity == 0)
+		throw std::invalid_argument{"invalid queue capacity in ais/decoding_pipeline"};
+	if (!handler_)
+		throw std::invalid_argument{"invalid handler in ais/decoding_pipeline"};
+
+	shards_.reserve(shards);
+	for (std::size_t i = 0; i < shards; ++i)
+		shards_.push_back(std::make_unique<shard>(i, queue_capacity));
+
+	workers_.reserve(shards);
+	try {
+		for (auto & s : shards_)
+			workers_.emplace_back(&decoding_pipeline::run, this, std::ref(*s));
+	} catch (...) {
+		stop_.store(true, std::memory_order_release);
+		for (auto & w : workers_)
+			w.join();
+		throw;
+	}
+}
+
+/// Processes all pushed messages and stops the worker threads.
+decoding_pipeline::~decoding_pipeline()
+{
+	stop_.store(true, std::memory_order_release);
+	for (auto & w : workers_)
+		w.join();
+}
+
+/// Returns the shard which processes the messages of the specified vessel.
+std::size_t decoding_pipeline::shard_of(const utils::mmsi & mmsi) const noexcept
+{
+	// Fibonacci hashing, consecutive MMSIs are spread among the shards
+	const auto h = (uint64_t{static_cast<uint32_t>(mmsi)} * 0x9e3779b97f4a7c15ull) >> 32;
+	return static_cast<std::size_t>(h % shards_.size());
+}
+
+/// Returns the element of the queue of the shard to be written, or `nullptr` if
+/// the message is dropped.
+decoding_pipeline::entry * decoding_pipeline::acquire(shard & s)
+{
+	auto * slot = s.queue.prepare();
+	if (slot)
+		return slot;
+
+	if (policy_ == overflow::drop) {
+		s.dropped.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	do {
+		std::this_thread::yield();
+		slot = s.queue.prepare();
+	} while (!slot);
+	return slot;
+}
+
+/// Pushes the already decoded data of a message into the pipeline.
+///
+/// Must be called by one thread only (the producer).
+///
+/// @param[in] bits The raw data of the message.
+/// @retval true The message was queued.
+/// @retval false The message was dropped, the queue was full.
+/// @exception std::invalid_argument Not enough bits for the message header.
+bool decoding_pipeline::push(const raw & bits)
+{
+	if (bits.size() < message_view::SIZE_BITS_HEAD)
+		throw std::invalid_argument{"invalid number of bits in ais/decoding_pipeline"};
+
+	auto & s = *shards_[shard_of(utils::mmsi{bits.get<uint32_t>(8, 30)})];
+	auto * slot = acquire(s);
+	if (!slot)
+		return false;
+
+	slot->bits = bits;
+	slot->fragments = 0;
+	s.messages.fetch_add(1, std::memory_order_relaxed);
+	s.queue.commit();
+	return true;
+}
+
+/// Pushes the NMEA payloads of a message into the pipeline. The shard is determined
+/// by the header of the first payload, the payloads are copied into the queue of
+/// the shard and decoded by its worker.
+///
+/// Must be called by one thread only (the producer).
+///
+/// @param[in] payload All NMEA payloads of the message, see `nmea::collect_payload`.
+/// @retval true The message was queued.
+/// @retval false The message was dropped, the queue was full.
+/// @exception std::invalid_argument No payload, or the first payload does not contain
+///   the message header. Otherwise invalid payloads (see `append_payload`) are
+///   counted as failed by the worker.
+bool decoding_pipeline::push(const std::vector<std::pair<std::string, uint32_t>> & payload)
+{
+	if (payload.empty())
+		throw std::invalid_argument{"no payload in ais/decoding_pipeline"};
+
+	auto & s = *shards_[shard_of(peek_header(payload.front().first).mmsi)];
+	auto * slot = acquire(s);
+	if (!slot)
+		return false;
+
+	if (slot->payload.size() < payload.size())
+		slot->payload.resize(payload.size());
+	for (std::size_t i = 0; i < payload.size(); ++i) {
+		slot->payload[i].first.assign(payload[i].first);
+		slot->payload[i].second = payload[i].second;
+	}
+	slot->fragments = payload.size();
+	s.messages.fetch_add(1, std::memory_order_relaxed);
+	s.queue.commit();
+	return true;
+}
+
+/// Waits until all pushed messages are processed.
+///
+/// Must be called by the producer.
+void decoding_pipeline::flush() const
+{
+	for (const auto & s : shards_) {
+		while (s->done() < s->messages.load(std::memory_order_relaxed))
+			std::this_thread::yield();
+	}
+}
+
+/// Returns the number of messages of the shard, which are pushed but not yet processed.
+///
+/// @exception std::invalid_argument Invalid shard.
+std::size_t decoding_pipeline::depth(std::size_t index) const
+{
+	if (index >= shards_.size())
+		throw std::invalid_argument{"invalid shard in ais/decoding_pipeline"};
+	const auto & s = *shards_[index];
+	const auto done = s.done();
+	return static_cast<std::size_t>(s.messages.load(std::memory_order_relaxed) - done);
+}
+
+/// Returns the statistics, the sum of all shards.
+decoding_pipeline::statistics decoding_pipeline::get_statistics() const noexcept
+{
+	statistics result;
+	for (const auto & s : shards_) {
+		result.decoded += s->decoded.load(std::memory_order_acquire);
+		result.failed += s->failed.load(std::memory_order_acquire);
+		result.handler_failed += s->handler_failed.load(std::memory_order_acquire);
+		result.messages += s->messages.load(std::memory_order_relaxed);
+		result.dropped += s->dropped.load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
+/// The worker of a shard, processes the queue until the pipeline is stopped
+/// and the queue is empty.
+void decoding_pipeline::run(shard & s)
+{
+	uint32_t idle = 0;
+	for (;;) {
+		const auto * e = s.queue.front();
+		if (!e) {
+			if (stop_.load(std::memory_order_acquire)) {
+				if (!s.queue.front())
+					return;
+				continue;
+			}
+			backoff(idle);
+			if (idle < 1024)
+				++idle;
+			continue;
+		}
+		idle = 0;
+
+		std::unique_ptr<message> m;
+		try {
+			if (e->fragments) {
+				s.bits.clear();
+				for (std::size_t i = 0; i < e->fragments; ++i)
+					append_payload(s.bits, e->payload[i].first, e->payload[i].second);
+				m = make_message(s.bits);
+			} else {
+				m = make_message(e->bits);
+			}
+		} catch (...) {
+			// counted as failed
+		}
+		s.queue.pop();
+
+		if (!m) {
+			s.failed.fetch_add(1, std::memory_order_release);
+			continue;
+		}
+
+		try {
+			handler_(s.index, std::move(m));
+		} catch (...) {
+			s.handler_failed.fetch_add(1, std::memory_order_release);
+			continue;
+		}
+		s.decoded.fetch_add(1, std::memory_order_release);
+	}
+}
+}
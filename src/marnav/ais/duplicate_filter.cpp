@@ -0,0 +1,142 @@
+#include <marnav/ais/duplicate_filter.hpp>
+#include "../utils/fnv.hpp"
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+/// Returns the hash of the raw data, the number of bits, message type and MMSI.
+///
+/// The final mixing (of splitmix64) spreads the bits, the lower bits of the hash
+/// are used as index into the table.
+static uint64_t hash(const raw & bits, uint32_t type, uint32_t mmsi) noexcept
+{
+	const auto n = bits.size();
+	const auto * data = bits.data();
+
+	using utils::detail::fnv1a;
+
+	uint64_t h = utils::detail::fnv_offset_basis;
+	for (std::size_t i = 0; i < n / 8; ++i)
+		h = fnv1a(h, data[i]);
+	if (n % 8)
+		h = fnv1a(h, bits.get<uint8_t>(n - n % 8, n % 8));
+	h = fnv1a(h, n, 2);
+	h = fnv1a(h, type, 1);
+	h = fnv1a(h, mmsi, 4);
+
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+	return h ^ (h >> 31);
+}
+}
+/// @endcond
+
+/// @param[in] capacity Number of messages to be remembered, rounded up to a power of two.
+/// @param[in] window Time a message is remembered after its first arrival.
+/// @exception std::invalid_argument The capacity is zero.
+duplicate_filter::duplicate_filter(std::size_t capacity, clock::duration window)
+	: window_(window)
+{
+	if (capacity == 0)
+		throw std::invalid_argument{"invalid capacity in ais/duplicate_filter"};
+	std::size_t n = max_probe;
+	while (n < capacity)
+		n *= 2;
+	entries_.resize(n);
+}
+
+bool duplicate_filter::expired(const entry & e, clock::time_point now) const noexcept
+{
+	return !e.used || (now - e.first > window_);
+}
+
+/// Returns the index of the entry of the message, or the capacity if there is none.
+std::size_t duplicate_filter::find(
+	uint64_t hash, uint32_t mmsi, clock::time_point now) const noexcept
+{
+	const auto mask = entries_.size() - 1;
+	for (std::size_t i = 0; i < max_probe; ++i) {
+		const auto index = (hash + i) & mask;
+		const auto & e = entries_[index];
+		if (!expired(e, now) && (e.hash == hash) && (e.mmsi == mmsi))
+			return index;
+	}
+	return entries_.size();
+}
+
+/// Processes a message.
+///
+/// @param[in] bits The raw data of the message.
+/// @param[in] receiver The receiver of the message, `0..max_receivers-1`.
+/// @param[in] now Point in time the message was received.
+/// @retval true First arrival of the message, to be processed.
+/// @retval false Duplicate, the message was already seen within the window.
+/// @exception std::invalid_argument Not enough bits for the message header,
+///   or invalid receiver.
+bool duplicate_filter::process(const raw & bits, uint32_t receiver, clock::time_point now)
+{
+	if (receiver >= max_receivers)
+		throw std::invalid_argument{"invalid receiver in ais/duplicate_filter"};
+	if (bits.size() < 38)
+		throw std::invalid_argument{"invalid number of bits in ais/duplicate_filter"};
+
+	++stats_.messages;
+
+	const auto mmsi = bits.get<uint32_t>(8, 30);
+	const auto h = hash(bits, bits.get<uint32_t>(0, 6), mmsi);
+	const auto bit = uint64_t{1} << receiver;
+
+	const auto index = find(h, mmsi, now);
+	if (index < entries_.size()) {
+		entries_[index].receivers |= bit;
+		++stats_.duplicates;
+		return false;
+	}
+
+	// reuse an expired entry, or evict the oldest one
+	const auto mask = entries_.size() - 1;
+	entry * target = nullptr;
+	for (std::size_t i = 0; i < max_probe; ++i) {
+		auto & e = entries_[(h + i) & mask];
+		if (expired(e, now)) {
+			target = &e;
+			break;
+		}
+		if (!target || (e.first < target->first))
+			target = &e;
+	}
+	if (!expired(*target, now))
+		++stats_.evicted;
+
+	target->hash = h;
+	target->mmsi = mmsi;
+	target->used = true;
+	target->first = now;
+	target->receivers = bit;
+	return true;
+}
+
+/// Returns the receivers which received the message within the window, as bit mask
+/// (bit 0: receiver 0). Returns zero if the message is not known.
+///
+/// @exception std::invalid_argument Not enough bits for the message header.
+uint64_t duplicate_filter::receivers(const raw & bits, clock::time_point now) const
+{
+	if (bits.size() < 38)
+		throw std::invalid_argument{"invalid number of bits in ais/duplicate_filter"};
+
+	const auto mmsi = bits.get<uint32_t>(8, 30);
+	const auto index = find(hash(bits, bits.get<uint32_t>(0, 6), mmsi), mmsi, now);
+	return (index < entries_.size()) ? entries_[index].receivers : 0;
+}
+
+/// Forgets all messages, statistics are not affected.
+void duplicate_filter::clear() noexcept
+{
+	for (auto & e : entries_)
+		e.used = false;
+}
+}
@@ -1,5 +1,6 @@
 #include <marnav/ais/message_01.hpp>
 #include <marnav/ais/angle.hpp>
+#include "position_conversions.hpp"
 #include <cmath>
 
 namespace marnav::ais
@@ -27,16 +28,12 @@ message_01::message_01(const raw & bits)
 
 std::optional<geo::longitude> message_01::get_lon() const
 {
-	if (longitude_minutes_ == longitude_not_available)
-		return std::make_optional<geo::longitude>();
-	return to_geo_longitude(longitude_minutes_, longitude_minutes_.count, angle_scale::I4);
+	return detail::make_lon(longitude_minutes_);
 }
 
 std::optional<geo::latitude> message_01::get_lat() const
 {
-	if (latitude_minutes_ == latitude_not_available)
-		return std::make_optional<geo::latitude>();
-	return to_geo_latitude(latitude_minutes_, latitude_minutes_.count, angle_scale::I4);
+	return detail::make_lat(latitude_minutes_);
 }
 
 void message_01::set_lon_unavailable()
@@ -61,11 +58,7 @@ void message_01::set_lat(const geo::latitude & t)
 
 std::optional<units::knots> message_01::get_sog() const noexcept
 {
-	// ignores special value of 1022 = 102.2 knots or faster
-
-	if (sog_ == sog_not_available)
-		return {};
-	return units::knots{0.1 * sog_};
+	return detail::make_sog(sog_);
 }
 
 void message_01::set_sog_unavailable()
@@ -85,9 +78,7 @@ void message_01::set_sog(units::velocity t)
 /// Returns course over ground in degrees true north.
 std::optional<double> message_01::get_cog() const noexcept
 {
-	if (cog_ == cog_not_available)
-		return {};
-	return 0.1 * cog_;
+	return detail::make_cog(cog_);
 }
 
 void message_01::set_cog(std::optional<double> t) noexcept
@@ -98,9 +89,7 @@ void message_01::set_cog(std::optional<double> t) noexcept
 /// Returns heading in degrees.
 std::optional<uint32_t> message_01::get_hdg() const noexcept
 {
-	if (hdg_ == hdg_not_available)
-		return {};
-	return {hdg_};
+	return detail::make_hdg(hdg_);
 }
 
 void message_01::set_hdg(std::optional<uint32_t> t) noexcept
@@ -120,20 +109,10 @@ void message_01::set_rot(rate_of_turn t) noexcept
 
 void message_01::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, nav_status_);
-	get(bits, rot_);
-	get(bits, sog_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, cog_);
-	get(bits, hdg_);
-	get(bits, timestamp_);
-	get(bits, maneuver_indicator_);
-	get(bits, raim_);
-	get(bits, radio_status_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_01");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_01::get_data() const
@@ -141,21 +120,52 @@ raw message_01::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, nav_status_);
-	set(bits, rot_);
-	set(bits, sog_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, cog_);
-	set(bits, hdg_);
-	set(bits, timestamp_);
-	set(bits, maneuver_indicator_);
-	set(bits, raim_);
-	set(bits, radio_status_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
+
+/// @exception std::invalid_argument The data is not a position report class A
+///   (message type 1, 2 or 3), or has the wrong number of bits.
+message_01::view::view(const raw_view & bits)
+	: message_view(bits)
+{
+	const auto id = type();
+	if ((id != message_id::position_report_class_a)
+		&& (id != message_id::position_report_class_a_assigned_schedule)
+		&& (id != message_id::position_report_class_a_response_to_interrogation))
+		throw std::invalid_argument{"invalid message type in ais/message_01::view"};
+	if (bits.size() != SIZE_BITS)
+		throw std::invalid_argument{"invalid number of bits in ais/message_01::view"};
+}
+
+rate_of_turn message_01::view::get_rot() const
+{
+	return rate_of_turn(field<decltype(rot_)>());
+}
+
+std::optional<units::knots> message_01::view::get_sog() const
+{
+	return detail::make_sog(field<decltype(sog_)>());
+}
+
+std::optional<double> message_01::view::get_cog() const
+{
+	return detail::make_cog(field<decltype(cog_)>());
+}
+
+std::optional<uint32_t> message_01::view::get_hdg() const
+{
+	return detail::make_hdg(field<decltype(hdg_)>());
+}
+
+std::optional<geo::longitude> message_01::view::get_lon() const
+{
+	return detail::make_lon(field<decltype(longitude_minutes_)>());
+}
+
+std::optional<geo::latitude> message_01::view::get_lat() const
+{
+	return detail::make_lat(field<decltype(latitude_minutes_)>());
+}
 }
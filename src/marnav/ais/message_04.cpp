@@ -31,20 +31,10 @@ message_04::message_04(const raw & bits)
 
 void message_04::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, year_);
-	get(bits, month_);
-	get(bits, day_);
-	get(bits, hour_);
-	get(bits, minute_);
-	get(bits, second_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, epfd_fix_);
-	get(bits, raim_);
-	get(bits, radio_status_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_04");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_04::get_data() const
@@ -52,20 +42,7 @@ raw message_04::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, year_);
-	set(bits, month_);
-	set(bits, day_);
-	set(bits, hour_);
-	set(bits, minute_);
-	set(bits, second_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, epfd_fix_);
-	set(bits, raim_);
-	set(bits, radio_status_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
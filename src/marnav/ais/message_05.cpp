@@ -34,24 +34,10 @@ message_05::message_05(const raw & bits)
 
 void message_05::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, ais_version_);
-	get(bits, imo_number_);
-	get(bits, callsign_);
-	get(bits, shipname_);
-	get(bits, shiptype_);
-	get(bits, to_bow_);
-	get(bits, to_stern_);
-	get(bits, to_port_);
-	get(bits, to_starboard_);
-	get(bits, epfd_fix_);
-	get(bits, eta_month_);
-	get(bits, eta_day_);
-	get(bits, eta_hour_);
-	get(bits, eta_minute_);
-	get(bits, draught_);
-	get(bits, destination_);
+	using layout = decltype(std::tuple_cat(fields(*this), std::tie(dte_)));
+	static_assert(is_valid_layout<layout>(6, SIZE_BITS), "invalid layout of message_05");
+
+	get_fields(bits, fields(*this));
 
 	if (bits.size() > SIZE_BITS_MIN)
 		get(bits, dte_);
@@ -62,24 +48,7 @@ raw message_05::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, ais_version_);
-	set(bits, imo_number_);
-	set(bits, callsign_);
-	set(bits, shipname_);
-	set(bits, shiptype_);
-	set(bits, to_bow_);
-	set(bits, to_stern_);
-	set(bits, to_port_);
-	set(bits, to_starboard_);
-	set(bits, epfd_fix_);
-	set(bits, eta_month_);
-	set(bits, eta_day_);
-	set(bits, eta_hour_);
-	set(bits, eta_minute_);
-	set(bits, draught_);
-	set(bits, destination_);
+	set_fields(bits, fields(*this));
 	set(bits, dte_);
 
 	return bits;
@@ -151,4 +120,51 @@ void message_05::set_draught(units::length t)
 		throw std::invalid_argument{"length less than zero"};
 	draught_ = math::float_cast<uint32_t>(ceil((10.0 * t).get<units::meters>()).value());
 }
+
+/// @exception std::invalid_argument The data is not static and voyage related data,
+///   or has the wrong number of bits.
+message_05::view::view(const raw_view & bits)
+	: message_view(bits)
+{
+	if (type() != ID)
+		throw std::invalid_argument{"invalid message type in ais/message_05::view"};
+	if ((bits.size() < SIZE_BITS_MIN) || (bits.size() > SIZE_BITS))
+		throw std::invalid_argument{"invalid number of bits in ais/message_05::view"};
+}
+
+std::string message_05::view::get_callsign() const
+{
+	using field_type = decltype(callsign_);
+	return read_trimmed_string(get_raw(), field_type::offset, field_type::count);
+}
+
+std::string message_05::view::get_shipname() const
+{
+	using field_type = decltype(shipname_);
+	return read_trimmed_string(get_raw(), field_type::offset, field_type::count);
+}
+
+std::string message_05::view::get_destination() const
+{
+	using field_type = decltype(destination_);
+	return read_trimmed_string(get_raw(), field_type::offset, field_type::count);
+}
+
+vessel_dimension message_05::view::get_vessel_dimension() const
+{
+	return {field<decltype(to_bow_)>(), field<decltype(to_stern_)>(),
+		field<decltype(to_port_)>(), field<decltype(to_starboard_)>()};
+}
+
+units::meters message_05::view::get_draught() const
+{
+	return units::meters{0.1 * field<decltype(draught_)>().as<units::meters::value_type>()};
+}
+
+data_terminal message_05::view::get_dte() const
+{
+	if (get_raw().size() <= SIZE_BITS_MIN)
+		return data_terminal::not_ready;
+	return field<decltype(dte_)>();
+}
 }
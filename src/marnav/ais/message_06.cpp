@@ -1,4 +1,5 @@
 #include <marnav/ais/message_06.hpp>
+#include <marnav/ais/binary_payload.hpp>
 
 namespace marnav::ais
 {
@@ -21,13 +22,10 @@ message_06::message_06(const raw & bits)
 
 void message_06::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, sequence_no_);
-	get(bits, dest_mmsi_);
-	get(bits, retransmit_flag_);
-	get(bits, dac_);
-	get(bits, fid_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_HEAD),
+		"invalid layout of message_06");
+
+	get_fields(bits, fields(*this));
 
 	payload_ = raw{bits.begin() + SIZE_BITS_HEAD, bits.end()};
 }
@@ -37,16 +35,30 @@ raw message_06::get_data() const
 	raw bits(SIZE_BITS_HEAD);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, sequence_no_);
-	set(bits, dest_mmsi_);
-	set(bits, retransmit_flag_);
-	set(bits, dac_);
-	set(bits, fid_);
+	set_fields(bits, fields(*this));
 
 	bits.append(payload_);
 
 	return bits;
 }
+
+/// Reads the payload into the specified application specific message.
+///
+/// @exception std::invalid_argument DAC/FID of the message do not match the
+///   DAC/FID of the payload, or the payload is invalid.
+void message_06::read_binary(binary_payload & m) const
+{
+	if (std::make_tuple(m.get_dac(), m.get_fid()) != std::tie(dac_, fid_))
+		throw std::invalid_argument{"invalid DAC/FID for binary payload in ais/message_06"};
+	m.read_from(payload_);
+}
+
+/// Writes the application specific message as payload, DAC and FID are set
+/// accordingly.
+void message_06::write_binary(const binary_payload & m)
+{
+	m.write_to(payload_);
+	dac_ = m.get_dac();
+	fid_ = m.get_fid();
+}
 }
@@ -21,45 +21,33 @@ message_07::message_07(const raw & bits)
 
 void message_07::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, mmsi_1_);
-	get(bits, mmsi_seq_1_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_MIN),
+		"invalid layout of message_07");
+	using layout = decltype(
+		std::tuple_cat(fields(*this), fields_2(*this), fields_3(*this), fields_4(*this)));
+	static_assert(is_valid_layout<layout>(6, SIZE_BITS_MAX), "invalid layout of message_07");
 
-	if (bits.size() > SIZE_BITS_MIN + 1 * 32) {
-		get(bits, mmsi_2_);
-		get(bits, mmsi_seq_2_);
-	}
-	if (bits.size() > SIZE_BITS_MIN + 2 * 32) {
-		get(bits, mmsi_3_);
-		get(bits, mmsi_seq_3_);
-	}
-	if (bits.size() > SIZE_BITS_MIN + 3 * 32) {
-		get(bits, mmsi_4_);
-		get(bits, mmsi_seq_4_);
-	}
+	get_fields(bits, fields(*this));
+
+	if (bits.size() > SIZE_BITS_MIN + 1 * 32)
+		get_fields(bits, fields_2(*this));
+	if (bits.size() > SIZE_BITS_MIN + 2 * 32)
+		get_fields(bits, fields_3(*this));
+	if (bits.size() > SIZE_BITS_MIN + 3 * 32)
+		get_fields(bits, fields_4(*this));
 }
 
 raw message_07::get_data() const
 {
 	raw bits(SIZE_BITS_MIN);
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, mmsi_1_);
-	set(bits, mmsi_seq_1_);
-	if (mmsi_2_ != 0) {
-		set(bits, mmsi_2_);
-		set(bits, mmsi_seq_2_);
-	}
-	if (mmsi_3_ != 0) {
-		set(bits, mmsi_3_);
-		set(bits, mmsi_seq_3_);
-	}
-	if (mmsi_4_ != 0) {
-		set(bits, mmsi_4_);
-		set(bits, mmsi_seq_4_);
-	}
+	set_fields(bits, fields(*this));
+	if (mmsi_2_ != 0)
+		set_fields(bits, fields_2(*this));
+	if (mmsi_3_ != 0)
+		set_fields(bits, fields_3(*this));
+	if (mmsi_4_ != 0)
+		set_fields(bits, fields_4(*this));
 	return bits;
 }
 }
@@ -1,6 +1,5 @@
 #include <marnav/ais/message_08.hpp>
-#include <marnav/ais/binary_001_11.hpp>
-#include <marnav/ais/binary_200_10.hpp>
+#include <marnav/ais/binary_payload.hpp>
 
 namespace marnav::ais
 {
@@ -23,10 +22,10 @@ message_08::message_08(const raw & bits)
 
 void message_08::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, dac_);
-	get(bits, fid_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_HEAD),
+		"invalid layout of message_08");
+
+	get_fields(bits, fields(*this));
 
 	payload_ = raw{bits.begin() + SIZE_BITS_HEAD, bits.end()};
 }
@@ -36,38 +35,30 @@ raw message_08::get_data() const
 	raw bits(SIZE_BITS_HEAD);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, dac_);
-	set(bits, fid_);
+	set_fields(bits, fields(*this));
 
 	bits.append(payload_);
 
 	return bits;
 }
 
-void message_08::read_binary(binary_001_11 & m) const
-{
-	if (std::make_tuple(1, 11) != std::tie(dac_, fid_))
-		throw std::invalid_argument{"invalid DAC/FID for Meteo/Hydro IMO236"};
-	m.read_from(payload_);
-}
-
-void message_08::write_binary(const binary_001_11 & m)
-{
-	m.write_to(payload_);
-}
-
-void message_08::read_binary(binary_200_10 & m) const
+/// Reads the payload into the specified application specific message.
+///
+/// @exception std::invalid_argument DAC/FID of the message do not match the
+///   DAC/FID of the payload, or the payload is invalid.
+void message_08::read_binary(binary_payload & m) const
 {
-	if (std::make_tuple(200, 10) != std::tie(dac_, fid_))
-		throw std::invalid_argument{
-			"invalid DAC/FID for Inland ship static voyage related data"};
+	if (std::make_tuple(m.get_dac(), m.get_fid()) != std::tie(dac_, fid_))
+		throw std::invalid_argument{"invalid DAC/FID for binary payload in ais/message_08"};
 	m.read_from(payload_);
 }
 
-void message_08::write_binary(const binary_200_10 & m)
+/// Writes the application specific message as payload, DAC and FID are set
+/// accordingly.
+void message_08::write_binary(const binary_payload & m)
 {
 	m.write_to(payload_);
+	dac_ = m.get_dac();
+	fid_ = m.get_fid();
 }
 }
@@ -24,20 +24,10 @@ message_09::message_09(const raw & bits)
 
 void message_09::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, altitude_);
-	get(bits, speed_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, course_);
-	get(bits, utc_second_);
-	get(bits, reserved_);
-	get(bits, dte_);
-	get(bits, assigned_);
-	get(bits, raim_);
-	get(bits, radio_status_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_09");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_09::get_data() const
@@ -45,20 +35,7 @@ raw message_09::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, altitude_);
-	set(bits, speed_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, course_);
-	set(bits, utc_second_);
-	set(bits, reserved_);
-	set(bits, dte_);
-	set(bits, assigned_);
-	set(bits, raim_);
-	set(bits, radio_status_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
@@ -21,9 +21,10 @@ message_10::message_10(const raw & bits)
 
 void message_10::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, dest_mmsi_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_10");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_10::get_data() const
@@ -31,9 +32,7 @@ raw message_10::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, dest_mmsi_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
@@ -22,8 +22,10 @@ message_14::message_14(const raw & bits)
 
 void message_14::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_HEAD),
+		"invalid layout of message_14");
+
+	get_fields(bits, fields(*this));
 
 	auto rest = bits.size() - SIZE_BITS_HEAD;
 	if (rest > 0) {
@@ -37,8 +39,7 @@ raw message_14::get_data() const
 	raw bits(SIZE_BITS_HEAD);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
+	set_fields(bits, fields(*this));
 
 	if (text_.size() > 0) {
 		// compute number of bits, must be on a 8-bit boundary
@@ -29,10 +29,10 @@ message_17::message_17(const raw & bits)
 
 void message_17::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_MIN),
+		"invalid layout of message_17");
+
+	get_fields(bits, fields(*this));
 
 	payload_ = raw{bits.begin() + SIZE_BITS_MIN, bits.end()};
 }
@@ -42,10 +42,7 @@ raw message_17::get_data() const
 	raw bits(SIZE_BITS_MIN);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
+	set_fields(bits, fields(*this));
 
 	bits.append(payload_);
 
@@ -1,5 +1,6 @@
 #include <marnav/ais/message_18.hpp>
 #include <marnav/ais/angle.hpp>
+#include "position_conversions.hpp"
 #include <cmath>
 
 namespace marnav::ais
@@ -27,23 +28,10 @@ message_18::message_18(const raw & bits)
 
 void message_18::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, sog_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, cog_);
-	get(bits, hdg_);
-	get(bits, timestamp_);
-	get(bits, cs_unit_);
-	get(bits, display_flag_);
-	get(bits, dsc_flag_);
-	get(bits, band_flag_);
-	get(bits, message_22_flag_);
-	get(bits, assigned_);
-	get(bits, raim_);
-	get(bits, radio_status_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_18");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_18::get_data() const
@@ -51,39 +39,19 @@ raw message_18::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, sog_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, cog_);
-	set(bits, hdg_);
-	set(bits, timestamp_);
-	set(bits, cs_unit_);
-	set(bits, display_flag_);
-	set(bits, dsc_flag_);
-	set(bits, band_flag_);
-	set(bits, message_22_flag_);
-	set(bits, assigned_);
-	set(bits, raim_);
-	set(bits, radio_status_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
 
 std::optional<geo::longitude> message_18::get_lon() const
 {
-	if (longitude_minutes_ == longitude_not_available)
-		return std::make_optional<geo::longitude>();
-	return to_geo_longitude(longitude_minutes_, longitude_minutes_.count, angle_scale::I4);
+	return detail::make_lon(longitude_minutes_);
 }
 
 std::optional<geo::latitude> message_18::get_lat() const
 {
-	if (latitude_minutes_ == latitude_not_available)
-		return std::make_optional<geo::latitude>();
-	return to_geo_latitude(latitude_minutes_, latitude_minutes_.count, angle_scale::I4);
+	return detail::make_lat(latitude_minutes_);
 }
 
 void message_18::set_lon_unavailable()
@@ -108,11 +76,7 @@ void message_18::set_lat(const geo::latitude & t)
 
 std::optional<units::knots> message_18::get_sog() const noexcept
 {
-	// ignores special value of 1022 = 102.2 knots or faster
-
-	if (sog_ == sog_not_available)
-		return {};
-	return units::knots{0.1 * sog_};
+	return detail::make_sog(sog_);
 }
 
 void message_18::set_sog_unavailable()
@@ -132,9 +96,7 @@ void message_18::set_sog(units::velocity t)
 /// Returns course over ground in degrees true north.
 std::optional<double> message_18::get_cog() const noexcept
 {
-	if (cog_ == cog_not_available)
-		return {};
-	return 0.1 * cog_;
+	return detail::make_cog(cog_);
 }
 
 void message_18::set_cog(std::optional<double> t) noexcept
@@ -145,13 +107,47 @@ void message_18::set_cog(std::optional<double> t) noexcept
 /// Returns heading in degrees.
 std::optional<uint32_t> message_18::get_hdg() const noexcept
 {
-	if (hdg_ == hdg_not_available)
-		return {};
-	return {hdg_};
+	return detail::make_hdg(hdg_);
 }
 
 void message_18::set_hdg(std::optional<uint32_t> t) noexcept
 {
 	hdg_ = !t ? hdg_not_available : *t;
 }
+
+/// @exception std::invalid_argument The data is not a standard class B CS position
+///   report, or has the wrong number of bits.
+message_18::view::view(const raw_view & bits)
+	: message_view(bits)
+{
+	if (type() != ID)
+		throw std::invalid_argument{"invalid message type in ais/message_18::view"};
+	if (bits.size() != SIZE_BITS)
+		throw std::invalid_argument{"invalid number of bits in ais/message_18::view"};
+}
+
+std::optional<units::knots> message_18::view::get_sog() const
+{
+	return detail::make_sog(field<decltype(sog_)>());
+}
+
+std::optional<double> message_18::view::get_cog() const
+{
+	return detail::make_cog(field<decltype(cog_)>());
+}
+
+std::optional<uint32_t> message_18::view::get_hdg() const
+{
+	return detail::make_hdg(field<decltype(hdg_)>());
+}
+
+std::optional<geo::longitude> message_18::view::get_lon() const
+{
+	return detail::make_lon(field<decltype(longitude_minutes_)>());
+}
+
+std::optional<geo::latitude> message_18::view::get_lat() const
+{
+	return detail::make_lat(field<decltype(latitude_minutes_)>());
+}
 }
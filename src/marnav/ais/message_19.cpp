@@ -27,25 +27,10 @@ message_19::message_19(const raw & bits)
 
 void message_19::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, sog_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, cog_);
-	get(bits, hdg_);
-	get(bits, timestamp_);
-	get(bits, shipname_);
-	get(bits, shiptype_);
-	get(bits, to_bow_);
-	get(bits, to_stern_);
-	get(bits, to_port_);
-	get(bits, to_starboard_);
-	get(bits, epfd_fix_);
-	get(bits, raim_);
-	get(bits, dte_);
-	get(bits, assigned_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_19");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_19::get_data() const
@@ -53,25 +38,7 @@ raw message_19::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, sog_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, cog_);
-	set(bits, hdg_);
-	set(bits, timestamp_);
-	set(bits, shipname_);
-	set(bits, shiptype_);
-	set(bits, to_bow_);
-	set(bits, to_stern_);
-	set(bits, to_port_);
-	set(bits, to_starboard_);
-	set(bits, epfd_fix_);
-	set(bits, raim_);
-	set(bits, dte_);
-	set(bits, assigned_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
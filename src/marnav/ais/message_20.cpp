@@ -22,61 +22,33 @@ message_20::message_20(const raw & bits)
 
 void message_20::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, offset_number_1_);
-	get(bits, reserved_slots_1_);
-	get(bits, timeout_1_);
-	get(bits, increment_1_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_MIN),
+		"invalid layout of message_20");
+	using layout = decltype(
+		std::tuple_cat(fields(*this), fields_2(*this), fields_3(*this), fields_4(*this)));
+	static_assert(is_valid_layout<layout>(6, SIZE_BITS_MAX), "invalid layout of message_20");
 
-	if (bits.size() > SIZE_BITS_MIN + 1 * 30) {
-		get(bits, offset_number_2_);
-		get(bits, reserved_slots_2_);
-		get(bits, timeout_2_);
-		get(bits, increment_2_);
-	}
-	if (bits.size() > SIZE_BITS_MIN + 2 * 30) {
-		get(bits, offset_number_3_);
-		get(bits, reserved_slots_3_);
-		get(bits, timeout_3_);
-		get(bits, increment_3_);
-	}
-	if (bits.size() > SIZE_BITS_MIN + 3 * 30) {
-		get(bits, offset_number_4_);
-		get(bits, reserved_slots_4_);
-		get(bits, timeout_4_);
-		get(bits, increment_4_);
-	}
+	get_fields(bits, fields(*this));
+
+	if (bits.size() > SIZE_BITS_MIN + 1 * 30)
+		get_fields(bits, fields_2(*this));
+	if (bits.size() > SIZE_BITS_MIN + 2 * 30)
+		get_fields(bits, fields_3(*this));
+	if (bits.size() > SIZE_BITS_MIN + 3 * 30)
+		get_fields(bits, fields_4(*this));
 }
 
 raw message_20::get_data() const
 {
 	raw bits(SIZE_BITS_MIN);
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, offset_number_1_);
-	set(bits, reserved_slots_1_);
-	set(bits, timeout_1_);
-	set(bits, increment_1_);
-	if (offset_number_2_ != 0) {
-		set(bits, offset_number_2_);
-		set(bits, reserved_slots_2_);
-		set(bits, timeout_2_);
-		set(bits, increment_2_);
-	}
-	if (offset_number_3_ != 0) {
-		set(bits, offset_number_3_);
-		set(bits, reserved_slots_3_);
-		set(bits, timeout_3_);
-		set(bits, increment_3_);
-	}
-	if (offset_number_4_ != 0) {
-		set(bits, offset_number_4_);
-		set(bits, reserved_slots_4_);
-		set(bits, timeout_4_);
-		set(bits, increment_4_);
-	}
+	set_fields(bits, fields(*this));
+	if (offset_number_2_ != 0)
+		set_fields(bits, fields_2(*this));
+	if (offset_number_3_ != 0)
+		set_fields(bits, fields_3(*this));
+	if (offset_number_4_ != 0)
+		set_fields(bits, fields_4(*this));
 	return bits;
 }
 
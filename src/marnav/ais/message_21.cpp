@@ -25,24 +25,10 @@ message_21::message_21(const raw & bits)
 
 void message_21::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, aid_type_);
-	get(bits, name_);
-	get(bits, position_accuracy_);
-	get(bits, longitude_minutes_);
-	get(bits, latitude_minutes_);
-	get(bits, to_bow_);
-	get(bits, to_stern_);
-	get(bits, to_port_);
-	get(bits, to_starboard_);
-	get(bits, epfd_fix_);
-	get(bits, utc_second_);
-	get(bits, off_position_);
-	get(bits, regional_);
-	get(bits, raim_);
-	get(bits, virtual_aid_flag_);
-	get(bits, assigned_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS_MIN),
+		"invalid layout of message_21");
+
+	get_fields(bits, fields(*this));
 
 	auto rest = bits.size() - SIZE_BITS_MIN;
 	if (rest > 0) {
@@ -56,24 +42,7 @@ raw message_21::get_data() const
 	raw bits(SIZE_BITS_MIN);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, aid_type_);
-	set(bits, name_);
-	set(bits, position_accuracy_);
-	set(bits, longitude_minutes_);
-	set(bits, latitude_minutes_);
-	set(bits, to_bow_);
-	set(bits, to_stern_);
-	set(bits, to_port_);
-	set(bits, to_starboard_);
-	set(bits, epfd_fix_);
-	set(bits, utc_second_);
-	set(bits, off_position_);
-	set(bits, regional_);
-	set(bits, raim_);
-	set(bits, virtual_aid_flag_);
-	set(bits, assigned_);
+	set_fields(bits, fields(*this));
 
 	if (name_extension_.size() > 0) {
 		// compute number of bits, must be on a 8-bit boundary
@@ -23,26 +23,22 @@ message_22::message_22(const raw & bits)
 
 void message_22::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, channel_a_);
-	get(bits, channel_b_);
-	get(bits, txrx_mode_);
-	get(bits, power_);
-	get(bits, addressed_);
-	get(bits, band_a_);
-	get(bits, band_b_);
-	get(bits, zone_size_);
-
-	if (addressed_) {
-		get(bits, mmsi_1_);
-		get(bits, mmsi_2_);
-	} else {
-		get(bits, ne_lon_);
-		get(bits, ne_lat_);
-		get(bits, sw_lon_);
-		get(bits, sw_lat_);
-	}
+	using layout_broadcast = decltype(
+		std::tuple_cat(fields(*this), fields_broadcast(*this), fields_flags(*this)));
+	using layout_addressed = decltype(
+		std::tuple_cat(fields(*this), fields_addressed(*this), fields_flags(*this)));
+	static_assert(is_valid_layout<layout_broadcast>(6, SIZE_BITS),
+		"invalid layout of message_22");
+	static_assert(is_valid_layout<layout_addressed>(6, SIZE_BITS),
+		"invalid layout of message_22");
+
+	get_fields(bits, fields(*this));
+	get_fields(bits, fields_flags(*this));
+
+	if (addressed_)
+		get_fields(bits, fields_addressed(*this));
+	else
+		get_fields(bits, fields_broadcast(*this));
 }
 
 raw message_22::get_data() const
@@ -50,26 +46,13 @@ raw message_22::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, channel_a_);
-	set(bits, channel_b_);
-	set(bits, txrx_mode_);
-	set(bits, power_);
-	set(bits, addressed_);
-	set(bits, band_a_);
-	set(bits, band_b_);
-	set(bits, zone_size_);
-
-	if (addressed_) {
-		set(bits, mmsi_1_);
-		set(bits, mmsi_2_);
-	} else {
-		set(bits, ne_lon_);
-		set(bits, ne_lat_);
-		set(bits, sw_lon_);
-		set(bits, sw_lat_);
-	}
+	set_fields(bits, fields(*this));
+	set_fields(bits, fields_flags(*this));
+
+	if (addressed_)
+		set_fields(bits, fields_addressed(*this));
+	else
+		set_fields(bits, fields_broadcast(*this));
 
 	return bits;
 }
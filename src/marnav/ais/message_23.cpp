@@ -23,17 +23,10 @@ message_23::message_23(const raw & bits)
 
 void message_23::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, ne_lon_);
-	get(bits, ne_lat_);
-	get(bits, sw_lon_);
-	get(bits, sw_lat_);
-	get(bits, station_type_);
-	get(bits, shiptype_);
-	get(bits, txrx_mode_);
-	get(bits, interval_);
-	get(bits, quiet_time_);
+	static_assert(is_valid_layout<decltype(fields(*this))>(6, SIZE_BITS),
+		"invalid layout of message_23");
+
+	get_fields(bits, fields(*this));
 }
 
 raw message_23::get_data() const
@@ -41,17 +34,7 @@ raw message_23::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, ne_lon_);
-	set(bits, ne_lat_);
-	set(bits, sw_lon_);
-	set(bits, sw_lat_);
-	set(bits, station_type_);
-	set(bits, shiptype_);
-	set(bits, txrx_mode_);
-	set(bits, interval_);
-	set(bits, quiet_time_);
+	set_fields(bits, fields(*this));
 
 	return bits;
 }
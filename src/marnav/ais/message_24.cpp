@@ -39,26 +39,26 @@ bool message_24::is_auxiliary_vessel() const
 
 void message_24::read_data(const raw & bits)
 {
-	get(bits, repeat_indicator_);
-	get(bits, mmsi_);
-	get(bits, part_number_);
+	using layout_part_a = decltype(std::tuple_cat(fields(*this), fields_part_a(*this)));
+	using layout_normal = decltype(
+		std::tuple_cat(fields(*this), fields_part_b(*this), fields_dimension(*this)));
+	using layout_auxiliary = decltype(
+		std::tuple_cat(fields(*this), fields_part_b(*this), fields_mothership(*this)));
+	static_assert(is_valid_layout<layout_part_a>(6, SIZE_BITS), "invalid layout of message_24");
+	static_assert(is_valid_layout<layout_normal>(6, SIZE_BITS), "invalid layout of message_24");
+	static_assert(is_valid_layout<layout_auxiliary>(6, SIZE_BITS),
+		"invalid layout of message_24");
+
+	get_fields(bits, fields(*this));
 
 	if (part_number_ == part::A) {
-		get(bits, shipname_);
+		get_fields(bits, fields_part_a(*this));
 	} else {
-		get(bits, shiptype_);
-		get(bits, vendor_id_);
-		get(bits, model_);
-		get(bits, serial_);
-		get(bits, callsign_);
-		if (is_auxiliary_vessel()) {
-			get(bits, mothership_mmsi_);
-		} else {
-			get(bits, to_bow_);
-			get(bits, to_stern_);
-			get(bits, to_port_);
-			get(bits, to_starboard_);
-		}
+		get_fields(bits, fields_part_b(*this));
+		if (is_auxiliary_vessel())
+			get_fields(bits, fields_mothership(*this));
+		else
+			get_fields(bits, fields_dimension(*this));
 	}
 }
 
@@ -67,26 +67,16 @@ raw message_24::get_data() const
 	raw bits(SIZE_BITS);
 
 	bits.set(type(), 0, 6);
-	set(bits, repeat_indicator_);
-	set(bits, mmsi_);
-	set(bits, part_number_);
+	set_fields(bits, fields(*this));
 
 	if (part_number_ == part::A) {
-		set(bits, shipname_);
+		set_fields(bits, fields_part_a(*this));
 	} else {
-		set(bits, shiptype_);
-		set(bits, vendor_id_);
-		set(bits, model_);
-		set(bits, serial_);
-		set(bits, callsign_);
-		if (is_auxiliary_vessel()) {
-			set(bits, mothership_mmsi_);
-		} else {
-			set(bits, to_bow_);
-			set(bits, to_stern_);
-			set(bits, to_port_);
-			set(bits, to_starboard_);
-		}
+		set_fields(bits, fields_part_b(*this));
+		if (is_auxiliary_vessel())
+			set_fields(bits, fields_mothership(*this));
+		else
+			set_fields(bits, fields_dimension(*this));
 	}
 
 	return bits;
@@ -119,9 +109,9 @@ void message_24::set_shipname(const std::string & t)
 void message_24::set_vendor_id(const std::string & t)
 {
 	if (t.size() > 3) {
-		callsign_ = t.substr(0, 3);
+		vendor_id_ = t.substr(0, 3);
 	} else {
-		callsign_ = t;
+		vendor_id_ = t;
 	}
 }
 
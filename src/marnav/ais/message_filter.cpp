@@ -0,0 +1,43 @@
+#include <marnav/ais/message_filter.hpp>
+#include <algorithm>
+
+namespace marnav::ais
+{
+/// Accepts the specified message type, in addition to the already accepted ones.
+message_filter & message_filter::accept_type(message_id t)
+{
+	types_ |= uint64_t{1} << (static_cast<uint32_t>(t) & 0x3f);
+	return *this;
+}
+
+/// Accepts the specified MMSI, in addition to the already accepted ones.
+message_filter & message_filter::accept_mmsi(const utils::mmsi & t)
+{
+	const uint32_t id = t;
+	const auto i = std::lower_bound(mmsis_.begin(), mmsis_.end(), id);
+	if ((i == mmsis_.end()) || (*i != id))
+		mmsis_.insert(i, id);
+	return *this;
+}
+
+/// Returns true if the message with the specified header passes the filter.
+bool message_filter::accepts(const message_header & h) const noexcept
+{
+	if (types_ && !(types_ & (uint64_t{1} << (static_cast<uint32_t>(h.type) & 0x3f))))
+		return false;
+	if (!mmsis_.empty()
+		&& !std::binary_search(mmsis_.begin(), mmsis_.end(), static_cast<uint32_t>(h.mmsi)))
+		return false;
+	return true;
+}
+
+/// Returns true if the message with the specified payload (first fragment) passes
+/// the filter. Payloads which are too short to contain the header are accepted,
+/// the decision is left to the decoding of the message.
+bool message_filter::accepts(const std::string & payload) const
+{
+	if (accepts_all() || (payload.size() < payload_header_size))
+		return true;
+	return accepts(peek_header(payload));
+}
+}
@@ -0,0 +1,108 @@
+#include <marnav/ais/position_columns.hpp>
+#include "position_report.hpp"
+#include "sign_extend.hpp"
+#include <limits>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+/// Degrees per 1/10000 minute.
+constexpr double degrees_per_unit = 1.0 / (60.0 * 10000.0);
+
+using namespace detail::position_report_layout;
+
+/// Converts angles in 1/10000 minutes, `limit` is the maximum absolute value.
+template <uint32_t Bits>
+static void convert_angles(const uint32_t * minutes, std::size_t n, double * degrees,
+	uint8_t * valid, int32_t limit) noexcept
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto v = detail::sign_extend(minutes[i], Bits);
+		const bool ok = (v >= -limit) & (v <= limit);
+		degrees[i] = ok ? degrees_per_unit * v : nan;
+		valid[i] = ok;
+	}
+}
+
+/// Converts values in 1/10 units, values above `max` are not valid.
+static void convert_tenths(
+	const uint32_t * t, std::size_t n, double * result, uint8_t * valid, uint32_t max) noexcept
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		const bool ok = t[i] <= max;
+		result[i] = ok ? 0.1 * t[i] : nan;
+		valid[i] = ok;
+	}
+}
+}
+/// @endcond
+
+/// Converts latitudes (27 bits, 1/10000 minutes), valid within -90 and +90 degrees.
+void convert_latitudes(
+	const uint32_t * minutes, std::size_t n, double * degrees, uint8_t * valid) noexcept
+{
+	convert_angles<lat_bits>(minutes, n, degrees, valid, 90 * 600000);
+}
+
+/// Converts longitudes (28 bits, 1/10000 minutes), valid within -180 and +180 degrees.
+void convert_longitudes(
+	const uint32_t * minutes, std::size_t n, double * degrees, uint8_t * valid) noexcept
+{
+	convert_angles<lon_bits>(minutes, n, degrees, valid, 180 * 600000);
+}
+
+/// Converts speeds over ground (0.1 knots) to knots. The value of 102.2 knots
+/// means 102.2 knots or more.
+void convert_sog(const uint32_t * sog, std::size_t n, double * knots, uint8_t * valid) noexcept
+{
+	convert_tenths(sog, n, knots, valid, sog_max);
+}
+
+/// Converts courses over ground (0.1 degrees) to degrees.
+void convert_cog(const uint32_t * cog, std::size_t n, double * degrees, uint8_t * valid) noexcept
+{
+	convert_tenths(cog, n, degrees, valid, cog_not_available - 1);
+}
+
+/// Appends the raw values of a position report.
+///
+/// @param[in] bits The raw data of the message.
+/// @retval true The message is a position report, its values are appended.
+/// @retval false The message is not a position report.
+/// @exception std::invalid_argument Invalid number of bits for the message type.
+bool position_columns::append(const raw & bits)
+{
+	detail::position_report_fields f;
+	if (!detail::read_position_report(bits, f))
+		return false;
+
+	mmsi_.push_back(f.mmsi);
+	sog_.push_back(f.sog);
+	lon_.push_back(f.lon);
+	lat_.push_back(f.lat);
+	cog_.push_back(f.cog);
+	return true;
+}
+
+void position_columns::reserve(std::size_t n)
+{
+	mmsi_.reserve(n);
+	lat_.reserve(n);
+	lon_.reserve(n);
+	sog_.reserve(n);
+	cog_.reserve(n);
+}
+
+void position_columns::clear() noexcept
+{
+	mmsi_.clear();
+	lat_.clear();
+	lon_.clear();
+	sog_.clear();
+	cog_.clear();
+}
+}
@@ -0,0 +1,61 @@
+#ifndef MARNAV_AIS_POSITION_CONVERSIONS_HPP
+#define MARNAV_AIS_POSITION_CONVERSIONS_HPP
+
+#include <marnav/ais/angle.hpp>
+#include <marnav/ais/message.hpp>
+#include <marnav/geo/angle.hpp>
+#include <marnav/units/units.hpp>
+#include <optional>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace detail
+{
+// conversions of the raw data of position reports (types 1, 2, 3 and 18),
+// shared by the messages and their views
+
+template <class T>
+std::optional<geo::longitude> make_lon(const T & t)
+{
+	if (t == longitude_not_available)
+		return std::make_optional<geo::longitude>();
+	return to_geo_longitude(t, T::count, angle_scale::I4);
+}
+
+template <class T>
+std::optional<geo::latitude> make_lat(const T & t)
+{
+	if (t == latitude_not_available)
+		return std::make_optional<geo::latitude>();
+	return to_geo_latitude(t, T::count, angle_scale::I4);
+}
+
+inline std::optional<units::knots> make_sog(uint32_t t) noexcept
+{
+	// ignores special value of 1022 = 102.2 knots or faster
+
+	if (t == sog_not_available)
+		return {};
+	return units::knots{0.1 * t};
+}
+
+inline std::optional<double> make_cog(uint32_t t) noexcept
+{
+	if (t == cog_not_available)
+		return {};
+	return 0.1 * t;
+}
+
+inline std::optional<uint32_t> make_hdg(uint32_t t) noexcept
+{
+	if (t == hdg_not_available)
+		return {};
+	return {t};
+}
+}
+/// @endcond
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef MARNAV_AIS_POSITION_REPORT_HPP
+#define MARNAV_AIS_POSITION_REPORT_HPP
+
+#include <marnav/ais/message.hpp>
+#include <stdexcept>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace detail
+{
+/// Layout of the fields common to position reports (types 1, 2, 3, 18 and 19).
+/// The offsets are relative to the speed over ground, which is at a different
+/// offset in messages of class A and class B.
+namespace position_report_layout
+{
+constexpr std::size_t sog_bits = 10;
+constexpr std::size_t lon_offset = 11;
+constexpr std::size_t lon_bits = 28;
+constexpr std::size_t lat_offset = 39;
+constexpr std::size_t lat_bits = 27;
+constexpr std::size_t cog_offset = 66;
+constexpr std::size_t cog_bits = 12;
+constexpr std::size_t rot_offset = 42; // absolute, class A only
+constexpr std::size_t rot_bits = 8;
+}
+
+/// Raw values of a position report, as they are transmitted.
+struct position_report_fields {
+	uint32_t mmsi = 0;
+	uint32_t sog = 0; // 0.1 knots
+	uint32_t lon = 0; // 1/10000 minutes, 28 bits
+	uint32_t lat = 0; // 1/10000 minutes, 27 bits
+	uint32_t cog = 0; // 0.1 degrees
+	bool class_a = false; // the rate of turn is available only for class A
+	uint32_t rot = 0; // raw rate of turn, 8 bits
+};
+
+/// Reads the raw values of a position report, without decoding the message.
+///
+/// @retval true The message is a position report, its values are read.
+/// @retval false The message is not a position report.
+/// @exception std::invalid_argument Invalid number of bits for the message type.
+inline bool read_position_report(const raw & bits, position_report_fields & f)
+{
+	using namespace position_report_layout;
+
+	const message_view header{bits};
+
+	std::size_t ofs = 0; // offset of the speed over ground
+	std::size_t size = 0;
+	switch (header.type()) {
+		case message_id::position_report_class_a:
+		case message_id::position_report_class_a_assigned_schedule:
+		case message_id::position_report_class_a_response_to_interrogation:
+			ofs = 50;
+			size = 168;
+			f.class_a = true;
+			break;
+		case message_id::standard_class_b_cs_position_report:
+			ofs = 46;
+			size = 168;
+			f.class_a = false;
+			break;
+		case message_id::extended_class_b_equipment_position_report:
+			ofs = 46;
+			size = 312;
+			f.class_a = false;
+			break;
+		default:
+			return false;
+	}
+	if (bits.size() != size)
+		throw std::invalid_argument{"invalid number of bits of position report"};
+
+	f.mmsi = bits.get<uint32_t>(8, 30);
+	f.sog = bits.get<uint32_t>(ofs, sog_bits);
+	f.lon = bits.get<uint32_t>(ofs + lon_offset, lon_bits);
+	f.lat = bits.get<uint32_t>(ofs + lat_offset, lat_bits);
+	f.cog = bits.get<uint32_t>(ofs + cog_offset, cog_bits);
+	f.rot = f.class_a ? bits.get<uint32_t>(rot_offset, rot_bits) : 0u;
+	return true;
+}
+}
+/// @endcond
+}
+
+#endif
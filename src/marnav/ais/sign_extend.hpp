@@ -0,0 +1,27 @@
+#ifndef MARNAV_AIS_SIGN_EXTEND_HPP
+#define MARNAV_AIS_SIGN_EXTEND_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace detail
+{
+/// Returns the signed value of the lower `bits` bits (two's complement),
+/// higher bits are ignored.
+constexpr int32_t sign_extend(uint32_t value, std::size_t bits) noexcept
+{
+	const uint32_t sign = 1u << (bits - 1);
+	return static_cast<int32_t>((value & ((sign << 1) - 1)) ^ sign)
+		- static_cast<int32_t>(sign);
+}
+
+static_assert(sign_extend(0x7ffffffu, 27) == -1, "sign_extend");
+static_assert(sign_extend(0x3ffffffu, 27) == 0x3ffffff, "sign_extend");
+}
+/// @endcond
+}
+
+#endif
@@ -0,0 +1,211 @@
+#include <marnav/ais/static_data_cache.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_19.hpp>
+#include <marnav/ais/message_24.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+/// Range of bits holding the static data within a message.
+struct bit_range {
+	std::size_t offset;
+	std::size_t count;
+};
+
+// clang-format off
+constexpr bit_range range_05   = { 40, 230}; // IMO, callsign, shipname, type, dimension
+constexpr bit_range range_19   = {143, 158}; // shipname, type, dimension
+constexpr bit_range range_24_a = { 40, 120}; // shipname
+constexpr bit_range range_24_b = { 40, 122}; // type, vendor, callsign, dimension/mothership
+// clang-format on
+
+static bool operator==(const vessel_dimension & a, const vessel_dimension & b) noexcept
+{
+	return (a.get_to_bow() == b.get_to_bow()) && (a.get_to_stern() == b.get_to_stern())
+		&& (a.get_to_port() == b.get_to_port())
+		&& (a.get_to_starboard() == b.get_to_starboard());
+}
+
+static bool operator==(const static_data & a, const static_data & b) noexcept
+{
+	return (a.shipname == b.shipname) && (a.callsign == b.callsign)
+		&& (a.shiptype == b.shiptype) && (a.dimension == b.dimension)
+		&& (a.imo_number == b.imo_number);
+}
+}
+/// @endcond
+
+/// Updates the static data of the vessel, which sent the message.
+///
+/// The message is decoded only if its static data changed since the last message
+/// of the same kind (type, part) of the vessel.
+///
+/// @param[in] bits The raw data of the message.
+/// @retval true The static data of the vessel changed.
+/// @retval false The data did not change, or the message does not contain static data.
+/// @exception std::invalid_argument Not enough bits for the message type.
+bool static_data_cache::update(const raw & bits)
+{
+	const message_view header{bits};
+
+	source kind;
+	bit_range range;
+	switch (header.type()) {
+		case message_id::static_and_voyage_related_data:
+			kind = source::message_05;
+			range = range_05;
+			break;
+		case message_id::extended_class_b_equipment_position_report:
+			kind = source::message_19;
+			range = range_19;
+			break;
+		case message_id::static_data_report: {
+			if (bits.size() < message_24::SIZE_BITS_IGNORED_SPARES_OF_TYPE_A)
+				throw std::invalid_argument{"invalid number of bits in ais/static_data_cache"};
+			const auto part = bits.get<uint32_t>(38, 2);
+			kind = (part == 0) ? source::message_24_a : source::message_24_b;
+			range = (part == 0) ? range_24_a : range_24_b;
+			break;
+		}
+		default:
+			return false;
+	}
+
+	const auto mmsi = static_cast<uint32_t>(header.get_mmsi());
+	if (mmsi == 0)
+		return false;
+	if (bits.size() < range.offset + range.count)
+		throw std::invalid_argument{"invalid number of bits in ais/static_data_cache"};
+
+	fingerprint fp = {};
+	for (std::size_t i = 0; i * 64 < range.count; ++i)
+		fp[i] = bits.get<uint64_t>(
+			range.offset + i * 64, std::min<std::size_t>(64, range.count - i * 64));
+
+	++stats_.messages;
+
+	const auto mask = static_cast<uint8_t>(1u << static_cast<uint8_t>(kind));
+	const auto i = entries_.find(mmsi);
+	if ((i != entries_.end()) && (i->second.known & mask)
+		&& (i->second.fingerprints[static_cast<std::size_t>(kind)] == fp)) {
+		++stats_.unchanged;
+		return false;
+	}
+
+	// decoded before the entry is modified, may throw
+	const auto m = make_message(bits);
+	++stats_.decoded;
+
+	auto & e = (i != entries_.end()) ? i->second : entries_[mmsi];
+	e.fingerprints[static_cast<std::size_t>(kind)] = fp;
+	e.known |= mask;
+	return merge(*m, e);
+}
+
+/// Updates the static data of the vessel, which sent the already decoded message.
+///
+/// @param[in] m The message.
+/// @retval true The static data of the vessel changed.
+/// @retval false The data did not change, or the message does not contain static data.
+bool static_data_cache::update(const message & m)
+{
+	uint32_t mmsi = 0;
+	source kind;
+	switch (m.type()) {
+		case message_id::static_and_voyage_related_data:
+			mmsi = static_cast<const message_05 &>(m).get_mmsi();
+			kind = source::message_05;
+			break;
+		case message_id::extended_class_b_equipment_position_report:
+			mmsi = static_cast<const message_19 &>(m).get_mmsi();
+			kind = source::message_19;
+			break;
+		case message_id::static_data_report: {
+			const auto & r = static_cast<const message_24 &>(m);
+			mmsi = r.get_mmsi();
+			kind = source::message_24_b;
+			if (r.get_part_number() == message_24::part::A)
+				kind = source::message_24_a;
+			break;
+		}
+		default:
+			return false;
+	}
+	if (mmsi == 0)
+		return false;
+
+	++stats_.messages;
+
+	// the fingerprint of the raw data no longer matches the merged data
+	auto & e = entries_[mmsi];
+	e.known &= static_cast<uint8_t>(~(1u << static_cast<uint8_t>(kind)));
+	return merge(m, e);
+}
+
+/// Merges the static data of the message into the entry.
+bool static_data_cache::merge(const message & m, entry & e)
+{
+	static_data t = e.data;
+	switch (m.type()) {
+		case message_id::static_and_voyage_related_data: {
+			const auto & r = static_cast<const message_05 &>(m);
+			t.mmsi = r.get_mmsi();
+			t.shipname = r.get_shipname();
+			t.callsign = r.get_callsign();
+			t.shiptype = r.get_shiptype();
+			t.dimension = r.get_vessel_dimension();
+			t.imo_number = r.get_imo_number();
+			break;
+		}
+		case message_id::extended_class_b_equipment_position_report: {
+			const auto & r = static_cast<const message_19 &>(m);
+			t.mmsi = r.get_mmsi();
+			t.shipname = trim_ais_string(r.get_shipname());
+			t.shiptype = r.get_shiptype();
+			t.dimension = r.get_vessel_dimension();
+			break;
+		}
+		case message_id::static_data_report: {
+			const auto & r = static_cast<const message_24 &>(m);
+			t.mmsi = r.get_mmsi();
+			if (r.get_part_number() == message_24::part::A) {
+				t.shipname = r.get_shipname();
+			} else {
+				t.callsign = r.get_callsign();
+				t.shiptype = r.get_shiptype();
+				if (!r.is_auxiliary_vessel())
+					t.dimension = r.get_vessel_dimension();
+			}
+			break;
+		}
+		default:
+			return false;
+	}
+
+	if ((e.data.revision != 0) && (t == e.data))
+		return false;
+	t.revision = e.data.revision + 1;
+	e.data = std::move(t);
+	return true;
+}
+
+/// Returns the static data of the vessel, or `nullptr` if there is none.
+///
+/// The pointer is valid until the next call of `update` or `clear`.
+const static_data * static_data_cache::find(const utils::mmsi & mmsi) const
+{
+	const auto i = entries_.find(static_cast<uint32_t>(mmsi));
+	return (i != entries_.end()) ? &i->second.data : nullptr;
+}
+
+/// Removes all vessels, statistics are not affected.
+void static_data_cache::clear()
+{
+	entries_.clear();
+}
+}
@@ -0,0 +1,358 @@
+#include <marnav/ais/track_store.hpp>
+#include <marnav/ais/ais.hpp>
+#include "position_report.hpp"
+#include "sign_extend.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+/// Units (1/10000 minutes) per degree.
+constexpr double units_per_degree = 60.0 * 10000.0;
+
+constexpr double pi = 3.14159265358979323846;
+constexpr double rad_per_deg = pi / 180.0;
+
+constexpr int64_t ms_per_hour = 3600 * 1000;
+
+static int64_t to_milliseconds(track_store::clock::time_point t) noexcept
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+}
+
+static track_store::clock::time_point to_time_point(int64_t ms) noexcept
+{
+	return track_store::clock::time_point{
+		std::chrono::duration_cast<track_store::clock::duration>(std::chrono::milliseconds{ms})};
+}
+
+/// Longitude in the range -180..+180 degrees.
+static double normalize_longitude(double lon) noexcept
+{
+	return std::remainder(lon, 360.0);
+}
+
+/// Below this cosine of the latitude (about 0.06 degrees from the poles) the
+/// longitude is not changed by dead reckoning, the east component would be
+/// amplified beyond any meaning.
+constexpr double min_cos_latitude = 1.0e-3;
+}
+/// @endcond
+
+/// @param[in] depth Maximum number of reports stored per vessel.
+/// @param[in] max_extrapolation Maximum time after the latest report of a vessel,
+///   up to which its position is estimated by dead reckoning.
+/// @exception std::invalid_argument The depth is less than two.
+track_store::track_store(std::size_t depth, clock::duration max_extrapolation)
+	: depth_(depth)
+	, max_extrapolation_(
+		  std::chrono::duration_cast<std::chrono::milliseconds>(max_extrapolation).count())
+{
+	if (depth_ < 2)
+		throw std::invalid_argument{"invalid depth in ais/track_store"};
+}
+
+/// Stores the position report.
+///
+/// The values are read directly from the bits of the message, without decoding
+/// the message.
+///
+/// @param[in] bits The raw data of the message, all but position reports are ignored.
+/// @param[in] t Time of reception of the message.
+/// @retval true The report was stored.
+/// @retval false The message is no position report, contains no valid position,
+///   or is not newer than the latest stored report of the vessel.
+/// @exception std::invalid_argument Invalid number of bits for the message type.
+bool track_store::update(const raw & bits, clock::time_point t)
+{
+	detail::position_report_fields f;
+	if (!detail::read_position_report(bits, f))
+		return false;
+
+	using namespace detail::position_report_layout;
+
+	sample s;
+	s.lat = detail::sign_extend(f.lat, lat_bits);
+	s.lon = detail::sign_extend(f.lon, lon_bits);
+	if ((std::abs(s.lat) > 90 * 600000) || (std::abs(s.lon) > 180 * 600000))
+		return false; // not available or invalid
+	s.sog = static_cast<uint16_t>(f.sog);
+	s.cog = static_cast<uint16_t>(f.cog);
+	s.rot = rate_of_turn::no_information_available;
+	if (f.class_a)
+		s.rot = static_cast<int8_t>(detail::sign_extend(f.rot, rot_bits));
+
+	return append(utils::mmsi{f.mmsi}, to_milliseconds(t), s);
+}
+
+/// Stores the position report, see `update(const raw &, clock::time_point)`.
+bool track_store::update(const message & m, clock::time_point t)
+{
+	switch (m.type()) {
+		case message_id::position_report_class_a:
+		case message_id::position_report_class_a_assigned_schedule:
+		case message_id::position_report_class_a_response_to_interrogation:
+		case message_id::standard_class_b_cs_position_report:
+		case message_id::extended_class_b_equipment_position_report:
+			return update(encode_bits(m), t);
+		default:
+			return false;
+	}
+}
+
+bool track_store::append(const utils::mmsi & id, int64_t t, const sample & s)
+{
+	const auto mmsi = static_cast<uint32_t>(id);
+	auto i = rows_.find(mmsi);
+	if (i == rows_.end()) {
+		i = rows_.emplace(mmsi, mmsi_.size()).first;
+		mmsi_.push_back(mmsi);
+		latest_.push_back(static_cast<uint32_t>(depth_ - 1));
+		count_.push_back(0);
+
+		const auto n = mmsi_.size() * depth_;
+		time_.resize(n);
+		lat_.resize(n);
+		lon_.resize(n);
+		sog_.resize(n);
+		cog_.resize(n);
+		rot_.resize(n);
+	}
+
+	const auto row = i->second;
+	const auto base = row * depth_;
+	if (count_[row] && (t <= time_[base + latest_[row]]))
+		return false;
+
+	const auto slot = (latest_[row] + 1) % depth_;
+	const auto k = base + slot;
+	time_[k] = t;
+	lat_[k] = s.lat;
+	lon_[k] = s.lon;
+	sog_[k] = s.sog;
+	cog_[k] = s.cog;
+	rot_[k] = s.rot;
+
+	latest_[row] = static_cast<uint32_t>(slot);
+	count_[row] = std::min(count_[row] + 1, static_cast<uint32_t>(depth_));
+	return true;
+}
+
+/// Returns the stored reports of the vessel, the oldest first.
+std::vector<track_store::report> track_store::track(const utils::mmsi & mmsi) const
+{
+	const auto i = rows_.find(static_cast<uint32_t>(mmsi));
+	if (i == rows_.end())
+		return {};
+
+	const auto row = i->second;
+	const auto base = row * depth_;
+	std::vector<report> result;
+	result.reserve(count_[row]);
+	for (std::size_t j = count_[row]; j > 0; --j) {
+		const auto k = base + (latest_[row] + depth_ - (j - 1)) % depth_;
+		report r;
+		r.time = to_time_point(time_[k]);
+		r.pos = geo::position{geo::latitude{lat_[k] / units_per_degree},
+			geo::longitude{lon_[k] / units_per_degree}};
+		if (sog_[k] != sog_not_available)
+			r.sog = units::knots{0.1 * sog_[k]};
+		if (cog_[k] < cog_not_available)
+			r.cog = 0.1 * cog_[k];
+		r.rot = rate_of_turn{rot_[k]};
+		result.push_back(r);
+	}
+	return result;
+}
+
+/// Estimates the position of the row at the specified time (milliseconds).
+bool track_store::estimate(std::size_t row, int64_t t, double & lat, double & lon) const
+{
+	const auto n = count_[row];
+	if (n == 0)
+		return false;
+
+	const auto base = row * depth_;
+	auto newer = base + latest_[row];
+
+	if (t >= time_[newer]) {
+		// dead reckoning from the latest report
+		const auto dt = t - time_[newer];
+		if (dt > max_extrapolation_)
+			return false;
+
+		lat = lat_[newer] / units_per_degree;
+		lon = lon_[newer] / units_per_degree;
+		if ((sog_[newer] == sog_not_available) || (cog_[newer] >= cog_not_available))
+			return true;
+
+		const double d = 0.1 * sog_[newer] * dt / ms_per_hour; // nautical miles
+		const double c = 0.1 * cog_[newer] * rad_per_deg;
+
+		double east = d * std::sin(c);
+		double north = d * std::cos(c);
+
+		const rate_of_turn rot{rot_[newer]};
+		if ((dt > 0) && rot.available() && !rot.is_not_turning()
+			&& !rot.is_more_5deg30s_left() && !rot.is_more_5deg30s_right()) {
+			// arc of constant rate of turn, angle turned within dt
+			const double w = rot.value() * rad_per_deg * dt / (60.0 * 1000.0);
+			const double r = d / w;
+			east = r * (std::cos(c) - std::cos(c + w));
+			north = r * (std::sin(c + w) - std::sin(c));
+		}
+
+		lat = std::clamp(lat + north / 60.0, -90.0, 90.0);
+		const double cos_lat = std::cos(lat * rad_per_deg);
+		if (cos_lat > min_cos_latitude)
+			lon = normalize_longitude(lon + east / (60.0 * cos_lat));
+		return std::isfinite(lat) && std::isfinite(lon);
+	}
+
+	// interpolation between the enclosing reports
+	for (std::size_t j = 1; j < n; ++j) {
+		const auto older = base + (latest_[row] + depth_ - j) % depth_;
+		if (t >= time_[older]) {
+			const double f = static_cast<double>(t - time_[older])
+				/ static_cast<double>(time_[newer] - time_[older]);
+
+			int64_t dlon = lon_[newer] - lon_[older];
+			if (dlon > 180 * 600000)
+				dlon -= 360 * 600000;
+			else if (dlon < -180 * 600000)
+				dlon += 360 * 600000;
+
+			lat = (lat_[older] + f * (lat_[newer] - lat_[older])) / units_per_degree;
+			lon = normalize_longitude((lon_[older] + f * dlon) / units_per_degree);
+			return true;
+		}
+		newer = older;
+	}
+	return false;
+}
+
+/// Returns the estimated position of the vessel at the specified time, empty
+/// if the vessel is unknown or the position cannot be estimated.
+std::optional<geo::position> track_store::position_at(
+	const utils::mmsi & mmsi, clock::time_point t) const
+{
+	const auto i = rows_.find(static_cast<uint32_t>(mmsi));
+	if (i == rows_.end())
+		return {};
+
+	double lat = 0.0;
+	double lon = 0.0;
+	if (!estimate(i->second, to_milliseconds(t), lat, lon))
+		return {};
+	return geo::position{geo::latitude{lat}, geo::longitude{lon}};
+}
+
+/// Estimates the positions of all vessels at the specified time.
+///
+/// The output arrays must provide space for `size()` values, in the order of
+/// the rows (see `mmsi`). Positions which cannot be estimated are set to NaN
+/// and marked as invalid (`valid[i] == 0`).
+void track_store::positions_at(
+	clock::time_point t, double * lat, double * lon, uint8_t * valid) const
+{
+	const auto ms = to_milliseconds(t);
+	const auto nan = std::numeric_limits<double>::quiet_NaN();
+	for (std::size_t row = 0; row < mmsi_.size(); ++row) {
+		const bool ok = estimate(row, ms, lat[row], lon[row]);
+		if (!ok) {
+			lat[row] = nan;
+			lon[row] = nan;
+		}
+		valid[row] = ok;
+	}
+}
+
+/// Removes the vessel, the last row takes its place.
+///
+/// @retval true The vessel was removed.
+/// @retval false The vessel is unknown.
+bool track_store::remove(const utils::mmsi & mmsi)
+{
+	const auto i = rows_.find(static_cast<uint32_t>(mmsi));
+	if (i == rows_.end())
+		return false;
+	remove_row(i->second);
+	return true;
+}
+
+/// Removes all vessels whose latest report is older than `max_extrapolation`
+/// at the specified time, i.e. whose positions cannot be estimated anymore.
+///
+/// @param[in] t The current time.
+/// @return The number of removed vessels.
+std::size_t track_store::expire(clock::time_point t)
+{
+	const auto ms = to_milliseconds(t);
+	std::size_t removed = 0;
+	for (std::size_t row = 0; row < mmsi_.size();) {
+		if (ms - time_[row * depth_ + latest_[row]] > max_extrapolation_) {
+			remove_row(row); // the last row was moved here
+			++removed;
+		} else {
+			++row;
+		}
+	}
+	return removed;
+}
+
+/// Removes the row, the last row is moved into its place.
+void track_store::remove_row(std::size_t row)
+{
+	rows_.erase(mmsi_[row]);
+
+	const auto last = mmsi_.size() - 1;
+	if (row != last) {
+		const auto move_reports = [this, row, last](auto & v) {
+			for (std::size_t j = 0; j < depth_; ++j)
+				v[row * depth_ + j] = v[last * depth_ + j];
+		};
+		move_reports(time_);
+		move_reports(lat_);
+		move_reports(lon_);
+		move_reports(sog_);
+		move_reports(cog_);
+		move_reports(rot_);
+
+		mmsi_[row] = mmsi_[last];
+		latest_[row] = latest_[last];
+		count_[row] = count_[last];
+		rows_[mmsi_[row]] = row;
+	}
+
+	mmsi_.pop_back();
+	latest_.pop_back();
+	count_.pop_back();
+
+	const auto n = mmsi_.size() * depth_;
+	time_.resize(n);
+	lat_.resize(n);
+	lon_.resize(n);
+	sog_.resize(n);
+	cog_.resize(n);
+	rot_.resize(n);
+}
+
+void track_store::clear() noexcept
+{
+	rows_.clear();
+	mmsi_.clear();
+	latest_.clear();
+	count_.clear();
+	time_.clear();
+	lat_.clear();
+	lon_.clear();
+	sog_.clear();
+	cog_.clear();
+	rot_.clear();
+}
+}
@@ -0,0 +1,477 @@
+#include <marnav/ais/vessel_table.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_18.hpp>
+#include <marnav/ais/message_19.hpp>
+#include <marnav/ais/message_24.hpp>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace marnav::ais
+{
+/// @cond DEV
+namespace
+{
+constexpr double not_available = std::numeric_limits<double>::quiet_NaN();
+
+static double to_double(const std::optional<double> & t) noexcept
+{
+	return t ? *t : not_available;
+}
+
+static std::optional<double> to_optional(double t) noexcept
+{
+	return std::isnan(t) ? std::optional<double>{} : std::optional<double>{t};
+}
+
+static std::optional<double> course(const message_01 & m) noexcept
+{
+	return m.get_cog();
+}
+
+static std::optional<double> course(const message_18 & m) noexcept
+{
+	return m.get_cog();
+}
+
+static std::optional<double> course(const message_19 & m) noexcept
+{
+	const auto t = m.get_cog();
+	return (t == cog_not_available) ? std::optional<double>{} : std::optional<double>{t * 0.1};
+}
+
+/// Returns the latitude in degrees, invalid values are not available.
+template <class Report>
+static double latitude(const Report & r)
+{
+	try {
+		const auto t = r.get_lat();
+		return t ? t->get() : not_available;
+	} catch (const std::invalid_argument &) {
+		return not_available;
+	}
+}
+
+/// Returns the longitude in degrees, invalid values are not available.
+template <class Report>
+static double longitude(const Report & r)
+{
+	try {
+		const auto t = r.get_lon();
+		return t ? t->get() : not_available;
+	} catch (const std::invalid_argument &) {
+		return not_available;
+	}
+}
+
+static std::optional<uint32_t> heading(const message_01 & m) noexcept
+{
+	return m.get_hdg();
+}
+
+static std::optional<uint32_t> heading(const message_18 & m) noexcept
+{
+	return m.get_hdg();
+}
+
+static std::optional<uint32_t> heading(const message_19 & m) noexcept
+{
+	const auto t = m.get_hdg();
+	return (t == hdg_not_available) ? std::optional<uint32_t>{} : std::optional<uint32_t>{t};
+}
+
+/// Packs the string, eight characters per word, into the specified words.
+template <class Column>
+static void pack(
+	Column & words, std::size_t first, std::size_t n, const std::string & s) noexcept
+{
+	for (std::size_t i = 0; i < n; ++i) {
+		uint64_t w = 0;
+		for (std::size_t j = 0; j < 8; ++j) {
+			const auto k = i * 8 + j;
+			if (k < s.size())
+				w |= static_cast<uint64_t>(static_cast<uint8_t>(s[k])) << (j * 8);
+		}
+		words[first + i].store(w, std::memory_order_relaxed);
+	}
+}
+
+static std::string unpack(const uint64_t * words, std::size_t n)
+{
+	std::string s;
+	for (std::size_t i = 0; i < n * 8; ++i) {
+		const auto c = static_cast<char>((words[i / 8] >> ((i % 8) * 8)) & 0xff);
+		if (c == '\0')
+			break;
+		s += c;
+	}
+	return s;
+}
+}
+/// @endcond
+
+/// @param[in] capacity Maximum number of vessels.
+/// @exception std::invalid_argument The capacity is zero.
+vessel_table::vessel_table(std::size_t capacity)
+	: capacity_(capacity)
+	, seq_(capacity)
+	, mmsi_(capacity)
+	, lat_(capacity)
+	, lon_(capacity)
+	, sog_(capacity)
+	, cog_(capacity)
+	, hdg_(capacity)
+	, nav_status_(capacity)
+	, dynamic_time_(capacity)
+	, shipname_(capacity * shipname_words)
+	, callsign_(capacity * callsign_words)
+	, shiptype_(capacity)
+	, to_bow_(capacity)
+	, to_stern_(capacity)
+	, to_port_(capacity)
+	, to_starboard_(capacity)
+	, imo_number_(capacity)
+	, static_time_(capacity)
+{
+	if (capacity == 0)
+		throw std::invalid_argument{"invalid capacity in ais/vessel_table"};
+
+	// index with at least twice the capacity, keeps the probe sequences short
+	unsigned int bits = 1;
+	while ((std::size_t{1} << bits) < capacity * 2)
+		++bits;
+	index_shift_ = 32 - bits;
+	index_mmsi_ = column<uint32_t>(std::size_t{1} << bits);
+	index_row_ = column<uint32_t>(std::size_t{1} << bits);
+
+	for (std::size_t row = 0; row < capacity; ++row) {
+		lat_[row].store(not_available, std::memory_order_relaxed);
+		lon_[row].store(not_available, std::memory_order_relaxed);
+		sog_[row].store(not_available, std::memory_order_relaxed);
+		cog_[row].store(not_available, std::memory_order_relaxed);
+		hdg_[row].store(hdg_not_available, std::memory_order_relaxed);
+		nav_status_[row].store(static_cast<uint8_t>(navigation_status::not_defined),
+			std::memory_order_relaxed);
+	}
+}
+
+/// Returns the first slot of the index to probe for the specified MMSI
+/// (fibonacci hashing).
+std::size_t vessel_table::slot(uint32_t mmsi) const noexcept
+{
+	return static_cast<uint32_t>(mmsi * 2654435769u) >> index_shift_;
+}
+
+/// Returns the row of the specified MMSI, or `capacity_` if there is none.
+std::size_t vessel_table::lookup(uint32_t mmsi) const noexcept
+{
+	const auto mask = index_mmsi_.size() - 1;
+	for (auto i = slot(mmsi);; i = (i + 1) & mask) {
+		const auto key = index_mmsi_[i].load(std::memory_order_acquire);
+		if (key == mmsi)
+			return index_row_[i].load(std::memory_order_relaxed);
+		if (key == 0)
+			return capacity_;
+	}
+}
+
+/// Returns the row of the specified MMSI, the row is added if necessary.
+/// Only to be called by the writer.
+///
+/// @exception std::length_error The table is full.
+std::size_t vessel_table::acquire(uint32_t mmsi)
+{
+	const auto mask = index_mmsi_.size() - 1;
+	auto i = slot(mmsi);
+	for (;; i = (i + 1) & mask) {
+		const auto key = index_mmsi_[i].load(std::memory_order_relaxed);
+		if (key == mmsi)
+			return index_row_[i].load(std::memory_order_relaxed);
+		if (key == 0)
+			break;
+	}
+
+	const auto row = size_.load(std::memory_order_relaxed);
+	if (row >= capacity_)
+		throw std::length_error{"capacity exceeded in ais/vessel_table"};
+
+	// the row is not visible to readers until it is published in the index
+	mmsi_[row].store(mmsi, std::memory_order_relaxed);
+	index_row_[i].store(static_cast<uint32_t>(row), std::memory_order_relaxed);
+	index_mmsi_[i].store(mmsi, std::memory_order_release);
+	size_.store(row + 1, std::memory_order_release);
+	return row;
+}
+
+void vessel_table::begin_write(std::size_t row) noexcept
+{
+	seq_[row].store(
+		seq_[row].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void vessel_table::end_write(std::size_t row) noexcept
+{
+	seq_[row].store(
+		seq_[row].load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+/// Reads the dynamic data of the position report. The data is read before
+/// the row is locked, the getters may throw.
+template <class Report>
+vessel_table::dynamic_data vessel_table::read_dynamic(const Report & r)
+{
+	const auto sog = r.get_sog();
+	const auto hdg = heading(r);
+
+	dynamic_data d;
+	d.lat = latitude(r);
+	d.lon = longitude(r);
+	d.sog = sog ? sog->value() : not_available;
+	d.cog = to_double(course(r));
+	d.hdg = static_cast<uint16_t>(hdg ? *hdg : hdg_not_available);
+	return d;
+}
+
+void vessel_table::write_dynamic(
+	std::size_t row, const dynamic_data & d, clock::time_point t) noexcept
+{
+	lat_[row].store(d.lat, std::memory_order_relaxed);
+	lon_[row].store(d.lon, std::memory_order_relaxed);
+	sog_[row].store(d.sog, std::memory_order_relaxed);
+	cog_[row].store(d.cog, std::memory_order_relaxed);
+	hdg_[row].store(d.hdg, std::memory_order_relaxed);
+	dynamic_time_[row].store(t.time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+void vessel_table::write_shipname(std::size_t row, const std::string & s) noexcept
+{
+	pack(shipname_, row * shipname_words, shipname_words, s);
+}
+
+void vessel_table::write_callsign(std::size_t row, const std::string & s) noexcept
+{
+	pack(callsign_, row * callsign_words, callsign_words, s);
+}
+
+void vessel_table::write_dimension(std::size_t row, const vessel_dimension & d) noexcept
+{
+	to_bow_[row].store(
+		static_cast<uint16_t>(d.get_to_bow().value()), std::memory_order_relaxed);
+	to_stern_[row].store(
+		static_cast<uint16_t>(d.get_to_stern().value()), std::memory_order_relaxed);
+	to_port_[row].store(
+		static_cast<uint16_t>(d.get_to_port().value()), std::memory_order_relaxed);
+	to_starboard_[row].store(
+		static_cast<uint16_t>(d.get_to_starboard().value()), std::memory_order_relaxed);
+}
+
+/// Updates the vessel, which sent the specified message. The vessel is added
+/// to the table, if it is not yet known.
+///
+/// Positions with coordinates out of range are treated as not available.
+///
+/// Must not be called concurrently, there must be only one writer.
+///
+/// @param[in] m The message.
+/// @param[in] t Point in time the message was received.
+/// @retval true The message updated the table.
+/// @retval false The message does not contain vessel data, or has no valid MMSI.
+/// @exception std::length_error The table is full.
+bool vessel_table::update(const message & m, clock::time_point t)
+{
+	const auto type = m.type();
+	uint32_t mmsi = 0;
+	switch (type) {
+		case message_id::position_report_class_a:
+		case message_id::position_report_class_a_assigned_schedule:
+		case message_id::position_report_class_a_response_to_interrogation:
+			mmsi = static_cast<const message_01 &>(m).get_mmsi();
+			break;
+		case message_id::standard_class_b_cs_position_report:
+			mmsi = static_cast<const message_18 &>(m).get_mmsi();
+			break;
+		case message_id::extended_class_b_equipment_position_report:
+			mmsi = static_cast<const message_19 &>(m).get_mmsi();
+			break;
+		case message_id::static_and_voyage_related_data:
+			mmsi = static_cast<const message_05 &>(m).get_mmsi();
+			break;
+		case message_id::static_data_report:
+			mmsi = static_cast<const message_24 &>(m).get_mmsi();
+			break;
+		default:
+			return false;
+	}
+	if (mmsi == 0)
+		return false;
+
+	// all data is read from the message before the row is locked, the row
+	// must not remain locked if a getter throws
+	const auto row = acquire(mmsi);
+	const auto now = t.time_since_epoch().count();
+	switch (type) {
+		case message_id::position_report_class_a:
+		case message_id::position_report_class_a_assigned_schedule:
+		case message_id::position_report_class_a_response_to_interrogation: {
+			const auto & r = static_cast<const message_01 &>(m);
+			const auto d = read_dynamic(r);
+			const auto nav_status = static_cast<uint8_t>(r.get_nav_status());
+			begin_write(row);
+			write_dynamic(row, d, t);
+			nav_status_[row].store(nav_status, std::memory_order_relaxed);
+			end_write(row);
+			break;
+		}
+		case message_id::standard_class_b_cs_position_report: {
+			const auto d = read_dynamic(static_cast<const message_18 &>(m));
+			begin_write(row);
+			write_dynamic(row, d, t);
+			end_write(row);
+			break;
+		}
+		case message_id::extended_class_b_equipment_position_report: {
+			const auto & r = static_cast<const message_19 &>(m);
+			const auto d = read_dynamic(r);
+			const auto shipname = trim_ais_string(r.get_shipname());
+			const auto shiptype = static_cast<uint8_t>(r.get_shiptype());
+			const auto dimension = r.get_vessel_dimension();
+			begin_write(row);
+			write_dynamic(row, d, t);
+			write_shipname(row, shipname);
+			shiptype_[row].store(shiptype, std::memory_order_relaxed);
+			write_dimension(row, dimension);
+			static_time_[row].store(now, std::memory_order_relaxed);
+			end_write(row);
+			break;
+		}
+		case message_id::static_and_voyage_related_data: {
+			const auto & r = static_cast<const message_05 &>(m);
+			const auto shipname = r.get_shipname();
+			const auto callsign = r.get_callsign();
+			const auto shiptype = static_cast<uint8_t>(r.get_shiptype());
+			const auto dimension = r.get_vessel_dimension();
+			const auto imo_number = r.get_imo_number();
+			begin_write(row);
+			write_shipname(row, shipname);
+			write_callsign(row, callsign);
+			shiptype_[row].store(shiptype, std::memory_order_relaxed);
+			write_dimension(row, dimension);
+			imo_number_[row].store(imo_number, std::memory_order_relaxed);
+			static_time_[row].store(now, std::memory_order_relaxed);
+			end_write(row);
+			break;
+		}
+		case message_id::static_data_report: {
+			const auto & r = static_cast<const message_24 &>(m);
+			if (r.get_part_number() == message_24::part::A) {
+				const auto shipname = r.get_shipname();
+				begin_write(row);
+				write_shipname(row, shipname);
+			} else {
+				const auto callsign = r.get_callsign();
+				const auto shiptype = static_cast<uint8_t>(r.get_shiptype());
+				const auto auxiliary = r.is_auxiliary_vessel();
+				const auto dimension = auxiliary ? vessel_dimension{} : r.get_vessel_dimension();
+				begin_write(row);
+				write_callsign(row, callsign);
+				shiptype_[row].store(shiptype, std::memory_order_relaxed);
+				if (!auxiliary)
+					write_dimension(row, dimension);
+			}
+			static_time_[row].store(now, std::memory_order_relaxed);
+			end_write(row);
+			break;
+		}
+		default:
+			break;
+	}
+	return true;
+}
+
+/// Returns a consistent copy of the state of the specified vessel.
+///
+/// May be called concurrently to `update`.
+///
+/// @param[in] mmsi The MMSI of the vessel.
+/// @return The vessel, or `std::nullopt` if the vessel is not in the table.
+std::optional<vessel_table::vessel> vessel_table::find(const utils::mmsi & mmsi) const
+{
+	const auto value = static_cast<uint32_t>(mmsi);
+	if (value == 0)
+		return {};
+	const auto row = lookup(value);
+	if (row >= capacity_)
+		return {};
+	return load(row);
+}
+
+/// Reads the row, retries if the writer modified it while reading.
+vessel_table::vessel vessel_table::load(std::size_t row) const
+{
+	uint32_t mmsi;
+	double lat, lon, sog, cog;
+	uint16_t hdg;
+	uint8_t nav_status;
+	int64_t dynamic_time;
+	uint64_t shipname[shipname_words];
+	uint64_t callsign[callsign_words];
+	uint8_t shiptype;
+	uint16_t to_bow, to_stern, to_port, to_starboard;
+	uint32_t imo_number;
+	int64_t static_time;
+
+	for (;;) {
+		const auto seq = seq_[row].load(std::memory_order_acquire);
+		if (seq & 1u)
+			continue; // writer is active
+
+		mmsi = mmsi_[row].load(std::memory_order_relaxed);
+		lat = lat_[row].load(std::memory_order_relaxed);
+		lon = lon_[row].load(std::memory_order_relaxed);
+		sog = sog_[row].load(std::memory_order_relaxed);
+		cog = cog_[row].load(std::memory_order_relaxed);
+		hdg = hdg_[row].load(std::memory_order_relaxed);
+		nav_status = nav_status_[row].load(std::memory_order_relaxed);
+		dynamic_time = dynamic_time_[row].load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < shipname_words; ++i)
+			shipname[i] = shipname_[row * shipname_words + i].load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < callsign_words; ++i)
+			callsign[i] = callsign_[row * callsign_words + i].load(std::memory_order_relaxed);
+		shiptype = shiptype_[row].load(std::memory_order_relaxed);
+		to_bow = to_bow_[row].load(std::memory_order_relaxed);
+		to_stern = to_stern_[row].load(std::memory_order_relaxed);
+		to_port = to_port_[row].load(std::memory_order_relaxed);
+		to_starboard = to_starboard_[row].load(std::memory_order_relaxed);
+		imo_number = imo_number_[row].load(std::memory_order_relaxed);
+		static_time = static_time_[row].load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (seq_[row].load(std::memory_order_relaxed) == seq)
+			break;
+	}
+
+	vessel v;
+	v.mmsi = utils::mmsi{mmsi};
+	if (!std::isnan(lat) && !std::isnan(lon))
+		v.pos = geo::position{geo::latitude{lat}, geo::longitude{lon}};
+	if (!std::isnan(sog))
+		v.sog = units::knots{sog};
+	v.cog = to_optional(cog);
+	if (hdg != hdg_not_available)
+		v.hdg = hdg;
+	v.nav_status = static_cast<navigation_status>(nav_status);
+	v.dynamic_time = clock::time_point{clock::duration{dynamic_time}};
+	v.shipname = unpack(shipname, shipname_words);
+	v.callsign = unpack(callsign, callsign_words);
+	v.shiptype = static_cast<ship_type>(shiptype);
+	v.dimension = vessel_dimension{units::meters{static_cast<double>(to_bow)},
+		units::meters{static_cast<double>(to_stern)},
+		units::meters{static_cast<double>(to_port)},
+		units::meters{static_cast<double>(to_starboard)}};
+	v.imo_number = imo_number;
+	v.static_time = clock::time_point{clock::duration{static_time}};
+	return v;
+}
+}
@@ -0,0 +1,311 @@
+#include <marnav/geo/cpa_screen.hpp>
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <cmath>
+
+namespace marnav::geo
+{
+/// @cond DEV
+namespace
+{
+constexpr double pi = 3.14159265358979323846;
+constexpr double deg_to_rad = pi / 180.0;
+constexpr double nm_per_degree = 60.0;
+
+/// Relative speeds below this (squared, knots) are considered parallel courses
+/// with the same speed, there is no CPA.
+constexpr double min_relative_speed2 = 1e-6;
+
+/// Number of vessels computed at once, the results are collected afterwards.
+constexpr std::size_t block_size = 64;
+
+struct block {
+	double t[block_size]; // TCPA in hours, negative if there is none
+	double d2[block_size]; // square of CPA in nautical miles
+};
+
+/// Computes TCPA and CPA of `n` vessels relative to the vessel `(x0, y0, vx0, vy0)`.
+///
+/// The loop has no branches nor function calls, to let the compiler vectorize it.
+static void approach(const double * x, const double * y, const double * vx,
+	const double * vy, std::size_t n, double x0, double y0, double vx0, double vy0,
+	block & result) noexcept
+{
+	for (std::size_t k = 0; k < n; ++k) {
+		const double dx = x[k] - x0;
+		const double dy = y[k] - y0;
+		const double dvx = vx[k] - vx0;
+		const double dvy = vy[k] - vy0;
+		const double dv2 = dvx * dvx + dvy * dvy;
+		const bool moving = dv2 > min_relative_speed2;
+		const double t = moving ? -(dx * dvx + dy * dvy) / (moving ? dv2 : 1.0) : -1.0;
+		const double cx = dx + t * dvx;
+		const double cy = dy + t * dvy;
+		result.t[k] = t;
+		result.d2[k] = cx * cx + cy * cy;
+	}
+}
+
+static std::chrono::seconds to_seconds(double hours)
+{
+	return std::chrono::duration_cast<std::chrono::seconds>(
+		std::chrono::duration<double>{hours * 3600.0});
+}
+
+static double to_hours(std::chrono::seconds t)
+{
+	return std::chrono::duration<double>{t}.count() / 3600.0;
+}
+}
+/// @endcond
+
+/// @param[in] origin The point of the plane, tangent to the earth. Should be
+///   in the center of the area of interest, e.g. the position of own ship.
+cpa_screen::cpa_screen(const position & origin)
+	: lat0_(origin.lat())
+	, lon0_(origin.lon())
+	, scale_lon_(nm_per_degree * std::cos(lat0_ * deg_to_rad))
+{
+}
+
+void cpa_screen::reserve(std::size_t n)
+{
+	ids_.reserve(n);
+	x_.reserve(n);
+	y_.reserve(n);
+	vx_.reserve(n);
+	vy_.reserve(n);
+}
+
+void cpa_screen::clear() noexcept
+{
+	prepared_ = false;
+	sorted_ = sorted_columns{};
+	ids_.clear();
+	x_.clear();
+	y_.clear();
+	vx_.clear();
+	vy_.clear();
+}
+
+void cpa_screen::project(
+	const vessel & v, double & x, double & y, double & vx, double & vy) const
+{
+	double d_lon = v.pos.lon() - lon0_;
+	if (d_lon > 180.0)
+		d_lon -= 360.0;
+	if (d_lon < -180.0)
+		d_lon += 360.0;
+
+	x = d_lon * scale_lon_;
+	y = (v.pos.lat() - lat0_) * nm_per_degree;
+	vx = v.sog * std::sin(v.cog * deg_to_rad);
+	vy = v.sog * std::cos(v.cog * deg_to_rad);
+}
+
+/// Adds a vessel.
+///
+/// @param[in] id Identification of the vessel, e.g. the MMSI.
+/// @param[in] v Position, speed (knots) and course (degrees) of the vessel.
+void cpa_screen::add(id_type id, const vessel & v)
+{
+	double x, y, vx, vy;
+	project(v, x, y, vx, vy);
+	prepared_ = false;
+	ids_.push_back(id);
+	x_.push_back(x);
+	y_.push_back(y);
+	vx_.push_back(vx);
+	vy_.push_back(vy);
+}
+
+/// Screens own ship against all vessels.
+///
+/// Vessels on parallel courses with the same speed, and vessels which already
+/// passed their closest point of approach, are not reported.
+///
+/// @param[in] own_id Identification of own ship, a vessel with the same identification
+///   is skipped.
+/// @param[in] own Position, speed and course of own ship.
+/// @param[in] l The thresholds.
+/// @return Encounters, `first` is own ship. In order of the vessels.
+std::vector<cpa_screen::encounter> cpa_screen::screen(
+	id_type own_id, const vessel & own, const limits & l) const
+{
+	double x0, y0, vx0, vy0;
+	project(own, x0, y0, vx0, vy0);
+
+	const double max_t = to_hours(l.tcpa);
+	const double max_d2 = l.cpa.value() * l.cpa.value();
+
+	std::vector<encounter> result;
+	block b;
+	const auto n = ids_.size();
+	for (std::size_t first = 0; first < n; first += block_size) {
+		const auto count = std::min(block_size, n - first);
+		approach(&x_[first], &y_[first], &vx_[first], &vy_[first], count, x0, y0, vx0, vy0, b);
+		for (std::size_t k = 0; k < count; ++k) {
+			if ((b.t[k] < 0.0) || (b.t[k] > max_t) || (b.d2[k] > max_d2))
+				continue;
+			if (ids_[first + k] == own_id)
+				continue;
+			result.push_back({own_id, ids_[first + k],
+				units::nautical_miles{std::sqrt(b.d2[k])}, to_seconds(b.t[k])});
+		}
+	}
+	return result;
+}
+
+/// Sorts the vessels along the east axis, for `screen_pairs` and `screen_pairs_parallel`.
+///
+/// Should be called once after all vessels are added. Without, each call of
+/// `screen_pairs` sorts its own copy of the vessels. Adding a vessel discards
+/// the sorted copy.
+void cpa_screen::prepare()
+{
+	sorted_ = sort();
+	prepared_ = true;
+}
+
+cpa_screen::sorted_columns cpa_screen::sort() const
+{
+	const auto n = ids_.size();
+
+	sorted_columns c;
+	c.order.resize(n);
+	std::iota(c.order.begin(), c.order.end(), 0u);
+	std::sort(c.order.begin(), c.order.end(),
+		[this](uint32_t a, uint32_t b) { return x_[a] < x_[b]; });
+
+	c.x.resize(n);
+	c.y.resize(n);
+	c.vx.resize(n);
+	c.vy.resize(n);
+	c.speed.resize(n);
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto k = c.order[i];
+		c.x[i] = x_[k];
+		c.y[i] = y_[k];
+		c.vx[i] = vx_[k];
+		c.vy[i] = vy_[k];
+		c.speed[i] = std::sqrt(c.vx[i] * c.vx[i] + c.vy[i] * c.vy[i]);
+	}
+	c.max_speed = n ? *std::max_element(c.speed.begin(), c.speed.end()) : 0.0;
+	return c;
+}
+
+/// Screens all pairs of vessels.
+///
+/// The work may be distributed among threads, each computing one part
+/// of the pairs, by calling this function concurrently with the same
+/// number of parts and different part numbers. The parts together contain
+/// all encounters. Call `prepare` before, to sort the vessels only once.
+///
+/// @param[in] l The thresholds.
+/// @param[in] part The part to compute, `0..parts-1`.
+/// @param[in] parts Total number of parts.
+/// @return Encounters, `first` is the smaller identification of the two
+///   vessels. In no particular order.
+/// @exception std::invalid_argument The part is not valid.
+std::vector<cpa_screen::encounter> cpa_screen::screen_pairs(
+	const limits & l, std::size_t part, std::size_t parts) const
+{
+	if (part >= parts)
+		throw std::invalid_argument{"invalid part in geo::cpa_screen::screen_pairs"};
+	if (prepared_)
+		return screen_part(sorted_, l, part, parts);
+	return screen_part(sort(), l, part, parts);
+}
+
+/// Screens all pairs of vessels, distributed among the specified number of threads.
+///
+/// The calling thread computes one of the parts. The vessels are sorted once
+/// for all threads, if `prepare` was not called before.
+///
+/// @param[in] l The thresholds.
+/// @param[in] threads Number of threads, including the calling thread.
+/// @return Encounters, see `screen_pairs`.
+/// @exception std::invalid_argument The number of threads is zero.
+std::vector<cpa_screen::encounter> cpa_screen::screen_pairs_parallel(
+	const limits & l, std::size_t threads) const
+{
+	if (threads == 0)
+		throw std::invalid_argument{
+			"invalid number of threads in geo::cpa_screen::screen_pairs_parallel"};
+
+	sorted_columns local;
+	if (!prepared_)
+		local = sort();
+	const auto & c = prepared_ ? sorted_ : local;
+
+	std::vector<std::vector<encounter>> results(threads);
+	std::vector<std::exception_ptr> errors(threads);
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for (std::size_t part = 1; part < threads; ++part) {
+		workers.emplace_back([this, &c, &l, &results, &errors, part, threads] {
+			try {
+				results[part] = screen_part(c, l, part, threads);
+			} catch (...) {
+				errors[part] = std::current_exception();
+			}
+		});
+	}
+	try {
+		results[0] = screen_part(c, l, 0, threads);
+	} catch (...) {
+		errors[0] = std::current_exception();
+	}
+	for (auto & w : workers)
+		w.join();
+
+	for (const auto & e : errors)
+		if (e)
+			std::rethrow_exception(e);
+
+	std::size_t n = 0;
+	for (const auto & r : results)
+		n += r.size();
+	auto result = std::move(results[0]);
+	result.reserve(n);
+	for (std::size_t i = 1; i < threads; ++i)
+		result.insert(result.end(), results[i].begin(), results[i].end());
+	return result;
+}
+
+std::vector<cpa_screen::encounter> cpa_screen::screen_part(
+	const sorted_columns & c, const limits & l, std::size_t part, std::size_t parts) const
+{
+	const auto n = c.x.size();
+	const double max_t = to_hours(l.tcpa);
+	const double max_d2 = l.cpa.value() * l.cpa.value();
+
+	std::vector<encounter> result;
+	block b;
+	for (std::size_t i = part; i < n; i += parts) {
+		// vessels further east than this are not able to come close enough in time
+		const double reach = c.x[i] + l.cpa.value() + (c.speed[i] + c.max_speed) * max_t;
+		const auto last = static_cast<std::size_t>(
+			std::upper_bound(c.x.begin() + static_cast<std::ptrdiff_t>(i) + 1, c.x.end(), reach)
+			- c.x.begin());
+
+		for (auto first = i + 1; first < last; first += block_size) {
+			const auto count = std::min(block_size, last - first);
+			approach(&c.x[first], &c.y[first], &c.vx[first], &c.vy[first], count, c.x[i],
+				c.y[i], c.vx[i], c.vy[i], b);
+			for (std::size_t k = 0; k < count; ++k) {
+				if ((b.t[k] < 0.0) || (b.t[k] > max_t) || (b.d2[k] > max_d2))
+					continue;
+				const auto a = ids_[c.order[i]];
+				const auto d = ids_[c.order[first + k]];
+				result.push_back({std::min(a, d), std::max(a, d),
+					units::nautical_miles{std::sqrt(b.d2[k])}, to_seconds(b.t[k])});
+			}
+		}
+	}
+	return result;
+}
+}
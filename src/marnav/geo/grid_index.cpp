@@ -0,0 +1,275 @@
+#include <marnav/geo/grid_index.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+
+namespace marnav::geo
+{
+/// @cond DEV
+namespace
+{
+constexpr double pi = 3.14159265358979323846;
+constexpr double deg_to_rad = pi / 180.0;
+constexpr double nm_per_degree = 60.0; // one nautical mile per minute of arc
+
+/// Half the circumference of the earth, no two points are further apart.
+constexpr double max_distance = 180.0 * nm_per_degree;
+
+/// Returns the distance in nautical miles between the two points on the
+/// sphere (haversine formula). Coordinates in degrees.
+static double distance_nm(double lat0, double lon0, double lat1, double lon1) noexcept
+{
+	const double s_lat = std::sin((lat1 - lat0) * deg_to_rad * 0.5);
+	const double s_lon = std::sin((lon1 - lon0) * deg_to_rad * 0.5);
+	const double a = s_lat * s_lat
+		+ std::cos(lat0 * deg_to_rad) * std::cos(lat1 * deg_to_rad) * s_lon * s_lon;
+	return 2.0 * std::asin(std::sqrt(std::min(a, 1.0))) / deg_to_rad * nm_per_degree;
+}
+}
+/// @endcond
+
+/// @param[in] cell_size Size of the grid cells in degrees.
+/// @exception std::invalid_argument The cell size is not within (0, 180].
+grid_index::grid_index(double cell_size)
+	: cell_size_(cell_size)
+{
+	if (!(cell_size > 0.0) || (cell_size > 180.0))
+		throw std::invalid_argument{"invalid cell size in geo::grid_index"};
+	rows_ = static_cast<uint32_t>(std::ceil(180.0 / cell_size));
+	cols_ = static_cast<uint32_t>(std::ceil(360.0 / cell_size));
+	cells_.resize(std::size_t{rows_} * cols_);
+}
+
+uint32_t grid_index::row(double lat) const noexcept
+{
+	const auto r = static_cast<uint32_t>((lat - latitude::min()) / cell_size_);
+	return std::min(r, rows_ - 1);
+}
+
+uint32_t grid_index::col(double lon) const noexcept
+{
+	// longitude 180 is the same as -180
+	const auto c = static_cast<uint32_t>((lon - longitude::min()) / cell_size_);
+	return (c >= cols_) ? 0 : c;
+}
+
+void grid_index::insert_into_cell(uint32_t index, uint32_t cell)
+{
+	auto & c = cells_[cell];
+	items_[index].cell = cell;
+	items_[index].slot = static_cast<uint32_t>(c.size());
+	c.push_back(index);
+}
+
+void grid_index::remove_from_cell(uint32_t index) noexcept
+{
+	auto & c = cells_[items_[index].cell];
+	const auto slot = items_[index].slot;
+	c[slot] = c.back();
+	items_[c[slot]].slot = slot;
+	c.pop_back();
+}
+
+/// Sets the position of the target, the target is added if it is not yet known.
+///
+/// @param[in] id The target.
+/// @param[in] p The new position of the target.
+void grid_index::update(id_type id, const position & p)
+{
+	const double lat = p.lat();
+	const double lon = p.lon();
+	const auto cell = row(lat) * cols_ + col(lon);
+
+	const auto i = ids_.find(id);
+	if (i == ids_.end()) {
+		const auto index = static_cast<uint32_t>(items_.size());
+		items_.push_back(item{id, lat, lon, 0, 0});
+		ids_.emplace(id, index);
+		insert_into_cell(index, cell);
+		return;
+	}
+
+	auto & t = items_[i->second];
+	t.lat = lat;
+	t.lon = lon;
+	if (t.cell != cell) {
+		remove_from_cell(i->second);
+		insert_into_cell(i->second, cell);
+	}
+}
+
+/// Removes the target from the index.
+///
+/// @param[in] id The target.
+/// @retval true The target was removed.
+/// @retval false The target is not known.
+bool grid_index::remove(id_type id)
+{
+	const auto i = ids_.find(id);
+	if (i == ids_.end())
+		return false;
+
+	const auto index = i->second;
+	ids_.erase(i);
+	remove_from_cell(index);
+
+	// move the last item into the gap
+	const auto last = static_cast<uint32_t>(items_.size() - 1);
+	if (index != last) {
+		items_[index] = items_[last];
+		cells_[items_[index].cell][items_[index].slot] = index;
+		ids_[items_[index].id] = index;
+	}
+	items_.pop_back();
+	return true;
+}
+
+/// Removes all targets, the memory of the cells is kept.
+void grid_index::clear()
+{
+	for (const auto & t : items_)
+		cells_[t.cell].clear();
+	items_.clear();
+	ids_.clear();
+}
+
+/// Returns the position of the target, or `std::nullopt` if the target is not known.
+std::optional<position> grid_index::find(id_type id) const
+{
+	const auto i = ids_.find(id);
+	if (i == ids_.end())
+		return {};
+	const auto & t = items_[i->second];
+	return position{latitude{t.lat}, longitude{t.lon}};
+}
+
+/// Returns all targets inside the region, boundaries inclusive.
+///
+/// The region may overlap the date line.
+///
+/// @param[in] r The region.
+/// @return The targets, in no particular order.
+std::vector<grid_index::id_type> grid_index::inside(const region & r) const
+{
+	const double top = r.top();
+	const double bottom = r.bottom();
+	const double left = r.left();
+	const double right = r.right();
+	const bool wraps = left > right;
+
+	const auto col_first = col(left);
+	const auto col_last = col(right);
+	const auto n_cols = (col_first <= col_last) && !wraps
+		? col_last - col_first + 1
+		: std::min(cols_, cols_ - col_first + col_last + 1);
+
+	std::vector<id_type> result;
+	for (auto y = row(bottom); y <= row(top); ++y) {
+		for (uint32_t n = 0; n < n_cols; ++n) {
+			const auto x = (col_first + n) % cols_;
+			for (const auto index : cells_[y * cols_ + x]) {
+				const auto & t = items_[index];
+				if ((t.lat < bottom) || (t.lat > top))
+					continue;
+				if (wraps ? ((t.lon < left) && (t.lon > right))
+						  : ((t.lon < left) || (t.lon > right)))
+					continue;
+				result.push_back(t.id);
+			}
+		}
+	}
+	return result;
+}
+
+/// Calls `func(item, distance)` for all items within the radius (nautical miles)
+/// around the center. Visits only cells overlapping the bounding box of the circle.
+template <class Func>
+void grid_index::visit(const position & center, double radius, Func func) const
+{
+	const double c_lat = center.lat();
+	const double c_lon = center.lon();
+	const double d_lat = radius / nm_per_degree;
+
+	const double lat_min = c_lat - d_lat;
+	const double lat_max = c_lat + d_lat;
+
+	// all longitudes if the circle contains a pole, otherwise widest extent
+	// of the circle, at the latitude of the bounding box closest to the pole
+	uint32_t col_first = 0;
+	uint32_t n_cols = cols_;
+	if ((lat_min > latitude::min()) && (lat_max < latitude::max())) {
+		const double extreme = std::max(std::abs(lat_min), std::abs(lat_max));
+		const double d_lon = d_lat / std::cos(extreme * deg_to_rad);
+		if (d_lon < 180.0) {
+			double lon_first = c_lon - d_lon;
+			if (lon_first < longitude::min())
+				lon_first += 360.0;
+			col_first = col(lon_first);
+			n_cols = std::min(cols_,
+				static_cast<uint32_t>(std::ceil(2.0 * d_lon / cell_size_)) + 2);
+		}
+	}
+
+	const auto row_first = row(std::max(lat_min, latitude::min()));
+	const auto row_last = row(std::min(lat_max, latitude::max()));
+	for (auto y = row_first; y <= row_last; ++y) {
+		for (uint32_t n = 0; n < n_cols; ++n) {
+			const auto x = (col_first + n) % cols_;
+			for (const auto index : cells_[y * cols_ + x]) {
+				const auto & t = items_[index];
+				const double d = distance_nm(c_lat, c_lon, t.lat, t.lon);
+				if (d <= radius)
+					func(t, d);
+			}
+		}
+	}
+}
+
+/// Returns all targets within the specified distance around the center.
+///
+/// @param[in] center The center of the circle.
+/// @param[in] radius The radius of the circle.
+/// @return The targets, in no particular order.
+std::vector<grid_index::id_type> grid_index::within(
+	const position & center, units::nautical_miles radius) const
+{
+	std::vector<id_type> result;
+	visit(center, radius.value(),
+		[&result](const item & t, double) { result.push_back(t.id); });
+	return result;
+}
+
+/// Returns the `k` targets closest to the center, ordered by distance.
+///
+/// The search radius starts at the cell size and is doubled until enough
+/// targets are found.
+///
+/// @param[in] center The position to search from.
+/// @param[in] k Maximum number of targets.
+/// @return The targets, closest first. Less than `k` if there are not enough targets.
+std::vector<grid_index::neighbor> grid_index::nearest(
+	const position & center, std::size_t k) const
+{
+	std::vector<neighbor> result;
+	if (k == 0)
+		return result;
+
+	const auto n = std::min(k, items_.size());
+	for (double radius = cell_size_ * nm_per_degree;; radius *= 2.0) {
+		result.clear();
+		visit(center, std::min(radius, max_distance + 1.0), [&result](const item & t, double d) {
+			result.push_back(neighbor{t.id, units::nautical_miles{d}});
+		});
+		if ((result.size() >= n) || (radius >= max_distance))
+			break;
+	}
+
+	const auto closer = [](const neighbor & a, const neighbor & b) {
+		return a.distance.value() < b.distance.value();
+	};
+	const auto last = result.begin() + static_cast<std::ptrdiff_t>(n);
+	std::partial_sort(result.begin(), last, result.end(), closer);
+	result.erase(last, result.end());
+	return result;
+}
+}
@@ -1,7 +1,84 @@
 #include <marnav/nmea/ais_helper.hpp>
+#include <marnav/ais/ais.hpp>
+#include "hex_digit.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace marnav::nmea
 {
+/// @cond DEV
+namespace
+{
+/// Maximum number of payload characters per sentence, same as `ais::encode_message`.
+constexpr std::size_t max_payload_chars = 56;
+
+/// Writes characters into the buffer of the caller, computes the checksum
+/// of the current sentence on the fly.
+class sentence_writer
+{
+public:
+	sentence_writer(char * buffer, std::size_t size) noexcept
+		: begin_(buffer)
+		, p_(buffer)
+		, end_(buffer + size)
+	{
+	}
+
+	std::size_t size() const noexcept { return static_cast<std::size_t>(p_ - begin_); }
+
+	void put(char c)
+	{
+		if (p_ == end_)
+			throw std::length_error{"buffer too small in nmea::write_vdms"};
+		*p_++ = c;
+		sum_ ^= static_cast<uint8_t>(c);
+	}
+
+	void put(const char * s)
+	{
+		for (; *s; ++s)
+			put(*s);
+	}
+
+	void put(uint32_t value)
+	{
+		char digits[10];
+		int n = 0;
+		do {
+			digits[n++] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		} while (value);
+		while (n > 0)
+			put(digits[--n]);
+	}
+
+	/// Starts a new sentence, the start token is not part of the checksum.
+	void begin_sentence()
+	{
+		put(sentence::start_token_ais);
+		sum_ = 0;
+	}
+
+	/// Terminates the sentence with its checksum and a line break.
+	void end_sentence()
+	{
+		const auto sum = sum_;
+		put(sentence::end_token);
+		put(detail::hex_digit(sum >> 4));
+		put(detail::hex_digit(sum));
+		put('\r');
+		put('\n');
+	}
+
+private:
+	char * begin_;
+	char * p_;
+	char * end_;
+	uint8_t sum_ = 0;
+};
+}
+/// @endcond
+
 /// Creates and returns a container of VDM sentences, created from the specified
 /// payload.
 ///
@@ -33,4 +110,81 @@ std::vector<std::unique_ptr<nmea::sentence>> make_vdms(
 
 	return sentences;
 }
+
+/// Renders the specified AIS data as VDM sentences into the buffer of the caller.
+///
+/// The data is armored and split into fragments in one pass, the sentences
+/// including their checksums are written directly into the buffer, each
+/// terminated by `\r\n`. No memory is allocated. The result is the same as
+/// `make_vdms(ais::encode_message(...))` and rendering the sentences by `to_string`.
+///
+/// @param[in] bits The data of the AIS message, see `ais::encode_bits`.
+/// @param[out] buffer The buffer to write the sentences to, no terminating
+///   `\0` is written.
+/// @param[in] size Size of the buffer, `vdms_max_size` is sufficient for
+///   any AIS message.
+/// @param[in] seq_msg_id The optional sequence message ID to be configured for
+///   the resulting sentences.
+/// @param[in] radio_channel Specifies which AIS radio channel to configure for
+///   the resulting sentences.
+/// @return Number of characters written to the buffer.
+/// @exception std::invalid_argument There is no data to write.
+/// @exception std::length_error The buffer is too small.
+std::size_t write_vdms(const ais::raw & bits, char * buffer, std::size_t size,
+	std::optional<uint32_t> seq_msg_id, ais_channel radio_channel)
+{
+	if (bits.size() == 0)
+		throw std::invalid_argument{"no data in nmea::write_vdms"};
+
+	const uint32_t n_chars = static_cast<uint32_t>((bits.size() + 5) / 6);
+	const uint32_t n_fragments
+		= static_cast<uint32_t>((n_chars + max_payload_chars - 1) / max_payload_chars);
+	const uint32_t n_fill_bits = static_cast<uint32_t>(n_chars * 6 - bits.size());
+	const char channel = (radio_channel == ais_channel::A) ? 'A' : 'B';
+
+	sentence_writer out{buffer, size};
+	ais::raw::size_type ofs = 0;
+	for (uint32_t fragment = 1; fragment <= n_fragments; ++fragment) {
+		out.begin_sentence();
+		out.put("AIVDM,");
+		out.put(n_fragments);
+		out.put(sentence::field_delimiter);
+		out.put(fragment);
+		out.put(sentence::field_delimiter);
+		if (seq_msg_id)
+			out.put(*seq_msg_id);
+		out.put(sentence::field_delimiter);
+		out.put(channel);
+		out.put(sentence::field_delimiter);
+
+		const auto last = std::min(bits.size(), ofs + max_payload_chars * 6);
+		for (; ofs + 6 <= last; ofs += 6)
+			out.put(ais::encode_armoring(bits.get<uint8_t>(ofs, 6)));
+		if (ofs < last) {
+			// remainder of the last fragment, padded with fill bits
+			const auto n = last - ofs;
+			out.put(ais::encode_armoring(
+				static_cast<uint8_t>(bits.get<uint8_t>(ofs, n) << (6 - n))));
+			ofs = last;
+		}
+
+		out.put(sentence::field_delimiter);
+		out.put((fragment == n_fragments) ? n_fill_bits : 0u);
+		out.end_sentence();
+	}
+
+	return out.size();
+}
+
+/// Encodes the specified AIS message and renders it as VDM sentences into
+/// the buffer of the caller.
+///
+/// @see write_vdms
+/// @exception std::invalid_argument The message is not able to encode.
+/// @exception std::length_error The buffer is too small.
+std::size_t write_vdms(const ais::message & msg, char * buffer, std::size_t size,
+	std::optional<uint32_t> seq_msg_id, ais_channel radio_channel)
+{
+	return write_vdms(ais::encode_bits(msg), buffer, size, seq_msg_id, radio_channel);
+}
 }
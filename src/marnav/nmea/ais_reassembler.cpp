@@ -0,0 +1,262 @@
+#include <marnav/nmea/ais_reassembler.hpp>
+#include <marnav/nmea/vdm.hpp>
+#include <marnav/ais/ais.hpp>
+#include "tag_block_source.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace marnav::nmea
+{
+/// @cond DEV
+namespace
+{
+static std::size_t index_size(std::size_t slots) noexcept
+{
+	// at most half of the entries are used
+	std::size_t n = 4;
+	while (n < 2 * slots)
+		n *= 2;
+	return n;
+}
+}
+/// @endcond
+
+/// @param[in] slots Maximum number of messages to be reassembled concurrently.
+/// @param[in] timeout Maximum time between the first and the last fragment of a message.
+/// @exception std::invalid_argument The number of slots is zero.
+ais_reassembler::ais_reassembler(std::size_t slots, clock::duration timeout)
+	: timeout_(timeout)
+	, slots_(slots)
+	, index_(index_size(slots), none)
+{
+	if (slots == 0)
+		throw std::invalid_argument{"invalid number of slots in ais_reassembler"};
+	clear();
+}
+
+/// Returns the number of incomplete messages.
+std::size_t ais_reassembler::pending() const noexcept
+{
+	return slots_.size() - free_.size();
+}
+
+/// Discards all incomplete messages, statistics are not affected.
+void ais_reassembler::clear() noexcept
+{
+	std::fill(index_.begin(), index_.end(), none);
+	free_.resize(slots_.size());
+	for (std::size_t i = 0; i < slots_.size(); ++i)
+		free_[i] = static_cast<uint32_t>(slots_.size() - 1 - i);
+	oldest_ = none;
+	newest_ = none;
+}
+
+/// Returns the preferred position of the key within the index.
+std::size_t ais_reassembler::home(const key & k) const noexcept
+{
+	uint64_t h = k.source ^ ((uint64_t{k.seq_msg_id} << 8) | static_cast<uint8_t>(k.channel));
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+	return static_cast<std::size_t>(h ^ (h >> 31)) & (index_.size() - 1);
+}
+
+/// Returns the slot of the message with the specified key, `none` if there is none.
+uint32_t ais_reassembler::find(const key & k) const noexcept
+{
+	const auto mask = index_.size() - 1;
+	for (auto pos = home(k); index_[pos] != none; pos = (pos + 1) & mask)
+		if (slots_[index_[pos]].id == k)
+			return index_[pos];
+	return none;
+}
+
+/// Appends the slot to the list of used slots, as the newest one.
+void ais_reassembler::link(uint32_t i) noexcept
+{
+	auto & s = slots_[i];
+	s.prev = newest_;
+	s.next = none;
+	if (newest_ != none)
+		slots_[newest_].next = i;
+	else
+		oldest_ = i;
+	newest_ = i;
+}
+
+void ais_reassembler::unlink(uint32_t i) noexcept
+{
+	auto & s = slots_[i];
+	if (s.prev != none)
+		slots_[s.prev].next = s.next;
+	else
+		oldest_ = s.next;
+	if (s.next != none)
+		slots_[s.next].prev = s.prev;
+	else
+		newest_ = s.prev;
+}
+
+/// Discards the message of the slot, the slot becomes free.
+void ais_reassembler::release(uint32_t i) noexcept
+{
+	const auto mask = index_.size() - 1;
+	auto pos = home(slots_[i].id);
+	while (index_[pos] != i)
+		pos = (pos + 1) & mask;
+
+	// backward shift deletion, entries after the removed one are moved closer
+	// to their preferred position, no tombstones are necessary
+	for (auto next = (pos + 1) & mask; index_[next] != none; next = (next + 1) & mask) {
+		const auto h = home(slots_[index_[next]].id);
+		if (((next - h) & mask) >= ((next - pos) & mask)) {
+			index_[pos] = index_[next];
+			pos = next;
+		}
+	}
+	index_[pos] = none;
+
+	unlink(i);
+	free_.push_back(i);
+}
+
+void ais_reassembler::evict_expired(clock::time_point now) noexcept
+{
+	while ((oldest_ != none) && (now - slots_[oldest_].start > timeout_)) {
+		release(oldest_);
+		++stats_.evicted_timeout;
+	}
+}
+
+/// Returns a free slot for the key, evicts the oldest message if necessary.
+uint32_t ais_reassembler::acquire(const key & k) noexcept
+{
+	if (free_.empty()) {
+		release(oldest_);
+		++stats_.evicted_overflow;
+	}
+	const auto i = free_.back();
+	free_.pop_back();
+
+	slots_[i].id = k;
+	const auto mask = index_.size() - 1;
+	auto pos = home(k);
+	while (index_[pos] != none)
+		pos = (pos + 1) & mask;
+	index_[pos] = i;
+	return i;
+}
+
+/// Appends the payload of the fragment to the message of the slot. If the payload
+/// is invalid, the slot is released before the exception is passed on.
+void ais_reassembler::append(uint32_t i, const vdm & v)
+{
+	try {
+		ais::append_payload(slots_[i].bits, v.get_payload(), v.get_n_fill_bits());
+	} catch (...) {
+		release(i);
+		throw;
+	}
+}
+
+/// Processes one fragment of an AIS message.
+///
+/// @param[in] v The VDM (or VDO) sentence containing the fragment.
+/// @param[in] now Point in time the sentence was received.
+/// @return The AIS message if the fragment completed it, `nullptr` otherwise
+///   (incomplete message, or message dropped by the filter).
+/// @exception std::invalid_argument The fragment numbers or the payload of the sentence
+///   are invalid, or the complete message could not be parsed. The incomplete message
+///   is discarded.
+/// @exception ais::unknown_message The complete message is not supported.
+std::unique_ptr<ais::message> ais_reassembler::process(const vdm & v, clock::time_point now)
+{
+	++stats_.fragments;
+
+	const auto n_fragments = v.get_n_fragments();
+	const auto fragment = v.get_fragment();
+	if ((n_fragments == 0) || (fragment == 0) || (fragment > n_fragments))
+		throw std::invalid_argument{"invalid fragment number in ais_reassembler::process"};
+
+	const bool accepted = (fragment != 1) || filter_.accepts(v.get_payload());
+
+	if (n_fragments == 1) {
+		if (!accepted) {
+			++stats_.filtered;
+			return nullptr;
+		}
+		single_.clear();
+		ais::append_payload(single_, v.get_payload(), v.get_n_fill_bits());
+		auto m = ais::make_message(single_);
+		++stats_.completed;
+		return m;
+	}
+
+	evict_expired(now);
+
+	key k;
+	k.source = detail::tag_block_source_hash(v.get_tag_block());
+	k.seq_msg_id = v.get_seq_msg_id().value_or(0xffffffffu);
+	k.channel = v.get_radio_channel() ? static_cast<char>(*v.get_radio_channel()) : 0;
+
+	auto i = find(k);
+
+	if (fragment == 1) {
+		if (i != none) {
+			// previous message with the same key was not completed
+			++stats_.dropped_sequence;
+			unlink(i);
+		} else {
+			i = acquire(k);
+		}
+		link(i);
+		auto & s = slots_[i];
+		s.skip = !accepted;
+		s.n_fragments = n_fragments;
+		s.next_fragment = 2;
+		s.start = now;
+		s.bits.clear();
+		if (!s.skip)
+			append(i, v);
+		return nullptr;
+	}
+
+	if (i == none) {
+		++stats_.dropped_sequence;
+		return nullptr;
+	}
+
+	auto & s = slots_[i];
+	if ((s.n_fragments != n_fragments) || (s.next_fragment != fragment)) {
+		release(i);
+		++stats_.dropped_sequence;
+		return nullptr;
+	}
+
+	if (!s.skip)
+		append(i, v);
+	if (fragment < n_fragments) {
+		++s.next_fragment;
+		return nullptr;
+	}
+
+	const bool skip = s.skip;
+	if (skip) {
+		release(i);
+		++stats_.filtered;
+		return nullptr;
+	}
+
+	// the slot is released only after the message was created from its bits,
+	// but before an exception is passed on
+	std::unique_ptr<ais::message> m;
+	try {
+		m = ais::make_message(s.bits);
+	} catch (...) {
+		release(i);
+		throw;
+	}
+	release(i);
+	++stats_.completed;
+	return m;
+}
+}
@@ -279,6 +279,8 @@ std::string to_name(sentence_id t)
 			return "Time of Day";
 		case sentence_id::TEP:
 			return "Transit Satellite Predicated Elevation";
+		case sentence_id::count:
+			break;
 	}
 	return "-";
 }
@@ -98,7 +98,9 @@
 #include <marnav/nmea/pgrmm.hpp>
 #include <marnav/nmea/pgrmz.hpp>
 #include <marnav/nmea/stalk.hpp>
+#include "../utils/parse_counters.hpp"
 #include <algorithm>
+#include <array>
 #include <string>
 
 /// @example parse_nmea.cpp
@@ -262,6 +264,77 @@ void check_raw_sentence(const std::string & s)
 		&& (s[0] != sentence::tag_block_token))
 		throw std::invalid_argument{"no start token in nmea/make_sentence"};
 }
+
+static std::unique_ptr<sentence> make_sentence(const std::string & s, checksum_handling chksum)
+{
+	talker talk{talker::none};
+	std::string tag;
+	std::string tag_block;
+	std::vector<std::string> fields;
+	std::tie(talk, tag, tag_block, fields) = detail::extract_sentence_information(s, chksum);
+	auto result = detail::find_parse_func(tag)(
+		talk, std::next(std::begin(fields)), std::prev(std::end(fields)));
+	result->set_tag_block(tag_block);
+	return result;
+}
+
+/// Parse statistics for all sentence IDs, failures which cannot be associated
+/// with a sentence are counted for sentence_id::NONE.
+static std::array<utils::detail::parse_counters, static_cast<std::size_t>(sentence_id::count)>
+	statistics;
+
+static utils::detail::parse_counters & counters(sentence_id id) noexcept
+{
+	const auto i = static_cast<std::size_t>(id);
+	return statistics[(i < statistics.size()) ? i : 0u];
+}
+
+#if defined(MARNAV_INSTRUMENTATION)
+/// Returns true if the address field of the raw sentence consists of
+/// at least three uppercase characters or digits.
+static bool has_regular_address(const std::string & s) noexcept
+{
+	if (s.empty())
+		return false;
+
+	std::string::size_type first = 0;
+	if (s[0] == sentence::tag_block_token) {
+		first = s.find(sentence::tag_block_token, 1);
+		if (first == std::string::npos)
+			return false;
+		++first;
+	}
+
+	const auto last = s.find(',', first);
+	if ((last == std::string::npos) || (last - first < 4))
+		return false;
+
+	return std::all_of(std::next(s.begin(), first + 1), std::next(s.begin(), last),
+		[](char c) { return ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')); });
+}
+
+static utils::detail::parse_counters::clock::duration elapsed(
+	utils::detail::parse_counters::clock::time_point t0) noexcept
+{
+	return utils::detail::parse_counters::clock::now() - t0;
+}
+
+/// Records a failed parse. The sentence ID is determined if possible, a malformed
+/// sentence with a well formed but unsupported address is counted as unknown.
+static void record_failure(const std::string & s, utils::detail::parse_result r,
+	utils::detail::parse_counters::clock::time_point t0) noexcept
+{
+	const auto d = elapsed(t0);
+	sentence_id id = sentence_id::NONE;
+	try {
+		id = extract_id(s);
+	} catch (...) {
+		if (r == utils::detail::parse_result::invalid)
+			r = has_regular_address(s) ? utils::detail::parse_result::unknown : r;
+	}
+	counters(id).record(r, d);
+}
+#endif
 }
 /// @endcond
 
@@ -332,15 +405,26 @@ sentence_id tag_to_id(const std::string & tag)
 /// @endcode
 std::unique_ptr<sentence> make_sentence(const std::string & s, checksum_handling chksum)
 {
-	talker talk{talker::none};
-	std::string tag;
-	std::string tag_block;
-	std::vector<std::string> fields;
-	std::tie(talk, tag, tag_block, fields) = detail::extract_sentence_information(s, chksum);
-	auto result = detail::find_parse_func(tag)(
-		talk, std::next(std::begin(fields)), std::prev(std::end(fields)));
-	result->set_tag_block(tag_block);
-	return result;
+#if defined(MARNAV_INSTRUMENTATION)
+	using utils::detail::parse_result;
+	const auto t0 = utils::detail::parse_counters::clock::now();
+	try {
+		auto result = detail::make_sentence(s, chksum);
+		detail::counters(result->id()).record(parse_result::success, detail::elapsed(t0));
+		return result;
+	} catch (checksum_error &) {
+		detail::record_failure(s, parse_result::checksum, t0);
+		throw;
+	} catch (unknown_sentence &) {
+		detail::record_failure(s, parse_result::unknown, t0);
+		throw;
+	} catch (...) {
+		detail::record_failure(s, parse_result::invalid, t0);
+		throw;
+	}
+#else
+	return detail::make_sentence(s, chksum);
+#endif
 }
 
 /// Extracts and returns the sentence ID of the specified raw NMEA sentence.
@@ -374,4 +458,28 @@ sentence_id extract_id(const std::string & s)
 
 	return tag_to_id(tag);
 }
+
+/// Returns a snapshot of the parse statistics of `make_sentence`, only sentence IDs
+/// with recorded parses are contained. Failures which could not be associated with
+/// a sentence are reported for `sentence_id::NONE`.
+///
+/// The statistics are empty if the library was built without instrumentation,
+/// see `utils::is_instrumentation_enabled`.
+std::vector<std::pair<sentence_id, utils::parse_statistics>> get_parse_statistics()
+{
+	std::vector<std::pair<sentence_id, utils::parse_statistics>> result;
+	for (std::size_t i = 0; i < detail::statistics.size(); ++i) {
+		const auto s = detail::statistics[i].snapshot();
+		if (s.total() > 0)
+			result.emplace_back(static_cast<sentence_id>(i), s);
+	}
+	return result;
+}
+
+/// Resets the parse statistics of all sentences.
+void reset_parse_statistics()
+{
+	for (auto & c : detail::statistics)
+		c.reset();
+}
 }
@@ -0,0 +1,123 @@
+#include <marnav/nmea/sentence_limiter.hpp>
+#include "tag_block_source.hpp"
+#include "../utils/fnv.hpp"
+#include <utility>
+
+namespace marnav::nmea
+{
+/// @param[in] min_interval The default minimum time between two accepted sentences
+///   of the same key. Zero means no rate limitation.
+/// @param[in] duplicate_window Time window in which identical sentences are dropped.
+///   Zero disables the detection of duplicates.
+/// @param[in] use_source If `true`, the source (`s:`) of the tag block is part of
+///   the key, i.e. the same sentence from different sources are treated separately.
+sentence_limiter::sentence_limiter(
+	clock::duration min_interval, clock::duration duplicate_window, bool use_source)
+	: default_min_interval_(min_interval)
+	, duplicate_window_(duplicate_window)
+	, use_source_(use_source)
+{
+}
+
+/// Sets the minimum interval for sentences of the specified tag (e.g. `"GGA"`).
+/// Proprietary sentences are specified with the entire address field (e.g. `"PGRME"`).
+///
+/// Affects only keys which were not seen yet, call `clear` to apply the setting
+/// to already known keys.
+void sentence_limiter::set_min_interval(const std::string & tag, clock::duration t)
+{
+	min_intervals_[tag] = t;
+}
+
+/// Forgets all keys, statistics are not affected.
+void sentence_limiter::clear()
+{
+	entries_.clear();
+}
+
+sentence_limiter::clock::duration sentence_limiter::min_interval_for(
+	const std::string & s, std::string::size_type first, std::string::size_type last) const
+{
+	if (min_intervals_.empty())
+		return default_min_interval_;
+
+	// skip talker ID, except for proprietary sentences
+	if ((last - first > 2) && (s[first] != 'P'))
+		first += 2;
+
+	const auto i = min_intervals_.find(s.substr(first, last - first));
+	return (i != min_intervals_.end()) ? i->second : default_min_interval_;
+}
+
+/// Decides whether or not the raw sentence is to be processed further.
+///
+/// @param[in] s The raw sentence, optionally with a preceeding tag block.
+/// @param[in] now Point in time the sentence was received.
+/// @retval true The sentence is accepted.
+/// @retval false The sentence was dropped, either because it is a duplicate
+///   or because of the rate limitation.
+bool sentence_limiter::accept(const std::string & s, clock::time_point now)
+{
+	++stats_.received;
+
+	std::string::size_type start = 0;
+	using utils::detail::fnv1a;
+
+	uint64_t key = utils::detail::fnv_offset_basis;
+
+	// tag block
+	if (!s.empty() && (s[0] == '\\')) {
+		const auto end = s.find('\\', 1);
+		if (end == std::string::npos) {
+			++stats_.passed;
+			return true;
+		}
+		if (use_source_) {
+			const auto src = detail::find_tag_block_source(s, 1, end);
+			key = fnv1a(s, src.first, src.second, key);
+			key = fnv1a(key, static_cast<uint8_t>(','));
+		}
+		start = end + 1;
+	}
+
+	// address field, including start token
+	const auto address_end = s.find(',', start);
+	if ((address_end == std::string::npos) || (address_end - start < 2)) {
+		++stats_.passed;
+		return true;
+	}
+	key = fnv1a(s, start, address_end, key);
+
+	auto end = s.size();
+	while ((end > start) && ((s[end - 1] == '\r') || (s[end - 1] == '\n')))
+		--end;
+	const uint64_t h = fnv1a(s, start, end);
+
+	auto i = entries_.find(key);
+	if (i == entries_.end()) {
+		entries_.emplace(key, entry{now, min_interval_for(s, start + 1, address_end), h});
+		++stats_.passed;
+		return true;
+	}
+
+	entry & e = i->second;
+	const auto dt = now - e.last;
+
+	if ((h == e.hash) && (dt < duplicate_window_)) {
+		++stats_.dropped_duplicate;
+		stats_.dropped_bytes += s.size();
+		return false;
+	}
+
+	if (dt < e.min_interval) {
+		++stats_.dropped_rate;
+		stats_.dropped_bytes += s.size();
+		return false;
+	}
+
+	e.last = now;
+	e.hash = h;
+	++stats_.passed;
+	return true;
+}
+}
@@ -0,0 +1,40 @@
+#ifndef MARNAV_NMEA_TAG_BLOCK_SOURCE_HPP
+#define MARNAV_NMEA_TAG_BLOCK_SOURCE_HPP
+
+#include "../utils/fnv.hpp"
+#include <string>
+#include <utility>
+
+namespace marnav::nmea::detail
+{
+/// Returns the range of the source (`s:`) within the tag block, specified by
+/// the range `[first, last)` (without delimiters). Returns an empty range if
+/// there is no source.
+inline std::pair<std::string::size_type, std::string::size_type> find_tag_block_source(
+	const std::string & s, std::string::size_type first, std::string::size_type last) noexcept
+{
+	while (first < last) {
+		auto end = first;
+		while ((end < last) && (s[end] != ',') && (s[end] != '*'))
+			++end;
+		if ((end - first >= 2) && (s[first] == 's') && (s[first + 1] == ':'))
+			return {first + 2, end};
+		if ((end >= last) || (s[end] == '*'))
+			break;
+		first = end + 1;
+	}
+	return {0, 0};
+}
+
+/// Returns the FNV-1a hash of the source (`s:`) of the tag block (without
+/// delimiters), or zero if there is no source.
+inline uint64_t tag_block_source_hash(const std::string & block) noexcept
+{
+	const auto src = find_tag_block_source(block, 0, block.size());
+	if (src.second == 0)
+		return 0;
+	return utils::detail::fnv1a(block, src.first, src.second);
+}
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef MARNAV_UTILS_FNV_HPP
+#define MARNAV_UTILS_FNV_HPP
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace marnav::utils
+{
+/// @cond DEV
+namespace detail
+{
+/// FNV-1a, 64 bit.
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ull;
+constexpr uint64_t fnv_prime = 1099511628211ull;
+
+/// Continues the hash value `h` with one byte.
+constexpr uint64_t fnv1a(uint64_t h, uint8_t byte) noexcept
+{
+	return (h ^ byte) * fnv_prime;
+}
+
+/// Continues the hash value `h` with the lower `n_bytes` bytes of the value,
+/// the least significant byte first.
+constexpr uint64_t fnv1a(uint64_t h, uint64_t value, std::size_t n_bytes) noexcept
+{
+	for (std::size_t i = 0; i < n_bytes; ++i)
+		h = fnv1a(h, static_cast<uint8_t>(value >> (i * 8)));
+	return h;
+}
+
+/// Continues the hash value `h` with the characters `[first, last)` of the string.
+inline uint64_t fnv1a(const std::string & s, std::string::size_type first,
+	std::string::size_type last, uint64_t h = fnv_offset_basis) noexcept
+{
+	for (; first < last; ++first)
+		h = fnv1a(h, static_cast<uint8_t>(s[first]));
+	return h;
+}
+}
+/// @endcond
+}
+
+#endif
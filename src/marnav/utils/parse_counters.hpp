@@ -0,0 +1,38 @@
+#ifndef MARNAV_UTILS_PARSE_COUNTERS_HPP
+#define MARNAV_UTILS_PARSE_COUNTERS_HPP
+
+#include <marnav/utils/parse_statistics.hpp>
+#include <atomic>
+#include <chrono>
+
+namespace marnav::utils
+{
+/// @cond DEV
+namespace detail
+{
+enum class parse_result { success, checksum, unknown, invalid };
+
+/// Thread safe counters, accumulating parse statistics of one type.
+/// Instances are meant to have static storage duration.
+class parse_counters
+{
+public:
+	using clock = std::chrono::steady_clock;
+
+	void record(parse_result r, clock::duration d) noexcept;
+	parse_statistics snapshot() const noexcept;
+	void reset() noexcept;
+
+private:
+	std::atomic<uint64_t> parsed_;
+	std::atomic<uint64_t> failed_checksum_;
+	std::atomic<uint64_t> failed_unknown_;
+	std::atomic<uint64_t> failed_invalid_;
+	std::atomic<uint64_t> latency_total_ns_;
+	std::array<std::atomic<uint64_t>, parse_statistics::latency_buckets> latency_;
+};
+}
+/// @endcond
+}
+
+#endif
@@ -0,0 +1,83 @@
+#include <marnav/utils/parse_statistics.hpp>
+#include "parse_counters.hpp"
+
+namespace marnav::utils
+{
+/// @cond DEV
+namespace detail
+{
+namespace
+{
+/// Returns the histogram bucket for the specified latency, which is the number
+/// of significant bits, limited to the last bucket.
+static std::size_t latency_bucket(uint64_t ns) noexcept
+{
+	std::size_t n = 0;
+	while (ns && (n < parse_statistics::latency_buckets - 1)) {
+		ns >>= 1;
+		++n;
+	}
+	return n;
+}
+}
+
+void parse_counters::record(parse_result r, clock::duration d) noexcept
+{
+	switch (r) {
+		case parse_result::success:
+			parsed_.fetch_add(1, std::memory_order_relaxed);
+			break;
+		case parse_result::checksum:
+			failed_checksum_.fetch_add(1, std::memory_order_relaxed);
+			break;
+		case parse_result::unknown:
+			failed_unknown_.fetch_add(1, std::memory_order_relaxed);
+			break;
+		case parse_result::invalid:
+			failed_invalid_.fetch_add(1, std::memory_order_relaxed);
+			break;
+	}
+
+	const auto ns = static_cast<uint64_t>(
+		std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+	latency_total_ns_.fetch_add(ns, std::memory_order_relaxed);
+	latency_[latency_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+parse_statistics parse_counters::snapshot() const noexcept
+{
+	parse_statistics s;
+	s.parsed = parsed_.load(std::memory_order_relaxed);
+	s.failed_checksum = failed_checksum_.load(std::memory_order_relaxed);
+	s.failed_unknown = failed_unknown_.load(std::memory_order_relaxed);
+	s.failed_invalid = failed_invalid_.load(std::memory_order_relaxed);
+	s.latency_total_ns = latency_total_ns_.load(std::memory_order_relaxed);
+	for (std::size_t i = 0; i < latency_.size(); ++i)
+		s.latency[i] = latency_[i].load(std::memory_order_relaxed);
+	return s;
+}
+
+void parse_counters::reset() noexcept
+{
+	parsed_.store(0, std::memory_order_relaxed);
+	failed_checksum_.store(0, std::memory_order_relaxed);
+	failed_unknown_.store(0, std::memory_order_relaxed);
+	failed_invalid_.store(0, std::memory_order_relaxed);
+	latency_total_ns_.store(0, std::memory_order_relaxed);
+	for (auto & bucket : latency_)
+		bucket.store(0, std::memory_order_relaxed);
+}
+}
+/// @endcond
+
+/// Returns `true` if the library was built with parse instrumentation,
+/// i.e. if parse statistics are collected.
+bool is_instrumentation_enabled() noexcept
+{
+#if defined(MARNAV_INSTRUMENTATION)
+	return true;
+#else
+	return false;
+#endif
+}
+}
@@ -0,0 +1,103 @@
+#ifndef MARNAV_UTILS_SPSC_QUEUE_HPP
+#define MARNAV_UTILS_SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <cstddef>
+
+namespace marnav::utils
+{
+/// @cond DEV
+namespace detail
+{
+/// Bounded lock free queue for exactly one producer and one consumer thread.
+///
+/// The elements are constructed once and reused. The producer writes into the
+/// element returned by `prepare` and publishes it with `commit`, the consumer
+/// reads the element returned by `front` and releases it with `pop`. Elements
+/// are never copied through the queue.
+///
+/// Both indices are on their own cache line, each side keeps a copy of the index
+/// of the other side and reads the shared one only if the copy indicates a full
+/// (producer) or empty (consumer) queue.
+template <class T>
+class spsc_queue
+{
+public:
+	/// @exception std::invalid_argument The capacity is zero.
+	explicit spsc_queue(std::size_t capacity)
+	{
+		if (capacity == 0)
+			throw std::invalid_argument{"invalid capacity in utils/spsc_queue"};
+		std::size_t n = 1;
+		while (n < capacity)
+			n *= 2;
+		items_.resize(n);
+		mask_ = n - 1;
+	}
+
+	spsc_queue(const spsc_queue &) = delete;
+	spsc_queue & operator=(const spsc_queue &) = delete;
+
+	std::size_t capacity() const noexcept { return items_.size(); }
+
+	/// Returns the number of elements, approximate if called concurrently.
+	std::size_t size() const noexcept
+	{
+		return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+	}
+
+	/// Producer: returns the element to be written, or `nullptr` if the queue is full.
+	T * prepare() noexcept
+	{
+		const auto tail = tail_.load(std::memory_order_relaxed);
+		if (tail - head_cache_ == items_.size()) {
+			head_cache_ = head_.load(std::memory_order_acquire);
+			if (tail - head_cache_ == items_.size())
+				return nullptr;
+		}
+		return &items_[tail & mask_];
+	}
+
+	/// Producer: publishes the element returned by `prepare`.
+	void commit() noexcept
+	{
+		tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	/// Consumer: returns the oldest element, or `nullptr` if the queue is empty.
+	T * front() noexcept
+	{
+		const auto head = head_.load(std::memory_order_relaxed);
+		if (head == tail_cache_) {
+			tail_cache_ = tail_.load(std::memory_order_acquire);
+			if (head == tail_cache_)
+				return nullptr;
+		}
+		return &items_[head & mask_];
+	}
+
+	/// Consumer: releases the element returned by `front`.
+	void pop() noexcept
+	{
+		head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+private:
+	static constexpr std::size_t cache_line = 64;
+
+	std::vector<T> items_;
+	std::size_t mask_ = 0;
+
+	alignas(cache_line) std::atomic<std::size_t> tail_{0}; // written by the producer
+	std::size_t head_cache_ = 0; // copy of head_, producer only
+
+	alignas(cache_line) std::atomic<std::size_t> head_{0}; // written by the consumer
+	std::size_t tail_cache_ = 0; // copy of tail_, consumer only
+};
+}
+/// @endcond
+}
+
+#endif
@@ -22,6 +22,7 @@
 //
 
 #include <marnav/nmea/ais_helper.hpp>
+#include <marnav/nmea/ais_reassembler.hpp>
 #include <marnav/nmea/checksum.hpp>
 #include <marnav/nmea/name.hpp>
 #include <marnav/nmea/nmea.hpp>
@@ -160,6 +161,7 @@
 #include <marnav/units/units.hpp>
 
 #include <marnav/utils/mmsi_country.hpp>
+#include <marnav/utils/parse_statistics.hpp>
 
 #include <marnav/version.hpp>
 
@@ -207,6 +209,7 @@ static struct {
 #endif
 		std::string file;
 		std::string input_string;
+		bool stats = false;
 	} config;
 } global;
 
@@ -2131,7 +2134,7 @@ static int dump_nmea(const std::string & line)
 	return -1;
 }
 
-static int dump_ais(const std::vector<std::unique_ptr<marnav::nmea::sentence>> & sentences)
+static int dump_ais(const marnav::ais::message & m)
 {
 #define ADD_MESSAGE(m)                               \
 	{                                                \
@@ -2172,24 +2175,19 @@ static int dump_ais(const std::vector<std::unique_ptr<marnav::nmea::sentence>> &
 
 	using namespace marnav;
 
-	try {
-		auto m = ais::make_message(nmea::collect_payload(sentences.begin(), sentences.end()));
-		auto i = std::find_if(std::begin(messages), std::end(messages),
-			[&m](const container::value_type & item) { return item.id == m->type(); });
-		if (i == std::end(messages)) {
-			fmt::printf("\t%s\n", detail::render(m->type()));
-			fmt::printf("%smessage_%02u%s\n\tnot implemented\n\n", terminal::magenta,
-				static_cast<uint8_t>(m->type()), terminal::normal);
-		} else {
-			fmt::printf("\t%s\n", detail::render(m->type()));
-			i->func(m.get());
-			fmt::printf("\n");
-			return 0;
-		}
-	} catch (std::exception & error) {
-		fmt::printf("\t%serror:%s %s\n\n", terminal::red, terminal::normal, error.what());
+	auto i = std::find_if(std::begin(messages), std::end(messages),
+		[&m](const container::value_type & item) { return item.id == m.type(); });
+	if (i == std::end(messages)) {
+		fmt::printf("\t%s\n", detail::render(m.type()));
+		fmt::printf("%smessage_%02u%s\n\tnot implemented\n\n", terminal::magenta,
+			static_cast<uint8_t>(m.type()), terminal::normal);
+		return -1;
 	}
-	return -1;
+
+	fmt::printf("\t%s\n", detail::render(m.type()));
+	i->func(&m);
+	fmt::printf("\n");
+	return 0;
 }
 
 static int process(std::function<bool(std::string &)> source)
@@ -2197,7 +2195,7 @@ static int process(std::function<bool(std::string &)> source)
 	using namespace marnav;
 
 	std::string line;
-	std::vector<std::unique_ptr<nmea::sentence>> sentences;
+	nmea::ais_reassembler reassembler;
 
 	int result = 0;
 
@@ -2224,32 +2222,28 @@ static int process(std::function<bool(std::string &)> source)
 				// something strange happened, no VDM nor VDO
 				fmt::printf("%s%s%s\n\terror: ignoring AIS sentence, dropping collection.\n\n",
 					terminal::red, line, terminal::normal);
-				sentences.clear();
+				reassembler.clear();
 				--result;
 				continue;
 			}
 
-			// check sentences if a discontuniation has occurred
-			if (sentences.size() && (sentences.back()->id() != v->id())) {
-				sentences.clear(); // there was a discontinuation, start over collecting
+			// incomplete messages are dropped by the reassembler
+			const auto & stats = reassembler.get_statistics();
+			const auto dropped = stats.dropped_sequence + stats.evicted_timeout;
+
+			try {
+				auto m = reassembler.process(*v);
+				if (m)
+					result += dump_ais(*m);
+			} catch (std::exception & error) {
 				fmt::printf(
-					"\t%swarning:%s dropping collection.\n", terminal::cyan, terminal::normal);
+					"\t%serror:%s %s\n\n", terminal::red, terminal::normal, error.what());
+				--result;
 			}
 
-			// check if a previous message was not complete
-			const auto n_fragments = v->get_n_fragments();
-			const auto fragment = v->get_fragment();
-			if (sentences.size() >= fragment) {
-				sentences.clear();
+			if (stats.dropped_sequence + stats.evicted_timeout != dropped)
 				fmt::printf(
 					"\t%swarning:%s dropping collection.\n", terminal::cyan, terminal::normal);
-			}
-
-			sentences.push_back(std::move(s));
-			if (fragment == n_fragments) {
-				result += dump_ais(sentences);
-				sentences.clear();
-			}
 		} else {
 			fmt::printf("%s%s%s\n\terror: ignoring AIS sentence.\n\n", terminal::red, line,
 				terminal::normal);
@@ -2278,6 +2272,50 @@ static void print_nmea_sentence_list()
 	}
 }
 
+template <class Container, class ToString>
+static void print_parse_statistics(const Container & stats, ToString to_str)
+{
+	fmt::printf("%-8s %10s %10s %10s %10s %10s %12s %12s\n", "type", "total", "parsed",
+		"checksum", "unknown", "invalid", "mean [ns]", "max [ns]");
+	for (const auto & [id, s] : stats) {
+		const auto last = std::find_if(
+			s.latency.rbegin(), s.latency.rend(), [](uint64_t n) { return n > 0; });
+		const auto max_bucket = std::distance(last, s.latency.rend()) - 1;
+		fmt::printf("%-8s %10u %10u %10u %10u %10u %12u %12s\n", to_str(id), s.total(),
+			s.parsed, s.failed_checksum, s.failed_unknown, s.failed_invalid,
+			s.latency_total_ns / s.total(),
+			(max_bucket > 0) ? fmt::sprintf("< %u", uint64_t{1} << max_bucket) : "0");
+	}
+}
+
+static void print_parse_statistics()
+{
+	using namespace marnav;
+
+	if (!utils::is_instrumentation_enabled()) {
+		fmt::printf("%swarning:%s parse statistics not available, instrumentation disabled.\n",
+			terminal::cyan, terminal::normal);
+		return;
+	}
+
+	fmt::printf("NMEA parse statistics:\n");
+	print_parse_statistics(nmea::get_parse_statistics(), [](nmea::sentence_id id) {
+		return (id == nmea::sentence_id::NONE) ? std::string{"-"} : to_string(id);
+	});
+	fmt::printf("\nAIS parse statistics:\n");
+	print_parse_statistics(ais::get_parse_statistics(), [](ais::message_id id) {
+		return (id == ais::message_id::NONE) ? std::string{"-"}
+											 : fmt::sprintf("%02u", static_cast<uint8_t>(id));
+	});
+}
+
+static int finish(int result)
+{
+	if (global.config.stats)
+		print_parse_statistics();
+	return result;
+}
+
 static bool parse_options(int argc, char ** argv)
 {
 #if defined(HAVE_IO)
@@ -2307,6 +2345,9 @@ static bool parse_options(int argc, char ** argv)
 		("i,input",
 			"String to parse",
 			cxxopts::value<std::string>(global.config.input_string))
+		("stats",
+			"Shows parse statistics at the end, needs a library built with instrumentation.",
+			cxxopts::value<bool>(global.config.stats))
 		;
 	// clang-format on
 
@@ -2364,7 +2405,8 @@ int main(int argc, char ** argv)
 
 	if (!global.config.file.empty()) {
 		std::ifstream ifs{global.config.file.c_str()};
-		return process([&](std::string & line) { return !!std::getline(ifs, line); });
+		return finish(
+			process([&](std::string & line) { return !!std::getline(ifs, line); }));
 	}
 
 #if defined(HAVE_IO)
@@ -2374,15 +2416,18 @@ int main(int argc, char ** argv)
 		default_nmea_reader source{
 			std::make_unique<serial>(global.config.port, global.config.speed,
 				serial::databits::bit_8, serial::stopbits::bit_1, serial::parity::none)};
-		return process([&](std::string & line) { return source.read_sentence(line); });
+		return finish(
+			process([&](std::string & line) { return source.read_sentence(line); }));
 	}
 #endif
 
 	if (!global.config.input_string.empty()) {
 		std::istringstream is(global.config.input_string);
-		return process([&](std::string & line) { return !!std::getline(is, line); });
+		return finish(
+			process([&](std::string & line) { return !!std::getline(is, line); }));
 	}
 
 	std::cin.sync_with_stdio(false);
-	return process([&](std::string & line) { return !!std::getline(std::cin, line); });
+	return finish(
+		process([&](std::string & line) { return !!std::getline(std::cin, line); }));
 }
@@ -0,0 +1,584 @@
+/// End to end benchmarks based on the sample data (NMEA and AIS) of the
+/// integration tests. All benchmarks process the entire corpus per iteration
+/// and report items (sentences or messages) and bytes per second.
+///
+/// Machine readable output for tracking:
+/// @code
+///   benchmark_corpus --benchmark_out=corpus.json --benchmark_out_format=json
+/// @endcode
+
+#include <marnav/nmea/nmea.hpp>
+#include <marnav/nmea/ais_helper.hpp>
+#include <marnav/nmea/checksum.hpp>
+#include <marnav/nmea/sentence.hpp>
+#include <marnav/nmea/split.hpp>
+#include <marnav/nmea/vdm.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/decoding_pipeline.hpp>
+#include <marnav/ais/duplicate_filter.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/position_columns.hpp>
+#include <marnav/ais/static_data_cache.hpp>
+#include <marnav/ais/track_store.hpp>
+#include <marnav/ais/vessel_table.hpp>
+#include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+enum corpus_id : int64_t { nmea_corpus = 0, ais_corpus = 1 };
+
+static std::vector<std::string> read_corpus(const std::string & filename)
+{
+	std::ifstream ifs{std::string{MARNAV_CORPUS_DIR} + "/" + filename};
+	if (!ifs)
+		throw std::runtime_error{"unable to open corpus: " + filename};
+
+	std::vector<std::string> result;
+	std::string line;
+	while (std::getline(ifs, line)) {
+		while (!line.empty() && ((line.back() == '\r') || (line.back() == '\n')))
+			line.pop_back();
+		if (line.empty() || (line[0] == '#'))
+			continue;
+		result.push_back(line);
+	}
+	return result;
+}
+
+static const std::vector<std::string> & corpus(int64_t id)
+{
+	static const std::vector<std::string> nmea = read_corpus("nmea-sample.txt");
+	static const std::vector<std::string> ais = read_corpus("ais-sample.txt");
+	return (id == nmea_corpus) ? nmea : ais;
+}
+
+static int64_t corpus_bytes(const std::vector<std::string> & lines)
+{
+	return std::accumulate(lines.begin(), lines.end(), int64_t{0},
+		[](int64_t sum, const std::string & s) { return sum + static_cast<int64_t>(s.size()); });
+}
+
+static void both_corpora(benchmark::internal::Benchmark * b)
+{
+	b->Arg(nmea_corpus)->Arg(ais_corpus)->Unit(benchmark::kMillisecond);
+}
+
+static void set_label(benchmark::State & state)
+{
+	state.SetLabel(state.range(0) == nmea_corpus ? "nmea-sample" : "ais-sample");
+}
+
+/// Parses all sentences which are valid, ignores the others.
+static std::vector<std::unique_ptr<marnav::nmea::sentence>> parse_corpus(
+	const std::vector<std::string> & lines)
+{
+	std::vector<std::unique_ptr<marnav::nmea::sentence>> result;
+	result.reserve(lines.size());
+	for (const auto & line : lines) {
+		try {
+			result.push_back(marnav::nmea::make_sentence(line));
+		} catch (...) {
+			// ignore
+		}
+	}
+	return result;
+}
+
+/// Reassembles AIS messages from VDM sentences and hands their payloads to `func`.
+template <class Func>
+static void process_ais(
+	const std::vector<std::unique_ptr<marnav::nmea::sentence>> & sentences, Func func)
+{
+	using namespace marnav;
+
+	std::vector<std::pair<std::string, uint32_t>> payload;
+	for (const auto & s : sentences) {
+		if (s->id() != nmea::sentence_id::VDM)
+			continue;
+		const auto vdm = nmea::sentence_cast<nmea::vdm>(s.get());
+		if (payload.size() + 1 != vdm->get_fragment())
+			payload.clear();
+		payload.emplace_back(vdm->get_payload(), vdm->get_n_fill_bits());
+		if (vdm->get_fragment() == vdm->get_n_fragments()) {
+			func(payload);
+			payload.clear();
+		}
+	}
+}
+}
+
+static void benchmark_corpus_split(benchmark::State & state)
+{
+	const auto & lines = corpus(state.range(0));
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & line : lines) {
+			auto fields = marnav::nmea::detail::parse_fields(line);
+			benchmark::DoNotOptimize(fields);
+		}
+	}
+	set_label(state);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lines.size()));
+	state.SetBytesProcessed(state.iterations() * corpus_bytes(lines));
+}
+
+BENCHMARK(benchmark_corpus_split)->Apply(both_corpora);
+
+static void benchmark_corpus_checksum(benchmark::State & state)
+{
+	const auto & lines = corpus(state.range(0));
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & line : lines) {
+			const auto start = line.find_first_of("$!");
+			const auto end = line.find('*', start);
+			if ((start == std::string::npos) || (end == std::string::npos))
+				continue;
+			auto sum = marnav::nmea::checksum(
+				std::next(line.begin(), start + 1), std::next(line.begin(), end));
+			benchmark::DoNotOptimize(sum);
+		}
+	}
+	set_label(state);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lines.size()));
+	state.SetBytesProcessed(state.iterations() * corpus_bytes(lines));
+}
+
+BENCHMARK(benchmark_corpus_checksum)->Apply(both_corpora);
+
+static void benchmark_corpus_parse(benchmark::State & state)
+{
+	const auto & lines = corpus(state.range(0));
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & line : lines) {
+			try {
+				auto s = marnav::nmea::make_sentence(line);
+				benchmark::DoNotOptimize(s);
+			} catch (...) {
+				// failures are part of the measurement
+			}
+		}
+	}
+	set_label(state);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lines.size()));
+	state.SetBytesProcessed(state.iterations() * corpus_bytes(lines));
+}
+
+BENCHMARK(benchmark_corpus_parse)->Apply(both_corpora);
+
+static void benchmark_corpus_render(benchmark::State & state)
+{
+	const auto & lines = corpus(state.range(0));
+	const auto sentences = parse_corpus(lines);
+	int64_t bytes = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & s : sentences) {
+			auto text = marnav::nmea::to_string(*s);
+			bytes += static_cast<int64_t>(text.size());
+			benchmark::DoNotOptimize(text);
+		}
+	}
+	set_label(state);
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sentences.size()));
+	state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(benchmark_corpus_render)->Apply(both_corpora);
+
+static void benchmark_corpus_ais_decode(benchmark::State & state)
+{
+	const auto & lines = corpus(ais_corpus);
+	int64_t messages = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto sentences = parse_corpus(lines);
+		process_ais(sentences, [&messages](const auto & payload) {
+			try {
+				auto m = marnav::ais::make_message(payload);
+				benchmark::DoNotOptimize(m);
+				++messages;
+			} catch (...) {
+				// failures are part of the measurement
+			}
+		});
+	}
+	state.SetItemsProcessed(messages);
+	state.SetBytesProcessed(state.iterations() * corpus_bytes(lines));
+}
+
+BENCHMARK(benchmark_corpus_ais_decode)->Unit(benchmark::kMillisecond);
+
+static void benchmark_corpus_ais_render(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<std::unique_ptr<ais::message>> messages;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&messages](const auto & payload) {
+		try {
+			messages.push_back(ais::make_message(payload));
+		} catch (...) {
+			// ignore
+		}
+	});
+
+	int64_t bytes = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & m : messages) {
+			try {
+				for (const auto & s : nmea::make_vdms(ais::encode_message(*m))) {
+					auto text = nmea::to_string(*s);
+					bytes += static_cast<int64_t>(text.size());
+					benchmark::DoNotOptimize(text);
+				}
+			} catch (...) {
+				// not all messages are able to encode
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+	state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(benchmark_corpus_ais_render)->Unit(benchmark::kMillisecond);
+
+static void benchmark_corpus_ais_render_buffer(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<std::unique_ptr<ais::message>> messages;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&messages](const auto & payload) {
+		try {
+			messages.push_back(ais::make_message(payload));
+		} catch (...) {
+			// ignore
+		}
+	});
+
+	char buffer[nmea::vdms_max_size];
+	int64_t bytes = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & m : messages) {
+			try {
+				bytes += static_cast<int64_t>(nmea::write_vdms(*m, buffer, sizeof(buffer)));
+				benchmark::DoNotOptimize(buffer);
+			} catch (...) {
+				// not all messages are able to encode
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+	state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(benchmark_corpus_ais_render_buffer)->Unit(benchmark::kMillisecond);
+
+static void benchmark_corpus_ais_vessel_table(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<std::unique_ptr<ais::message>> messages;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&messages](const auto & payload) {
+		try {
+			messages.push_back(ais::make_message(payload));
+		} catch (...) {
+			// ignore
+		}
+	});
+
+	ais::vessel_table table{100000};
+	const auto t = ais::vessel_table::clock::now();
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & m : messages)
+			benchmark::DoNotOptimize(table.update(*m, t));
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+	state.counters["vessels"] = static_cast<double>(table.size());
+}
+
+BENCHMARK(benchmark_corpus_ais_vessel_table)->Unit(benchmark::kMillisecond);
+
+/// Static data messages (types 5, 19 and 24) of the corpus, as raw data.
+static std::vector<marnav::ais::raw> static_data_messages()
+{
+	using namespace marnav;
+
+	std::vector<ais::raw> result;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&result](const auto & payload) {
+		try {
+			ais::raw bits;
+			for (const auto & p : payload)
+				ais::append_payload(bits, p.first, p.second);
+			const auto type = ais::message_view{bits}.type();
+			if ((type == ais::message_id::static_and_voyage_related_data)
+				|| (type == ais::message_id::extended_class_b_equipment_position_report)
+				|| (type == ais::message_id::static_data_report))
+				result.push_back(bits);
+		} catch (...) {
+			// ignore
+		}
+	});
+	return result;
+}
+
+/// Reference: decoding all static data messages.
+static void benchmark_corpus_ais_static_data_decode(benchmark::State & state)
+{
+	using namespace marnav;
+
+	const auto messages = static_data_messages();
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & bits : messages) {
+			try {
+				benchmark::DoNotOptimize(ais::make_message(bits));
+			} catch (...) {
+				// ignore
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+
+BENCHMARK(benchmark_corpus_ais_static_data_decode)->Unit(benchmark::kMicrosecond);
+
+/// Static data messages into the cache, all repeats after the first iteration.
+static void benchmark_corpus_ais_static_data_cache(benchmark::State & state)
+{
+	using namespace marnav;
+
+	const auto messages = static_data_messages();
+	ais::static_data_cache cache;
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & bits : messages) {
+			try {
+				benchmark::DoNotOptimize(cache.update(bits));
+			} catch (...) {
+				// ignore
+			}
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+	state.counters["vessels"] = static_cast<double>(cache.size());
+}
+
+BENCHMARK(benchmark_corpus_ais_static_data_cache)->Unit(benchmark::kMicrosecond);
+
+/// All messages of the corpus, each received by four stations. The time advances
+/// by one second per message, older messages leave the window of the filter.
+static void benchmark_corpus_ais_duplicate_filter(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<ais::raw> messages;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&messages](const auto & payload) {
+		try {
+			ais::raw bits;
+			for (const auto & p : payload)
+				ais::append_payload(bits, p.first, p.second);
+			messages.push_back(bits);
+		} catch (...) {
+			// ignore
+		}
+	});
+
+	constexpr uint32_t n_receivers = 4;
+	ais::duplicate_filter filter{1024, std::chrono::seconds{60}};
+	auto now = ais::duplicate_filter::clock::time_point{};
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & bits : messages) {
+			now += std::chrono::seconds{1};
+			for (uint32_t receiver = 0; receiver < n_receivers; ++receiver) {
+				try {
+					benchmark::DoNotOptimize(filter.process(bits, receiver, now));
+				} catch (...) {
+					// ignore
+				}
+			}
+		}
+	}
+	state.SetItemsProcessed(
+		state.iterations() * static_cast<int64_t>(messages.size() * n_receivers));
+	const auto & stats = filter.get_statistics();
+	state.counters["duplicates"] = static_cast<double>(stats.duplicates)
+		/ static_cast<double>(std::max<uint64_t>(1, stats.messages));
+}
+
+BENCHMARK(benchmark_corpus_ais_duplicate_filter)->Unit(benchmark::kMicrosecond);
+
+/// Decoding of all messages of the corpus by the pipeline, the argument is the
+/// number of shards (worker threads). Each shard keeps the static data of its
+/// vessels.
+static void benchmark_corpus_ais_decoding_pipeline(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<std::vector<std::pair<std::string, uint32_t>>> messages;
+	process_ais(parse_corpus(corpus(ais_corpus)),
+		[&messages](const auto & payload) { messages.push_back(payload); });
+
+	const auto n_shards = static_cast<std::size_t>(state.range(0));
+	std::vector<ais::static_data_cache> caches(n_shards);
+	ais::decoding_pipeline pipeline{
+		n_shards, [&caches](std::size_t shard, std::unique_ptr<ais::message> m) {
+			caches[shard].update(*m);
+		}};
+
+	for (auto _ : state) {
+		for (const auto & payload : messages) {
+			try {
+				pipeline.push(payload);
+			} catch (...) {
+				// ignore
+			}
+		}
+		pipeline.flush();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+	const auto stats = pipeline.get_statistics();
+	state.counters["failed"] = static_cast<double>(stats.failed)
+		/ static_cast<double>(std::max<uint64_t>(1, stats.messages));
+}
+
+BENCHMARK(benchmark_corpus_ais_decoding_pipeline)
+	->RangeMultiplier(2)
+	->Range(1, 8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond);
+
+/// Class A position reports (types 1, 2 and 3) of the corpus, as raw data.
+static std::vector<marnav::ais::raw> class_a_position_reports()
+{
+	using namespace marnav;
+
+	std::vector<ais::raw> result;
+	process_ais(parse_corpus(corpus(ais_corpus)), [&result](const auto & payload) {
+		try {
+			ais::raw bits;
+			for (const auto & p : payload)
+				ais::append_payload(bits, p.first, p.second);
+			const auto type = ais::message_view{bits}.type();
+			if (((type == ais::message_id::position_report_class_a)
+					|| (type == ais::message_id::position_report_class_a_assigned_schedule)
+					|| (type
+						== ais::message_id::position_report_class_a_response_to_interrogation))
+				&& (bits.size() == ais::message_01::SIZE_BITS))
+				result.push_back(bits);
+		} catch (...) {
+			// ignore
+		}
+	});
+	return result;
+}
+
+/// Reference: position, speed and course of decoded messages, one at a time.
+static void benchmark_corpus_ais_position_getters(benchmark::State & state)
+{
+	using namespace marnav;
+
+	std::vector<std::unique_ptr<ais::message>> messages;
+	for (const auto & bits : class_a_position_reports())
+		messages.push_back(ais::make_message(bits));
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & m : messages) {
+			const auto & r = static_cast<const ais::message_01 &>(*m);
+			try {
+				benchmark::DoNotOptimize(r.get_lat());
+				benchmark::DoNotOptimize(r.get_lon());
+			} catch (...) {
+				// ignore, out of range
+			}
+			benchmark::DoNotOptimize(r.get_sog());
+			benchmark::DoNotOptimize(r.get_cog());
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(messages.size()));
+}
+
+BENCHMARK(benchmark_corpus_ais_position_getters)->Unit(benchmark::kMicrosecond);
+
+/// Position, speed and course of the same messages, converted in batches.
+static void benchmark_corpus_ais_position_columns(benchmark::State & state)
+{
+	using namespace marnav;
+
+	ais::position_columns columns;
+	for (const auto & bits : class_a_position_reports())
+		columns.append(bits);
+
+	const auto n = columns.size();
+	std::vector<double> values(n);
+	std::vector<uint8_t> valid(n);
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		ais::convert_latitudes(columns.latitudes().data(), n, values.data(), valid.data());
+		ais::convert_longitudes(columns.longitudes().data(), n, values.data(), valid.data());
+		ais::convert_sog(columns.sog().data(), n, values.data(), valid.data());
+		ais::convert_cog(columns.cog().data(), n, values.data(), valid.data());
+		benchmark::DoNotOptimize(values.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+BENCHMARK(benchmark_corpus_ais_position_columns)->Unit(benchmark::kMicrosecond);
+
+/// Estimated positions of all vessels at one time, the reports of the corpus
+/// are received one per second. Arg 0: after the last report (dead reckoning),
+/// Arg 1: in the middle of the corpus (mostly interpolation).
+static void benchmark_corpus_ais_track_store_positions_at(benchmark::State & state)
+{
+	using namespace marnav;
+	using namespace std::chrono_literals;
+
+	const auto & reports = class_a_position_reports();
+	const auto t0 = ais::track_store::clock::time_point{} + 1h;
+
+	ais::track_store tracks{8, 1h};
+	for (std::size_t i = 0; i < reports.size(); ++i)
+		tracks.update(reports[i], t0 + static_cast<int64_t>(i) * 1s);
+
+	const auto t = (state.range(0) == 0)
+		? t0 + static_cast<int64_t>(reports.size()) * 1s + 30s
+		: t0 + static_cast<int64_t>(reports.size() / 2) * 1s + 500ms;
+
+	const auto n = tracks.size();
+	std::vector<double> lat(n);
+	std::vector<double> lon(n);
+	std::vector<uint8_t> valid(n);
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		tracks.positions_at(t, lat.data(), lon.data(), valid.data());
+		benchmark::DoNotOptimize(lat.data());
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+	state.counters["vessels"] = static_cast<double>(n);
+}
+
+BENCHMARK(benchmark_corpus_ais_track_store_positions_at)
+	->Arg(0)
+	->Arg(1)
+	->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
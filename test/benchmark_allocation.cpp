@@ -0,0 +1,119 @@
+#include "benchmark_allocation.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replacement of the global allocation functions, counting all allocations.
+// This file must be linked into every benchmark using `allocation_counter`.
+
+namespace
+{
+static std::atomic<uint64_t> allocations{0};
+static std::atomic<uint64_t> allocated_bytes{0};
+
+static void * allocate(std::size_t size) noexcept
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	return std::malloc(size ? size : 1u);
+}
+
+static void * allocate(std::size_t size, std::align_val_t align) noexcept
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+	// size must be a multiple of the alignment
+	const auto a = static_cast<std::size_t>(align);
+	return std::aligned_alloc(a, ((size ? size : 1u) + a - 1u) / a * a);
+}
+}
+
+namespace marnav_test
+{
+allocation_stats get_allocation_stats() noexcept
+{
+	allocation_stats s;
+	s.allocations = allocations.load(std::memory_order_relaxed);
+	s.bytes = allocated_bytes.load(std::memory_order_relaxed);
+	return s;
+}
+}
+
+void * operator new(std::size_t size)
+{
+	if (auto p = allocate(size))
+		return p;
+	throw std::bad_alloc{};
+}
+
+void * operator new[](std::size_t size)
+{
+	if (auto p = allocate(size))
+		return p;
+	throw std::bad_alloc{};
+}
+
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return allocate(size);
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return allocate(size);
+}
+
+void * operator new(std::size_t size, std::align_val_t align)
+{
+	if (auto p = allocate(size, align))
+		return p;
+	throw std::bad_alloc{};
+}
+
+void * operator new[](std::size_t size, std::align_val_t align)
+{
+	if (auto p = allocate(size, align))
+		return p;
+	throw std::bad_alloc{};
+}
+
+void operator delete(void * p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void * p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void * p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void * p, std::align_val_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void * p, std::align_val_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void * p, std::size_t, std::align_val_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete[](void * p, std::size_t, std::align_val_t) noexcept
+{
+	std::free(p);
+}
@@ -0,0 +1,61 @@
+#ifndef TEST_BENCHMARK_ALLOCATION_HPP
+#define TEST_BENCHMARK_ALLOCATION_HPP
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace marnav_test
+{
+struct allocation_stats {
+	uint64_t allocations = 0; ///< Number of calls to the global `operator new`.
+	uint64_t bytes = 0; ///< Number of bytes requested from the global `operator new`.
+};
+
+allocation_stats get_allocation_stats() noexcept;
+
+/// Counts heap allocations (global `operator new`) during its lifetime and
+/// reports them as benchmark counters `allocs/op` and `bytes/op`, i.e. averaged
+/// over the iterations.
+///
+/// Construct it right before the benchmark loop:
+/// @code
+///   static void benchmark_foo(benchmark::State & state)
+///   {
+///       marnav_test::allocation_counter allocs{state};
+///       for (auto _ : state) {
+///           ...
+///       }
+///   }
+/// @endcode
+///
+/// Needs `benchmark_allocation.cpp` to be linked, which replaces the global
+/// allocation functions.
+class allocation_counter
+{
+public:
+	explicit allocation_counter(benchmark::State & state) noexcept
+		: state_(state)
+		, start_(get_allocation_stats())
+	{
+	}
+
+	~allocation_counter()
+	{
+		const auto stop = get_allocation_stats();
+		state_.counters["allocs/op"] = benchmark::Counter(
+			static_cast<double>(stop.allocations - start_.allocations),
+			benchmark::Counter::kAvgIterations);
+		state_.counters["bytes/op"] = benchmark::Counter(
+			static_cast<double>(stop.bytes - start_.bytes), benchmark::Counter::kAvgIterations);
+	}
+
+	allocation_counter(const allocation_counter &) = delete;
+	allocation_counter & operator=(const allocation_counter &) = delete;
+
+private:
+	benchmark::State & state_;
+	const allocation_stats start_;
+};
+}
+
+#endif
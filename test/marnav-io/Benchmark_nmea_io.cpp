@@ -1,4 +1,5 @@
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 #include <iomanip>
 #include <locale>
 #include <sstream>
@@ -55,6 +56,7 @@ void read_v3(const std::string & s, double & value)
 static void benchmark_nmea_string_to_double_v0(benchmark::State & state)
 {
 	static const std::string s = "3.14159265";
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		double result = 0.0;
 		read_v0(s, result);
@@ -67,6 +69,7 @@ BENCHMARK(benchmark_nmea_string_to_double_v0);
 static void benchmark_nmea_string_to_double_v1(benchmark::State & state)
 {
 	static const std::string s = "3.14159265";
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		double result;
 		read_v1(s, result);
@@ -79,6 +82,7 @@ BENCHMARK(benchmark_nmea_string_to_double_v1);
 static void benchmark_nmea_string_to_double_v2(benchmark::State & state)
 {
 	static const std::string s = "3.14159265";
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		double result;
 		read_v2(s, result);
@@ -91,6 +95,7 @@ BENCHMARK(benchmark_nmea_string_to_double_v2);
 static void benchmark_nmea_string_to_double_v3(benchmark::State & state)
 {
 	static const std::string s = "3.14159265";
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		double result;
 		read_v3(s, result);
@@ -127,6 +132,7 @@ std::string format_double_v1(double data, unsigned int width)
 
 static void benchmark_nmea_format_double_v0(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		std::string result = format_double_v0(3.14159, 4);
 		benchmark::DoNotOptimize(result);
@@ -137,6 +143,7 @@ BENCHMARK(benchmark_nmea_format_double_v0);
 
 static void benchmark_nmea_format_double_v1(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		std::string result = format_double_v1(3.14159, 4);
 		benchmark::DoNotOptimize(result);
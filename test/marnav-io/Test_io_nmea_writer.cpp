@@ -0,0 +1,221 @@
+#include <marnav-io/nmea_writer.hpp>
+#include <marnav-io/device.hpp>
+#include <marnav/nmea/hdt.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+using namespace marnav;
+using namespace std::chrono_literals;
+
+/// Records all writes, optionally accepts only a limited number of bytes per write.
+class recording_device : public ::io::device
+{
+public:
+	recording_device(std::vector<std::string> & writes, uint32_t max_chunk = 0)
+		: writes_(writes)
+		, max_chunk_(max_chunk)
+	{
+	}
+
+	void open() override {}
+	void close() override {}
+
+	int read(char *, uint32_t) override
+	{
+		throw std::runtime_error{"operation not supported"};
+	}
+
+	int write(const char * buffer, uint32_t size) override
+	{
+		if (max_chunk_ > 0)
+			size = std::min(size, max_chunk_);
+		writes_.emplace_back(buffer, size);
+		return static_cast<int>(size);
+	}
+
+private:
+	std::vector<std::string> & writes_;
+	uint32_t max_chunk_;
+};
+
+class test_device : public ::io::device
+{
+public:
+	test_device(int result)
+		: result_(result)
+	{
+	}
+
+	void open() override {}
+	void close() override {}
+
+	int read(char *, uint32_t) override { return result_; }
+
+	int write(const char *, uint32_t) override { return result_; }
+
+private:
+	int result_;
+};
+
+class test_io_nmea_writer : public ::testing::Test
+{
+public:
+	using clock = io::nmea_writer::clock;
+
+	const clock::time_point t0 = clock::time_point{} + 1h;
+
+	static constexpr const char * sentence = "$GPHDT,10.0,T*08";
+};
+
+TEST_F(test_io_nmea_writer, no_device_flush)
+{
+	io::nmea_writer writer{nullptr, 1024, 1s};
+
+	writer.write(sentence, t0);
+	EXPECT_ANY_THROW(writer.flush());
+}
+
+TEST_F(test_io_nmea_writer, buffered_until_size_reached)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 40, 1s};
+
+	writer.write(sentence, t0);
+	EXPECT_EQ(0u, writes.size());
+	EXPECT_EQ(18u, writer.pending());
+
+	writer.write(sentence, t0);
+	EXPECT_EQ(0u, writes.size());
+
+	writer.write(sentence, t0);
+	ASSERT_EQ(1u, writes.size());
+	EXPECT_EQ(0u, writer.pending());
+	EXPECT_STREQ(
+		"$GPHDT,10.0,T*08\r\n$GPHDT,10.0,T*08\r\n$GPHDT,10.0,T*08\r\n", writes[0].c_str());
+
+	const auto stats = writer.get_statistics();
+	EXPECT_EQ(3u, stats.sentences);
+	EXPECT_EQ(54u, stats.bytes);
+	EXPECT_EQ(1u, stats.flushes);
+	EXPECT_EQ(1u, stats.writes);
+	EXPECT_DOUBLE_EQ(54.0, stats.bytes_per_write());
+}
+
+TEST_F(test_io_nmea_writer, existing_line_ending_kept)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 1s};
+
+	writer.write(std::string{sentence} + "\r\n", t0);
+	EXPECT_EQ(18u, writer.pending());
+}
+
+TEST_F(test_io_nmea_writer, flush_on_interval_with_write)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 100ms};
+
+	writer.write(sentence, t0);
+	writer.write(sentence, t0 + 50ms);
+	EXPECT_EQ(0u, writes.size());
+	writer.write(sentence, t0 + 100ms);
+	ASSERT_EQ(1u, writes.size());
+	EXPECT_EQ(54u, writes[0].size());
+}
+
+TEST_F(test_io_nmea_writer, flush_on_interval_with_poll)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 100ms};
+
+	EXPECT_FALSE(writer.poll(t0));
+
+	writer.write(sentence, t0);
+	EXPECT_FALSE(writer.poll(t0 + 99ms));
+	EXPECT_TRUE(writer.poll(t0 + 100ms));
+	EXPECT_EQ(1u, writes.size());
+	EXPECT_FALSE(writer.poll(t0 + 200ms));
+}
+
+TEST_F(test_io_nmea_writer, write_sentence)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 1s};
+
+	nmea::hdt hdt;
+	hdt.set_heading(10.0);
+	writer.write(hdt, t0);
+	writer.flush();
+
+	ASSERT_EQ(1u, writes.size());
+	EXPECT_STREQ("$IIHDT,10,T*0D\r\n", writes[0].c_str());
+}
+
+TEST_F(test_io_nmea_writer, partial_writes)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes, 10), 1024, 1s};
+
+	writer.write(sentence, t0);
+	writer.write(sentence, t0);
+	writer.flush();
+
+	ASSERT_EQ(4u, writes.size());
+	EXPECT_EQ(10u, writes[0].size());
+	EXPECT_EQ(6u, writes[3].size());
+
+	const auto stats = writer.get_statistics();
+	EXPECT_EQ(36u, stats.bytes);
+	EXPECT_EQ(1u, stats.flushes);
+	EXPECT_EQ(4u, stats.writes);
+	EXPECT_DOUBLE_EQ(9.0, stats.bytes_per_write());
+}
+
+TEST_F(test_io_nmea_writer, write_error)
+{
+	io::nmea_writer writer{std::make_unique<test_device>(-1), 1024, 1s};
+
+	writer.write(sentence, t0);
+	EXPECT_ANY_THROW(writer.flush());
+	EXPECT_EQ(18u, writer.pending());
+}
+
+TEST_F(test_io_nmea_writer, close_flushes)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 1s};
+
+	writer.write(sentence, t0);
+	writer.close();
+	EXPECT_EQ(1u, writes.size());
+}
+
+TEST_F(test_io_nmea_writer, destructor_flushes)
+{
+	std::vector<std::string> writes;
+	{
+		io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 1s};
+		writer.write(sentence, t0);
+	}
+	EXPECT_EQ(1u, writes.size());
+}
+
+TEST_F(test_io_nmea_writer, reset_statistics)
+{
+	std::vector<std::string> writes;
+	io::nmea_writer writer{std::make_unique<recording_device>(writes), 1024, 1s};
+
+	writer.write(sentence, t0);
+	writer.flush();
+	writer.reset_statistics();
+
+	const auto stats = writer.get_statistics();
+	EXPECT_EQ(0u, stats.sentences);
+	EXPECT_EQ(0u, stats.bytes);
+	EXPECT_EQ(0u, stats.flushes);
+	EXPECT_EQ(0u, stats.writes);
+	EXPECT_DOUBLE_EQ(0.0, stats.bytes_per_write());
+}
+}
@@ -1,5 +1,11 @@
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 #include <marnav/ais/ais.hpp>
+#include <marnav/ais/binary_001_11.hpp>
+#include <marnav/ais/binary_registry.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_08.hpp>
 
 namespace
 {
@@ -40,6 +46,7 @@ static void all_messages(benchmark::internal::Benchmark * b)
 static void benchmark_make_message(benchmark::State & state)
 {
 	state.SetLabel(messages[state.range(0)].label);
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		auto tmp = marnav::ais::make_message(messages[state.range(0)].data);
 		benchmark::DoNotOptimize(tmp);
@@ -48,4 +55,155 @@ static void benchmark_make_message(benchmark::State & state)
 
 BENCHMARK(benchmark_make_message)->Apply(all_messages);
 
+/// Decoding of the payload character by character, as it was done before
+/// `ais::append_payload`. Used as reference.
+static void benchmark_collect_reference(benchmark::State & state)
+{
+	const auto & data = messages[state.range(0)].data;
+	state.SetLabel(messages[state.range(0)].label);
+	marnav::ais::raw bits;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		bits.clear();
+		for (const auto & item : data) {
+			const auto last = item.first.cend() - 1;
+			for (auto i = item.first.cbegin(); i != item.first.cend(); ++i) {
+				const uint8_t value = marnav::ais::decode_armoring(*i);
+				if (i == last) {
+					bits.append(value >> item.second, 6 - item.second);
+				} else {
+					bits.append(value, 6);
+				}
+			}
+		}
+		benchmark::DoNotOptimize(bits);
+	}
+}
+
+BENCHMARK(benchmark_collect_reference)->Apply(all_messages);
+
+static void benchmark_append_payload(benchmark::State & state)
+{
+	const auto & data = messages[state.range(0)].data;
+	state.SetLabel(messages[state.range(0)].label);
+	marnav::ais::raw bits;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		bits.clear();
+		for (const auto & item : data)
+			marnav::ais::append_payload(bits, item.first, item.second);
+		benchmark::DoNotOptimize(bits);
+	}
+}
+
+BENCHMARK(benchmark_append_payload)->Apply(all_messages);
+
+/// Decoding of a position report without any heap allocations.
+static void benchmark_create_message_01(benchmark::State & state)
+{
+	const auto & data = messages[0].data;
+	marnav::ais::raw bits;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		bits.clear();
+		marnav::ais::append_payload(bits, data[0].first, data[0].second);
+		auto m = marnav::ais::create_message<marnav::ais::message_01>(bits);
+		benchmark::DoNotOptimize(m);
+	}
+}
+
+BENCHMARK(benchmark_create_message_01);
+
+/// Filtering by MMSI, decoding the entire message versus reading only the MMSI.
+static void benchmark_filter_mmsi_message_01(benchmark::State & state)
+{
+	const auto & data = messages[0].data;
+	marnav::ais::raw bits;
+	marnav::ais::append_payload(bits, data[0].first, data[0].second);
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto m = marnav::ais::create_message<marnav::ais::message_01>(bits);
+		benchmark::DoNotOptimize(m.get_mmsi());
+	}
+}
+
+BENCHMARK(benchmark_filter_mmsi_message_01);
+
+static void benchmark_filter_mmsi_view_01(benchmark::State & state)
+{
+	const auto & data = messages[0].data;
+	marnav::ais::raw bits;
+	marnav::ais::append_payload(bits, data[0].first, data[0].second);
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const marnav::ais::message_01::view view{bits};
+		benchmark::DoNotOptimize(view.get_mmsi());
+	}
+}
+
+BENCHMARK(benchmark_filter_mmsi_view_01);
+
+static void benchmark_peek_header(benchmark::State & state)
+{
+	const auto & payload = messages[state.range(0)].data[0].first;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		auto h = marnav::ais::peek_header(payload);
+		benchmark::DoNotOptimize(h);
+	}
+}
+
+BENCHMARK(benchmark_peek_header)->Apply(all_messages);
+
+/// Reading the strings (callsign, name, destination) of static and voyage related data.
+static void benchmark_view_05_strings(benchmark::State & state)
+{
+	const auto & data = messages[4].data;
+	marnav::ais::raw bits;
+	for (const auto & p : data)
+		marnav::ais::append_payload(bits, p.first, p.second);
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const marnav::ais::message_05::view view{bits};
+		benchmark::DoNotOptimize(view.get_callsign());
+		benchmark::DoNotOptimize(view.get_shipname());
+		benchmark::DoNotOptimize(view.get_destination());
+	}
+}
+
+BENCHMARK(benchmark_view_05_strings);
+
+/// Decoding the payload of a binary message, through the message versus the registry.
+static const std::string payload_08 = "802R5Ph0BkEachFWA2GaOwwwwwwwwwwwwkBwwwwwwwwwwwwwwwwwwwwwwwu";
+
+static void benchmark_binary_001_11_message(benchmark::State & state)
+{
+	marnav::ais::raw bits;
+	marnav::ais::append_payload(bits, payload_08, 2);
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto m = marnav::ais::create_message<marnav::ais::message_08>(bits);
+		marnav::ais::binary_001_11 b;
+		m.read_binary(b);
+		benchmark::DoNotOptimize(b.get_position());
+	}
+}
+
+BENCHMARK(benchmark_binary_001_11_message);
+
+static void benchmark_binary_001_11_registry(benchmark::State & state)
+{
+	marnav::ais::raw bits;
+	marnav::ais::append_payload(bits, payload_08, 2);
+	const auto registry = marnav::ais::binary_registry::standard();
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto p = registry.decode(bits);
+		benchmark::DoNotOptimize(
+			static_cast<const marnav::ais::binary_001_11 &>(*p).get_position());
+	}
+}
+
+BENCHMARK(benchmark_binary_001_11_registry);
+
 BENCHMARK_MAIN();
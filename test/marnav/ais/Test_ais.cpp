@@ -1,4 +1,6 @@
 #include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
 #include <gtest/gtest.h>
 
 namespace
@@ -129,4 +131,191 @@ TEST_F(test_ais, encode_armoring)
 		EXPECT_EQ(e.c, ais::encode_armoring(e.value));
 	}
 }
+
+TEST_F(test_ais, append_payload)
+{
+	// reference: decoding character by character
+	const auto reference = [](const std::string & payload, uint32_t fill_bits) {
+		ais::raw bits;
+		for (std::size_t i = 0; i < payload.size(); ++i) {
+			const auto value = ais::decode_armoring(payload[i]);
+			if (i + 1 == payload.size())
+				bits.append(value >> fill_bits, 6 - fill_bits);
+			else
+				bits.append(value, 6);
+		}
+		return bits;
+	};
+
+	const std::string payload = "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53"
+								"1@0000000000000wW`";
+
+	for (std::size_t n = 1; n <= payload.size(); ++n) {
+		for (uint32_t fill_bits = 0; fill_bits < 6; ++fill_bits) {
+			ais::raw bits;
+			ais::append_payload(bits, payload.substr(0, n), fill_bits);
+			EXPECT_EQ(reference(payload.substr(0, n), fill_bits), bits)
+				<< "n=" << n << ", fill_bits=" << fill_bits;
+		}
+	}
+}
+
+TEST_F(test_ais, append_payload_unaligned)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 2);
+	ais::append_payload(bits, "1@0000000000000", 2);
+
+	ais::raw expected;
+	ais::append_payload(
+		expected, "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 2);
+	for (const auto c : std::string{"1@000000000000"})
+		expected.append(ais::decode_armoring(c), 6);
+	expected.append(0, 4);
+
+	EXPECT_EQ(expected.size(), bits.size());
+	EXPECT_EQ(expected, bits);
+}
+
+TEST_F(test_ais, append_payload_invalid_fill_bits)
+{
+	ais::raw bits;
+	EXPECT_ANY_THROW(ais::append_payload(bits, "1@0", 6));
+}
+
+TEST_F(test_ais, create_message)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+
+	const auto m = ais::create_message<ais::message_01>(bits);
+	const auto expected = ais::make_message({{"133m@ogP00PD;88MD5MTDww@2D7k", 0}});
+	EXPECT_EQ(ais::message_cast<ais::message_01>(expected.get())->get_mmsi(), m.get_mmsi());
+}
+
+TEST_F(test_ais, create_message_wrong_type)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+	EXPECT_THROW(ais::create_message<ais::message_05>(bits), std::invalid_argument);
+	EXPECT_THROW(ais::create_message<ais::message_01>(ais::raw{}), std::invalid_argument);
+}
+
+TEST_F(test_ais, make_message_exceeds_capacity)
+{
+	const std::string payload(60, '0');
+	std::vector<std::pair<std::string, uint32_t>> v(5, {payload, 0});
+	EXPECT_THROW(ais::make_message(v), std::invalid_argument);
+}
+
+TEST_F(test_ais, make_message_unknown_type)
+{
+	ais::raw bits(168);
+	bits.set(63u, 0, 6);
+	EXPECT_THROW(ais::make_message(bits), ais::unknown_message);
+
+	ais::raw bits_15(88);
+	bits_15.set(15u, 0, 6);
+	EXPECT_THROW(ais::make_message(bits_15), ais::unknown_message);
+}
+
+TEST_F(test_ais, make_message_invalid_number_of_bits)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+	EXPECT_NO_THROW(ais::make_message(bits));
+
+	ais::raw short_bits;
+	ais::append_payload(short_bits, "133m@ogP00PD;88MD5MTDww@2D7", 0);
+	EXPECT_THROW(ais::make_message(short_bits), std::invalid_argument);
+
+	bits.append(0u, 6);
+	EXPECT_THROW(ais::make_message(bits), std::invalid_argument);
+}
+
+TEST_F(test_ais, make_message_all_types)
+{
+	struct entry {
+		uint32_t type;
+		std::size_t bits;
+	};
+
+	// message types with valid (minimal) number of bits
+	const entry entries[] = {{1, 168}, {2, 168}, {3, 168}, {4, 168}, {5, 424}, {6, 88},
+		{7, 72}, {8, 56}, {9, 168}, {10, 72}, {11, 168}, {12, 72}, {13, 72}, {14, 40},
+		{17, 80}, {18, 168}, {19, 312}, {20, 70}, {21, 272}, {22, 168}, {23, 160},
+		{24, 168}};
+
+	for (const auto & e : entries) {
+		ais::raw bits(e.bits);
+		bits.set(e.type, 0, 6);
+		const auto m = ais::make_message(bits);
+		ASSERT_NE(nullptr, m) << "type " << e.type;
+		EXPECT_EQ(static_cast<ais::message_id>(e.type), m->type()) << "type " << e.type;
+	}
+}
+
+TEST_F(test_ais, peek_header)
+{
+	static const std::vector<std::pair<std::string, uint32_t>> payloads = {
+		{"133m@ogP00PD;88MD5MTDww@2D7k", 0},
+		{"B000000002=Agp=18D3Q3wv00000", 0},
+		{"55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 0},
+		{"802R5Ph0BkEachFWA2GaOwwwwwwwwwwwwkBwwwwwwwwwwwwwwwwwwwwwwwu", 2},
+	};
+
+	for (const auto & p : payloads) {
+		ais::raw bits;
+		ais::append_payload(bits, p.first, p.second);
+		const ais::message_view expected{bits};
+
+		const auto h = ais::peek_header(p.first);
+		EXPECT_EQ(expected.type(), h.type) << p.first;
+		EXPECT_EQ(expected.get_repeat_indicator(), h.repeat_indicator) << p.first;
+		EXPECT_EQ(expected.get_mmsi(), h.mmsi) << p.first;
+	}
+}
+
+TEST_F(test_ais, peek_header_repeat_indicator)
+{
+	ais::raw bits(168);
+	bits.set(1u, 0, 6);
+	bits.set(3u, 6, 2);
+	bits.set(0x3fffffffu, 8, 30);
+
+	const auto h = ais::peek_header(ais::encode_message(*ais::make_message(bits))[0].first);
+	EXPECT_EQ(ais::message_id::position_report_class_a, h.type);
+	EXPECT_EQ(3u, h.repeat_indicator);
+	EXPECT_EQ(0x3fffffffu, h.mmsi);
+}
+
+TEST_F(test_ais, peek_header_too_short)
+{
+	EXPECT_THROW(ais::peek_header("133m@o"), std::invalid_argument);
+	EXPECT_NO_THROW(ais::peek_header("133m@og"));
+}
+
+TEST_F(test_ais, sixbit_ascii)
+{
+	for (uint8_t value = 0; value < 64; ++value)
+		EXPECT_EQ(value, ais::encode_sixbit_ascii(ais::decode_sixbit_ascii(value)));
+
+	EXPECT_EQ('@', ais::decode_sixbit_ascii(0));
+	EXPECT_EQ(' ', ais::decode_sixbit_ascii(32));
+	EXPECT_EQ('?', ais::decode_sixbit_ascii(63));
+	EXPECT_EQ(static_cast<char>(0xff), ais::decode_sixbit_ascii(64));
+	EXPECT_EQ(0xffu, ais::encode_sixbit_ascii('a'));
+	EXPECT_EQ(0xffu, ais::encode_sixbit_ascii(static_cast<char>(0x80)));
+}
+
+TEST_F(test_ais, trim_ais_string)
+{
+	EXPECT_EQ("", ais::trim_ais_string(""));
+	EXPECT_EQ("", ais::trim_ais_string("@@@@"));
+	EXPECT_EQ("", ais::trim_ais_string("   @@"));
+	EXPECT_EQ("ABC", ais::trim_ais_string("ABC@@@"));
+	EXPECT_EQ("ABC", ais::trim_ais_string("ABC   "));
+	EXPECT_EQ("A B", ais::trim_ais_string("A B @XY"));
+	EXPECT_EQ(" A", ais::trim_ais_string(" A"));
+}
 }
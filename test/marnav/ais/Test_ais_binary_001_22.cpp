@@ -0,0 +1,140 @@
+#include <marnav/ais/binary_001_22.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+using namespace marnav::ais;
+
+class test_ais_binary_001_22 : public ::testing::Test
+{
+};
+
+TEST_F(test_ais_binary_001_22, default_values)
+{
+	binary_001_22 b;
+	raw r;
+
+	b.write_to(r);
+
+	EXPECT_EQ(111 - 56, r.size());
+	EXPECT_TRUE(b.get_areas().empty());
+	EXPECT_FALSE(b.get_duration());
+}
+
+TEST_F(test_ais_binary_001_22, header)
+{
+	binary_001_22 b;
+	b.set_linkage_id(42);
+	b.set_notice_type(3);
+	b.set_month(7);
+	b.set_day(14);
+	b.set_hour(12);
+	b.set_minute(30);
+	b.set_duration(120);
+
+	raw r;
+	b.write_to(r);
+	binary_001_22 t;
+	t.read_from(r);
+
+	EXPECT_EQ(42u, t.get_linkage_id());
+	EXPECT_EQ(3u, t.get_notice_type());
+	EXPECT_EQ(7u, *t.get_month());
+	EXPECT_EQ(14u, *t.get_day());
+	EXPECT_EQ(12u, *t.get_hour());
+	EXPECT_EQ(30u, *t.get_minute());
+	EXPECT_EQ(120u, *t.get_duration());
+}
+
+TEST_F(test_ais_binary_001_22, sub_areas)
+{
+	binary_001_22::sub_area circle;
+	circle.type = binary_001_22::shape::circle;
+	circle.scale = 1;
+	circle.position = geo::position{geo::latitude{42.25}, geo::longitude{-70.5}};
+	circle.radius = 150;
+
+	binary_001_22::sub_area sector;
+	sector.type = binary_001_22::shape::sector;
+	sector.position = geo::position{geo::latitude{-33.5}, geo::longitude{151.25}};
+	sector.radius = 4000;
+	sector.left_bound = 10;
+	sector.right_bound = 350;
+
+	binary_001_22::sub_area polygon;
+	polygon.type = binary_001_22::shape::polygon;
+	polygon.scale = 2;
+	polygon.points[0] = {90, 1000};
+	polygon.points[1] = {180, 20};
+
+	binary_001_22::sub_area text;
+	text.type = binary_001_22::shape::text;
+	text.text = "NO ANCHORING";
+
+	binary_001_22 b;
+	b.set_areas({circle, sector, polygon, text});
+
+	raw r;
+	b.write_to(r);
+	EXPECT_EQ(111u - 56u + 4 * 87u, r.size());
+
+	binary_001_22 t;
+	t.read_from(r);
+	const auto & areas = t.get_areas();
+	ASSERT_EQ(4u, areas.size());
+
+	EXPECT_EQ(binary_001_22::shape::circle, areas[0].type);
+	EXPECT_EQ(1u, areas[0].scale);
+	EXPECT_NEAR(42.25, areas[0].position.lat().get(), 1e-4);
+	EXPECT_NEAR(-70.5, areas[0].position.lon().get(), 1e-4);
+	EXPECT_EQ(150u, areas[0].radius);
+
+	EXPECT_EQ(binary_001_22::shape::sector, areas[1].type);
+	EXPECT_NEAR(-33.5, areas[1].position.lat().get(), 1e-4);
+	EXPECT_NEAR(151.25, areas[1].position.lon().get(), 1e-4);
+	EXPECT_EQ(4000u, areas[1].radius);
+	EXPECT_EQ(10u, areas[1].left_bound);
+	EXPECT_EQ(350u, areas[1].right_bound);
+
+	EXPECT_EQ(binary_001_22::shape::polygon, areas[2].type);
+	EXPECT_EQ(2u, areas[2].scale);
+	EXPECT_EQ(90u, areas[2].points[0].angle);
+	EXPECT_EQ(1000u, areas[2].points[0].distance);
+	EXPECT_EQ(180u, areas[2].points[1].angle);
+	EXPECT_EQ(binary_001_22::angle_not_available, areas[2].points[2].angle);
+
+	EXPECT_EQ(binary_001_22::shape::text, areas[3].type);
+	EXPECT_EQ("NO ANCHORING", areas[3].text);
+}
+
+TEST_F(test_ais_binary_001_22, padding_is_ignored)
+{
+	binary_001_22::sub_area circle;
+	binary_001_22 b;
+	b.set_areas({circle});
+
+	raw r;
+	b.write_to(r);
+	r.append(0u, 4);
+
+	binary_001_22 t;
+	t.read_from(r);
+	EXPECT_EQ(1u, t.get_areas().size());
+}
+
+TEST_F(test_ais_binary_001_22, invalid)
+{
+	binary_001_22 b;
+	EXPECT_THROW(b.set_areas(std::vector<binary_001_22::sub_area>(11)), std::invalid_argument);
+
+	raw r(111 - 56 - 1);
+	EXPECT_THROW(b.read_from(r), std::invalid_argument);
+
+	raw unknown_shape(111 - 56);
+	unknown_shape.append(6u, 3);
+	for (int i = 0; i < 3; ++i)
+		unknown_shape.append(0u, 28);
+	EXPECT_THROW(b.read_from(unknown_shape), std::invalid_argument);
+}
+}
@@ -0,0 +1,165 @@
+#include <marnav/ais/binary_001_31.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+using namespace marnav::ais;
+
+class test_ais_binary_001_31 : public ::testing::Test
+{
+public:
+	static binary_001_31 write_and_read(const binary_001_31 & b)
+	{
+		raw r;
+		b.write_to(r);
+		binary_001_31 result;
+		result.read_from(r);
+		return result;
+	}
+};
+
+TEST_F(test_ais_binary_001_31, default_values)
+{
+	binary_001_31 b;
+	raw r;
+
+	b.write_to(r);
+
+	EXPECT_EQ(360 - 56, r.size());
+}
+
+TEST_F(test_ais_binary_001_31, all_not_available)
+{
+	const auto b = write_and_read(binary_001_31{});
+
+	EXPECT_FALSE(b.get_position());
+	EXPECT_FALSE(b.get_day());
+	EXPECT_FALSE(b.get_hour());
+	EXPECT_FALSE(b.get_minute());
+	EXPECT_FALSE(b.get_wind_speed_avg());
+	EXPECT_FALSE(b.get_wind_direction());
+	EXPECT_FALSE(b.get_air_temperature());
+	EXPECT_FALSE(b.get_humidity());
+	EXPECT_FALSE(b.get_dew_point());
+	EXPECT_FALSE(b.get_pressure());
+	EXPECT_FALSE(b.get_pressure_trend());
+	EXPECT_FALSE(b.get_visibility());
+	EXPECT_FALSE(b.get_water_level());
+	EXPECT_FALSE(b.get_surface_current_speed());
+	EXPECT_FALSE(b.get_wave_height());
+	EXPECT_FALSE(b.get_sea_state());
+	EXPECT_FALSE(b.get_water_temperature());
+	EXPECT_FALSE(b.get_precipitation());
+	EXPECT_FALSE(b.get_salinity());
+	EXPECT_FALSE(b.get_ice());
+}
+
+TEST_F(test_ais_binary_001_31, wrong_number_of_bits)
+{
+	binary_001_31 b;
+	raw r(360 - 56 - 1);
+
+	EXPECT_THROW(b.read_from(r), std::invalid_argument);
+}
+
+TEST_F(test_ais_binary_001_31, position)
+{
+	binary_001_31 b;
+	b.set_position(geo::position{geo::latitude{47.5}, geo::longitude{-8.25}});
+	b.set_position_accuracy(true);
+
+	const auto t = write_and_read(b);
+	ASSERT_TRUE(t.get_position());
+	EXPECT_NEAR(47.5, t.get_position()->lat().get(), 1e-4);
+	EXPECT_NEAR(-8.25, t.get_position()->lon().get(), 1e-4);
+	EXPECT_TRUE(t.get_position_accuracy());
+}
+
+TEST_F(test_ais_binary_001_31, signed_temperatures)
+{
+	binary_001_31 b;
+	b.set_air_temperature(-12.3);
+	b.set_dew_point(-5.5);
+	b.set_water_temperature(-1.2);
+
+	const auto t = write_and_read(b);
+	EXPECT_NEAR(-12.3, *t.get_air_temperature(), 1e-9);
+	EXPECT_NEAR(-5.5, *t.get_dew_point(), 1e-9);
+	EXPECT_NEAR(-1.2, *t.get_water_temperature(), 1e-9);
+
+	b.set_air_temperature(45.1);
+	b.set_dew_point(20.0);
+	b.set_water_temperature(28.3);
+
+	const auto u = write_and_read(b);
+	EXPECT_NEAR(45.1, *u.get_air_temperature(), 1e-9);
+	EXPECT_NEAR(20.0, *u.get_dew_point(), 1e-9);
+	EXPECT_NEAR(28.3, *u.get_water_temperature(), 1e-9);
+}
+
+TEST_F(test_ais_binary_001_31, pressure)
+{
+	binary_001_31 b;
+
+	b.set_pressure(1013);
+	EXPECT_EQ(1013u, *write_and_read(b).get_pressure());
+
+	b.set_pressure(700);
+	EXPECT_EQ(799u, *write_and_read(b).get_pressure());
+
+	b.set_pressure(1300);
+	EXPECT_EQ(1201u, *write_and_read(b).get_pressure());
+}
+
+TEST_F(test_ais_binary_001_31, water_level)
+{
+	binary_001_31 b;
+
+	b.set_water_level(-2.37);
+	EXPECT_NEAR(-2.37, *write_and_read(b).get_water_level(), 1e-9);
+
+	b.set_water_level(12.5);
+	EXPECT_NEAR(12.5, *write_and_read(b).get_water_level(), 1e-9);
+}
+
+TEST_F(test_ais_binary_001_31, hour)
+{
+	binary_001_31 b;
+
+	EXPECT_TRUE(!b.get_hour());
+	b.set_hour(0);
+	EXPECT_TRUE(!!b.get_hour());
+	b.set_hour(24);
+	EXPECT_TRUE(!b.get_hour());
+}
+
+TEST_F(test_ais_binary_001_31, misc_values)
+{
+	binary_001_31 b;
+	b.set_day(17);
+	b.set_wind_speed_avg(200);
+	b.set_wind_direction(270);
+	b.set_humidity(85);
+	b.set_visibility(4.2);
+	b.set_visibility_greater(true);
+	b.set_swell_height(2.5);
+	b.set_sea_state(5);
+	b.set_salinity(35.2);
+	b.set_precipitation(binary_001_31::precipitation::snow);
+	b.set_ice(binary_001_31::ice::no);
+
+	const auto t = write_and_read(b);
+	EXPECT_EQ(17u, *t.get_day());
+	EXPECT_EQ(126u, *t.get_wind_speed_avg());
+	EXPECT_EQ(270u, *t.get_wind_direction());
+	EXPECT_EQ(85u, *t.get_humidity());
+	EXPECT_NEAR(4.2, *t.get_visibility(), 1e-9);
+	EXPECT_TRUE(t.get_visibility_greater());
+	EXPECT_NEAR(2.5, *t.get_swell_height(), 1e-9);
+	EXPECT_EQ(5u, *t.get_sea_state());
+	EXPECT_NEAR(35.2, *t.get_salinity(), 1e-9);
+	EXPECT_EQ(binary_001_31::precipitation::snow, *t.get_precipitation());
+	EXPECT_EQ(binary_001_31::ice::no, *t.get_ice());
+}
+}
@@ -0,0 +1,171 @@
+#include <marnav/ais/binary_registry.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/binary_001_11.hpp>
+#include <marnav/ais/binary_001_31.hpp>
+#include <marnav/ais/binary_200_10.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_06.hpp>
+#include <marnav/ais/message_08.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+
+constexpr auto addressed = ais::message_id::binary_addressed_message;
+constexpr auto broadcast = ais::message_id::binary_broadcast_message;
+
+/// Payload of an application not known to the library.
+class custom_payload final : public ais::binary_payload
+{
+public:
+	constexpr static uint32_t DAC = 235;
+	constexpr static uint32_t FID = 42;
+
+	uint32_t get_dac() const noexcept override { return DAC; }
+	uint32_t get_fid() const noexcept override { return FID; }
+
+	void read_from(const ais::raw_view & payload) override { value = payload.get<uint32_t>(0, 16); }
+	void write_to(ais::raw & payload) const override
+	{
+		payload = ais::raw(16);
+		payload.set(value, 0, 16);
+	}
+
+	uint32_t value = 0;
+};
+
+class test_ais_binary_registry : public ::testing::Test
+{
+};
+
+TEST_F(test_ais_binary_registry, empty)
+{
+	ais::binary_registry registry;
+	EXPECT_FALSE(registry.contains(broadcast, 1, 11));
+	EXPECT_EQ(nullptr, registry.make(broadcast, 1, 11));
+}
+
+TEST_F(test_ais_binary_registry, standard)
+{
+	const auto registry = ais::binary_registry::standard();
+	EXPECT_TRUE(registry.contains(broadcast, 1, 11));
+	EXPECT_TRUE(registry.contains(broadcast, 1, 22));
+	EXPECT_TRUE(registry.contains(broadcast, 1, 31));
+	EXPECT_TRUE(registry.contains(broadcast, 200, 10));
+	EXPECT_FALSE(registry.contains(broadcast, 1, 12));
+	EXPECT_FALSE(registry.contains(broadcast, 2, 11));
+	EXPECT_FALSE(registry.contains(broadcast, 1024, 11));
+	EXPECT_FALSE(registry.contains(broadcast, 1, 64));
+
+	// all standard payloads are broadcast payloads
+	EXPECT_FALSE(registry.contains(addressed, 1, 11));
+	EXPECT_FALSE(registry.contains(addressed, 1, 31));
+	EXPECT_FALSE(registry.contains(addressed, 200, 10));
+	EXPECT_FALSE(registry.contains(ais::message_id::position_report_class_a, 1, 31));
+
+	const auto p = registry.make(broadcast, 1, 31);
+	ASSERT_NE(nullptr, p);
+	EXPECT_EQ(1u, p->get_dac());
+	EXPECT_EQ(31u, p->get_fid());
+}
+
+TEST_F(test_ais_binary_registry, invalid_add)
+{
+	const ais::binary_registry::factory f
+		= []() -> std::unique_ptr<ais::binary_payload> { return std::make_unique<custom_payload>(); };
+
+	ais::binary_registry registry;
+	EXPECT_THROW(registry.add(broadcast, 1024, 0, f), std::invalid_argument);
+	EXPECT_THROW(registry.add(broadcast, 1, 64, f), std::invalid_argument);
+	EXPECT_THROW(registry.add(broadcast, 1, 11, nullptr), std::invalid_argument);
+	EXPECT_THROW(
+		registry.add(ais::message_id::position_report_class_a, 1, 11, f), std::invalid_argument);
+}
+
+TEST_F(test_ais_binary_registry, decode_message_08)
+{
+	static const std::vector<std::pair<std::string, uint32_t>> v
+		= {{"83aGF=hj2P00000001>hj@QU6SL0", 0}};
+	ais::raw bits;
+	ais::append_payload(bits, v[0].first, v[0].second);
+
+	const auto registry = ais::binary_registry::standard();
+	const auto p = registry.decode(bits);
+	ASSERT_NE(nullptr, p);
+	ASSERT_EQ(ais::binary_200_10::FID, p->get_fid());
+
+	ais::binary_200_10 expected;
+	ais::message_cast<ais::message_08>(ais::make_message(v))->read_binary(expected);
+
+	const auto & b = static_cast<const ais::binary_200_10 &>(*p);
+	EXPECT_EQ(expected.get_vessel_id(), b.get_vessel_id());
+	EXPECT_EQ(expected.get_length(), b.get_length());
+	EXPECT_EQ(expected.get_draught(), b.get_draught());
+}
+
+TEST_F(test_ais_binary_registry, decode_message_06)
+{
+	ais::binary_001_31 meteo;
+	meteo.set_air_temperature(-3.4);
+
+	ais::message_06 m;
+	m.set_mmsi(utils::mmsi{123456789});
+	m.write_binary(meteo);
+	EXPECT_EQ(1u, m.get_dac());
+	EXPECT_EQ(31u, m.get_fid());
+
+	// FIDs of addressed messages are not those of broadcast messages
+	EXPECT_EQ(nullptr, ais::binary_registry::standard().decode(ais::encode_bits(m)));
+
+	ais::binary_registry registry;
+	registry.add<ais::binary_001_31>(addressed);
+	const auto p = registry.decode(ais::encode_bits(m));
+	ASSERT_NE(nullptr, p);
+	ASSERT_EQ(ais::binary_001_31::FID, p->get_fid());
+	EXPECT_NEAR(-3.4, *static_cast<const ais::binary_001_31 &>(*p).get_air_temperature(), 1e-9);
+
+	ais::binary_001_31 t;
+	ais::message_cast<ais::message_06>(ais::make_message(ais::encode_bits(m)))->read_binary(t);
+	EXPECT_NEAR(-3.4, *t.get_air_temperature(), 1e-9);
+
+	ais::binary_001_11 wrong;
+	EXPECT_THROW(m.read_binary(wrong), std::invalid_argument);
+}
+
+TEST_F(test_ais_binary_registry, user_defined_payload)
+{
+	auto registry = ais::binary_registry::standard();
+	EXPECT_FALSE(registry.contains(broadcast, custom_payload::DAC, custom_payload::FID));
+	registry.add<custom_payload>();
+	EXPECT_TRUE(registry.contains(broadcast, custom_payload::DAC, custom_payload::FID));
+	EXPECT_FALSE(registry.contains(addressed, custom_payload::DAC, custom_payload::FID));
+	EXPECT_TRUE(registry.contains(broadcast, 1, 31));
+
+	custom_payload payload;
+	payload.value = 0xbeef;
+	ais::message_08 m;
+	m.write_binary(payload);
+
+	const auto p = registry.decode(ais::encode_bits(m));
+	ASSERT_NE(nullptr, p);
+	EXPECT_EQ(0xbeefu, static_cast<const custom_payload &>(*p).value);
+
+	// the standard registry is not affected
+	EXPECT_EQ(nullptr, ais::binary_registry::standard().decode(ais::encode_bits(m)));
+}
+
+TEST_F(test_ais_binary_registry, not_a_binary_message)
+{
+	const auto registry = ais::binary_registry::standard();
+
+	ais::message_01 m;
+	EXPECT_THROW(registry.decode(ais::encode_bits(m)), std::invalid_argument);
+	EXPECT_THROW(registry.decode(ais::raw{}), std::invalid_argument);
+
+	ais::raw truncated;
+	truncated.append(8u, 6);
+	truncated.append(0u, 32);
+	EXPECT_THROW(registry.decode(truncated), std::invalid_argument);
+}
+}
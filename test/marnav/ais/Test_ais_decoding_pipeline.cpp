@@ -0,0 +1,206 @@
+#include <marnav/ais/decoding_pipeline.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <gtest/gtest.h>
+#include "make_report.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+using namespace marnav;
+
+class test_ais_decoding_pipeline : public ::testing::Test
+{
+public:
+	static void ignore(std::size_t, std::unique_ptr<ais::message>) {}
+};
+
+TEST_F(test_ais_decoding_pipeline, construction)
+{
+	ais::decoding_pipeline pipeline{4, ignore};
+	EXPECT_EQ(4u, pipeline.shards());
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(0u, stats.messages);
+	EXPECT_EQ(0u, stats.decoded);
+}
+
+TEST_F(test_ais_decoding_pipeline, invalid_construction)
+{
+	EXPECT_THROW(ais::decoding_pipeline(0, ignore), std::invalid_argument);
+	EXPECT_THROW(ais::decoding_pipeline(1, ignore, 0), std::invalid_argument);
+	EXPECT_THROW(ais::decoding_pipeline(1, nullptr), std::invalid_argument);
+}
+
+TEST_F(test_ais_decoding_pipeline, messages_of_vessel_in_order)
+{
+	constexpr std::size_t n_shards = 3;
+	constexpr uint32_t n_vessels = 20;
+
+	std::vector<std::vector<std::pair<uint32_t, uint32_t>>> received(n_shards);
+	ais::decoding_pipeline pipeline{
+		n_shards, [&received](std::size_t shard, std::unique_ptr<ais::message> m) {
+			const auto & r = static_cast<const ais::message_01 &>(*m);
+			received[shard].emplace_back(
+				static_cast<uint32_t>(r.get_mmsi()), r.get_timestamp());
+		},
+		4};
+
+	for (uint32_t t = 0; t < 60; ++t)
+		for (uint32_t v = 0; v < n_vessels; ++v)
+			EXPECT_TRUE(pipeline.push(marnav_test::make_report_bits(200000000 + v, t)));
+	pipeline.flush();
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(60u * n_vessels, stats.messages);
+	EXPECT_EQ(60u * n_vessels, stats.decoded);
+	EXPECT_EQ(0u, stats.dropped);
+
+	std::vector<uint32_t> next(n_vessels, 0);
+	for (std::size_t shard = 0; shard < n_shards; ++shard) {
+		for (const auto & [mmsi, timestamp] : received[shard]) {
+			EXPECT_EQ(shard, pipeline.shard_of(utils::mmsi{mmsi}));
+			EXPECT_EQ(next[mmsi - 200000000], timestamp);
+			++next[mmsi - 200000000];
+		}
+	}
+	for (const auto n : next)
+		EXPECT_EQ(60u, n);
+}
+
+TEST_F(test_ais_decoding_pipeline, push_payload)
+{
+	std::atomic<uint32_t> mmsi{0};
+	ais::decoding_pipeline pipeline{
+		2, [&mmsi](std::size_t, std::unique_ptr<ais::message> m) {
+			mmsi = static_cast<uint32_t>(static_cast<const ais::message_01 &>(*m).get_mmsi());
+		}};
+
+	ais::message_01 m;
+	m.set_mmsi(utils::mmsi{123456789});
+	EXPECT_TRUE(pipeline.push(ais::encode_message(m)));
+	pipeline.flush();
+	EXPECT_EQ(123456789u, mmsi);
+}
+
+TEST_F(test_ais_decoding_pipeline, invalid_push)
+{
+	ais::decoding_pipeline pipeline{1, ignore};
+
+	ais::raw bits;
+	bits.append(1u, 6);
+	EXPECT_THROW(pipeline.push(bits), std::invalid_argument);
+	EXPECT_THROW(pipeline.push(std::vector<std::pair<std::string, uint32_t>>{}),
+		std::invalid_argument);
+	EXPECT_THROW(pipeline.push({{"13u", 0}}), std::invalid_argument);
+	EXPECT_EQ(0u, pipeline.get_statistics().messages);
+}
+
+TEST_F(test_ais_decoding_pipeline, failed_to_decode)
+{
+	ais::decoding_pipeline pipeline{1, ignore};
+
+	ais::raw bits;
+	bits.append(63u, 6); // unknown message type
+	bits.append(123456789u, 32);
+	EXPECT_TRUE(pipeline.push(bits));
+	pipeline.flush();
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(1u, stats.messages);
+	EXPECT_EQ(1u, stats.failed);
+	EXPECT_EQ(0u, stats.decoded);
+}
+
+TEST_F(test_ais_decoding_pipeline, failed_to_decode_payload)
+{
+	ais::decoding_pipeline pipeline{1, ignore};
+
+	// the header is valid, the fill bits are not
+	EXPECT_TRUE(pipeline.push({{"13u?etPv2;0n", 6}}));
+	pipeline.flush();
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(1u, stats.messages);
+	EXPECT_EQ(1u, stats.failed);
+	EXPECT_EQ(0u, stats.decoded);
+}
+
+TEST_F(test_ais_decoding_pipeline, handler_throws)
+{
+	ais::decoding_pipeline pipeline{
+		1, [](std::size_t, std::unique_ptr<ais::message>) { throw std::runtime_error{"test"}; }};
+
+	EXPECT_TRUE(pipeline.push(marnav_test::make_report_bits(200000001, 1)));
+	EXPECT_TRUE(pipeline.push(marnav_test::make_report_bits(200000002, 2)));
+	pipeline.flush();
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(2u, stats.messages);
+	EXPECT_EQ(0u, stats.decoded);
+	EXPECT_EQ(0u, stats.failed);
+	EXPECT_EQ(2u, stats.handler_failed);
+	EXPECT_EQ(0u, pipeline.depth(0));
+}
+
+TEST_F(test_ais_decoding_pipeline, depth)
+{
+	std::atomic<bool> release{false};
+	ais::decoding_pipeline pipeline{1,
+		[&release](std::size_t, std::unique_ptr<ais::message>) {
+			while (!release)
+				std::this_thread::yield();
+		},
+		16};
+
+	for (uint32_t t = 0; t < 5; ++t)
+		pipeline.push(marnav_test::make_report_bits(123456789, t));
+	EXPECT_EQ(5u, pipeline.depth(0));
+	EXPECT_THROW(pipeline.depth(1), std::invalid_argument);
+
+	release = true;
+	pipeline.flush();
+	EXPECT_EQ(0u, pipeline.depth(0));
+}
+
+TEST_F(test_ais_decoding_pipeline, drop_if_queue_is_full)
+{
+	std::atomic<bool> release{false};
+	ais::decoding_pipeline pipeline{1,
+		[&release](std::size_t, std::unique_ptr<ais::message>) {
+			while (!release)
+				std::this_thread::yield();
+		},
+		2, ais::decoding_pipeline::overflow::drop};
+
+	uint32_t accepted = 0;
+	for (uint32_t t = 0; t < 10; ++t)
+		if (pipeline.push(marnav_test::make_report_bits(123456789, t)))
+			++accepted;
+
+	// two in the queue, at most one in the handler
+	EXPECT_LE(accepted, 3u);
+
+	release = true;
+	pipeline.flush();
+
+	const auto stats = pipeline.get_statistics();
+	EXPECT_EQ(accepted, stats.messages);
+	EXPECT_EQ(10u - accepted, stats.dropped);
+	EXPECT_EQ(accepted, stats.decoded);
+}
+
+TEST_F(test_ais_decoding_pipeline, destruction_processes_pending_messages)
+{
+	std::atomic<uint32_t> count{0};
+	{
+		ais::decoding_pipeline pipeline{
+			2, [&count](std::size_t, std::unique_ptr<ais::message>) { ++count; }};
+		for (uint32_t v = 0; v < 100; ++v)
+			pipeline.push(marnav_test::make_report_bits(200000000 + v, 0));
+	}
+	EXPECT_EQ(100u, count);
+}
+}
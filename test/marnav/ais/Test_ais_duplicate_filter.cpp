@@ -0,0 +1,134 @@
+#include <marnav/ais/duplicate_filter.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <gtest/gtest.h>
+#include "make_report.hpp"
+
+namespace
+{
+using namespace marnav;
+using namespace std::chrono_literals;
+
+class test_ais_duplicate_filter : public ::testing::Test
+{
+public:
+	using time_point = ais::duplicate_filter::clock::time_point;
+
+	const time_point t0 = time_point{} + 1h;
+};
+
+TEST_F(test_ais_duplicate_filter, construction)
+{
+	ais::duplicate_filter filter;
+	EXPECT_EQ(4096u, filter.capacity());
+	EXPECT_EQ(0u, filter.get_statistics().messages);
+}
+
+TEST_F(test_ais_duplicate_filter, capacity_rounded_up)
+{
+	EXPECT_EQ(1024u, ais::duplicate_filter{1000}.capacity());
+	EXPECT_EQ(8u, ais::duplicate_filter{1}.capacity());
+}
+
+TEST_F(test_ais_duplicate_filter, invalid_capacity)
+{
+	EXPECT_THROW(ais::duplicate_filter{0}, std::invalid_argument);
+}
+
+TEST_F(test_ais_duplicate_filter, duplicate_is_dropped)
+{
+	ais::duplicate_filter filter;
+	const auto bits = marnav_test::make_report_bits(123456789, 10);
+
+	EXPECT_TRUE(filter.process(bits, 0, t0));
+	EXPECT_FALSE(filter.process(bits, 0, t0 + 1s));
+	EXPECT_FALSE(filter.process(bits, 0, t0 + 2s));
+
+	const auto & stats = filter.get_statistics();
+	EXPECT_EQ(3u, stats.messages);
+	EXPECT_EQ(2u, stats.duplicates);
+}
+
+TEST_F(test_ais_duplicate_filter, different_messages_pass)
+{
+	ais::duplicate_filter filter;
+
+	EXPECT_TRUE(filter.process(marnav_test::make_report_bits(123456789, 10), 0, t0));
+	EXPECT_TRUE(filter.process(marnav_test::make_report_bits(123456789, 11), 0, t0));
+	EXPECT_TRUE(filter.process(marnav_test::make_report_bits(987654321, 10), 0, t0));
+	EXPECT_EQ(0u, filter.get_statistics().duplicates);
+}
+
+TEST_F(test_ais_duplicate_filter, receivers)
+{
+	ais::duplicate_filter filter;
+	const auto bits = marnav_test::make_report_bits(123456789, 10);
+
+	EXPECT_EQ(0u, filter.receivers(bits, t0));
+	EXPECT_TRUE(filter.process(bits, 2, t0));
+	EXPECT_FALSE(filter.process(bits, 5, t0));
+	EXPECT_FALSE(filter.process(bits, 63, t0));
+	EXPECT_EQ((1ull << 2) | (1ull << 5) | (1ull << 63), filter.receivers(bits, t0));
+}
+
+TEST_F(test_ais_duplicate_filter, message_passes_after_window)
+{
+	ais::duplicate_filter filter{16, 10s};
+	const auto bits = marnav_test::make_report_bits(123456789, 10);
+
+	EXPECT_TRUE(filter.process(bits, 0, t0));
+	EXPECT_FALSE(filter.process(bits, 1, t0 + 10s));
+	EXPECT_TRUE(filter.process(bits, 1, t0 + 11s));
+	EXPECT_EQ(1ull << 1, filter.receivers(bits, t0 + 11s));
+	EXPECT_EQ(0u, filter.get_statistics().evicted);
+}
+
+TEST_F(test_ais_duplicate_filter, oldest_entry_is_evicted)
+{
+	ais::duplicate_filter filter{1, 60s};
+	ASSERT_EQ(8u, filter.capacity());
+
+	const auto first = marnav_test::make_report_bits(100000000, 0);
+	EXPECT_TRUE(filter.process(first, 0, t0));
+	for (uint32_t i = 1; i <= 8; ++i)
+		EXPECT_TRUE(
+			filter.process(marnav_test::make_report_bits(100000000 + i, 0), 0, t0 + 1s));
+
+	// all entries within the window, the first message was the oldest
+	EXPECT_EQ(1u, filter.get_statistics().evicted);
+	EXPECT_EQ(0u, filter.receivers(first, t0 + 1s));
+	EXPECT_TRUE(filter.process(first, 0, t0 + 2s));
+}
+
+TEST_F(test_ais_duplicate_filter, invalid_receiver)
+{
+	ais::duplicate_filter filter;
+	EXPECT_THROW(filter.process(marnav_test::make_report_bits(123456789, 10), 64, t0),
+		std::invalid_argument);
+	EXPECT_EQ(0u, filter.get_statistics().messages);
+}
+
+TEST_F(test_ais_duplicate_filter, invalid_number_of_bits)
+{
+	ais::duplicate_filter filter;
+	ais::raw bits;
+	bits.append(1u, 6);
+	bits.append(0u, 30);
+	EXPECT_THROW(filter.process(bits, 0, t0), std::invalid_argument);
+	EXPECT_THROW(filter.receivers(bits, t0), std::invalid_argument);
+}
+
+TEST_F(test_ais_duplicate_filter, clear)
+{
+	ais::duplicate_filter filter;
+	const auto bits = marnav_test::make_report_bits(123456789, 10);
+
+	EXPECT_TRUE(filter.process(bits, 0, t0));
+	filter.clear();
+	EXPECT_TRUE(filter.process(bits, 0, t0));
+	EXPECT_EQ(2u, filter.get_statistics().messages);
+
+	filter.reset_statistics();
+	EXPECT_EQ(0u, filter.get_statistics().messages);
+}
+}
@@ -1,4 +1,5 @@
 #include <marnav/ais/message.hpp>
+#include <marnav/ais/ais.hpp>
 #include <marnav/ais/message_01.hpp>
 #include <marnav/ais/message_05.hpp>
 #include <gtest/gtest.h>
@@ -11,6 +12,27 @@ class test_ais_message : public ::testing::Test
 {
 };
 
+/// Exposes the layout functions of `binary_data` to the tests.
+struct layout_data : public ais::binary_data {
+	bitset_value<6, 2, uint32_t> a = 0;
+	bitset_value<8, 30, uint32_t> b = 0;
+	bitset_value<38, 2, std::string> c = std::string{};
+	bitset_value<50, 1, bool> d = false;
+
+	template <class Self>
+	static auto fields(Self & s)
+	{
+		return std::tie(s.a, s.b, s.c, s.d);
+	}
+
+	using binary_data::get_fields;
+	using binary_data::is_valid_layout;
+	using binary_data::set_fields;
+
+	template <std::size_t Offset, std::size_t Count, typename T>
+	using value = bitset_value<Offset, Count, T>;
+};
+
 TEST_F(test_ais_message, message_cast_nullptr)
 {
 	std::unique_ptr<ais::message> m;
@@ -23,4 +45,62 @@ TEST_F(test_ais_message, message_cast_wrong_id)
 	std::unique_ptr<ais::message> m(new ais::message_01);
 	EXPECT_ANY_THROW(ais::message_cast<ais::message_05>(m));
 }
+
+TEST_F(test_ais_message, view_header)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+
+	const ais::message_view view{bits};
+	EXPECT_EQ(ais::message_id::position_report_class_a, view.type());
+	EXPECT_EQ(0u, view.get_repeat_indicator());
+	EXPECT_EQ(205344990u, view.get_mmsi());
+	EXPECT_EQ(bits.size(), view.get_raw().size());
+}
+
+TEST_F(test_ais_message, view_header_too_short)
+{
+	ais::raw bits(37);
+	EXPECT_THROW(ais::message_view{bits}, std::invalid_argument);
+}
+
+TEST_F(test_ais_message, layout_valid)
+{
+	using layout = decltype(layout_data::fields(std::declval<layout_data &>()));
+	static_assert(layout_data::is_valid_layout<layout>(6, 51), "");
+	static_assert(layout_data::is_valid_layout<layout>(0, 64), "");
+	static_assert(!layout_data::is_valid_layout<layout>(7, 51), "");
+	static_assert(!layout_data::is_valid_layout<layout>(6, 50), "");
+}
+
+TEST_F(test_ais_message, layout_overlap_and_order)
+{
+	using v1 = layout_data::value<6, 4, uint32_t>;
+	using v2 = layout_data::value<9, 4, uint32_t>;
+	using v3 = layout_data::value<10, 2, std::string>;
+
+	static_assert(layout_data::is_valid_layout<std::tuple<v1 &, v3 &>>(6, 22), "");
+	static_assert(!layout_data::is_valid_layout<std::tuple<v1 &, v3 &>>(6, 21), "");
+	static_assert(!layout_data::is_valid_layout<std::tuple<v1 &, v2 &>>(6, 22), "");
+	static_assert(!layout_data::is_valid_layout<std::tuple<v3 &, v1 &>>(6, 22), "");
+}
+
+TEST_F(test_ais_message, layout_get_set_fields)
+{
+	layout_data data;
+	data.a = 3;
+	data.b = 123456789;
+	data.c = "AB";
+	data.d = true;
+
+	ais::raw bits(56);
+	layout_data::set_fields(bits, layout_data::fields(static_cast<const layout_data &>(data)));
+
+	layout_data result;
+	layout_data::get_fields(bits, layout_data::fields(result));
+	EXPECT_EQ(3u, result.a);
+	EXPECT_EQ(123456789u, result.b);
+	EXPECT_STREQ("AB", result.c.get().c_str());
+	EXPECT_TRUE(result.d);
+}
 }
@@ -244,4 +244,53 @@ TEST_F(test_ais_message_01, github_issue_51_roundtrip_negative_east)
 	EXPECT_EQ(geo::longitude::hemisphere::west, lon->hem());
 	EXPECT_NEAR(deg, lon->get(), 1e-5);
 }
+
+TEST_F(test_ais_message_01, view)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+
+	const auto m = ais::create_message<ais::message_01>(bits);
+	const ais::message_01::view view{bits};
+
+	EXPECT_EQ(ais::message_id::position_report_class_a, view.type());
+	EXPECT_EQ(m.get_repeat_indicator(), view.get_repeat_indicator());
+	EXPECT_EQ(m.get_mmsi(), view.get_mmsi());
+	EXPECT_EQ(m.get_nav_status(), view.get_nav_status());
+	EXPECT_EQ(m.get_rot().raw(), view.get_rot().raw());
+	EXPECT_EQ(m.get_sog(), view.get_sog());
+	EXPECT_EQ(m.get_position_accuracy(), view.get_position_accuracy());
+	EXPECT_EQ(m.get_cog(), view.get_cog());
+	EXPECT_EQ(m.get_hdg(), view.get_hdg());
+	EXPECT_EQ(m.get_timestamp(), view.get_timestamp());
+	EXPECT_EQ(m.get_maneuver_indicator(), view.get_maneuver_indicator());
+	EXPECT_EQ(m.get_raim(), view.get_raim());
+	EXPECT_EQ(m.get_radio_status(), view.get_radio_status());
+	EXPECT_EQ(m.get_lon(), view.get_lon());
+	EXPECT_EQ(m.get_lat(), view.get_lat());
+}
+
+TEST_F(test_ais_message_01, view_types_2_and_3)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+
+	bits.set(2u, 0, 6);
+	EXPECT_NO_THROW(ais::message_01::view{bits});
+	bits.set(3u, 0, 6);
+	EXPECT_NO_THROW(ais::message_01::view{bits});
+}
+
+TEST_F(test_ais_message_01, view_invalid)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+
+	bits.set(4u, 0, 6);
+	EXPECT_THROW(ais::message_01::view{bits}, std::invalid_argument);
+
+	bits.set(1u, 0, 6);
+	bits.append(0u, 1);
+	EXPECT_THROW(ais::message_01::view{bits}, std::invalid_argument);
+}
 }
@@ -226,4 +226,61 @@ TEST_F(test_ais_message_05, set_invalid_draught)
 
 	EXPECT_ANY_THROW(m.set_draught(units::meters{-1.5}));
 }
+
+TEST_F(test_ais_message_05, view)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 0);
+	ais::append_payload(bits, "1@0000000000000", 2);
+
+	const auto m = ais::create_message<ais::message_05>(bits);
+	const ais::message_05::view view{bits};
+
+	EXPECT_EQ(m.get_repeat_indicator(), view.get_repeat_indicator());
+	EXPECT_EQ(m.get_mmsi(), view.get_mmsi());
+	EXPECT_EQ(m.get_ais_version(), view.get_ais_version());
+	EXPECT_EQ(m.get_imo_number(), view.get_imo_number());
+	EXPECT_STREQ(m.get_callsign().c_str(), view.get_callsign().c_str());
+	EXPECT_STREQ(m.get_shipname().c_str(), view.get_shipname().c_str());
+	EXPECT_EQ(m.get_shiptype(), view.get_shiptype());
+	EXPECT_EQ(m.get_vessel_dimension().get_to_bow(), view.get_vessel_dimension().get_to_bow());
+	EXPECT_EQ(m.get_vessel_dimension().get_to_starboard(),
+		view.get_vessel_dimension().get_to_starboard());
+	EXPECT_EQ(m.get_epfd_fix(), view.get_epfd_fix());
+	EXPECT_EQ(m.get_eta_month(), view.get_eta_month());
+	EXPECT_EQ(m.get_eta_day(), view.get_eta_day());
+	EXPECT_EQ(m.get_eta_hour(), view.get_eta_hour());
+	EXPECT_EQ(m.get_eta_minute(), view.get_eta_minute());
+	EXPECT_EQ(m.get_draught(), view.get_draught());
+	EXPECT_STREQ(m.get_destination().c_str(), view.get_destination().c_str());
+	EXPECT_EQ(m.get_dte(), view.get_dte());
+}
+
+TEST_F(test_ais_message_05, view_trimmed_strings)
+{
+	ais::message_05 m;
+	m.set_callsign("AB CD");
+	m.set_shipname("TITANIC     ");
+	m.set_destination("NEW YORK@XYZ");
+	const auto bits = ais::encode_bits(m);
+
+	const ais::message_05::view view{bits};
+	EXPECT_EQ("AB CD", view.get_callsign());
+	EXPECT_EQ("TITANIC", view.get_shipname());
+	EXPECT_EQ("NEW YORK", view.get_destination());
+
+	const auto decoded = ais::create_message<ais::message_05>(bits);
+	EXPECT_EQ(view.get_shipname(), decoded.get_shipname());
+	EXPECT_EQ(view.get_destination(), decoded.get_destination());
+}
+
+TEST_F(test_ais_message_05, view_422)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 0);
+	ais::append_payload(bits, "1@0000000000000", 4);
+
+	const ais::message_05::view view{bits};
+	EXPECT_EQ(ais::data_terminal::not_ready, view.get_dte());
+}
 }
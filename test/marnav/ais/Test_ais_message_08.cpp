@@ -91,6 +91,25 @@ TEST_F(test_ais_message_08, get_binary_200_10)
 	}
 }
 
+TEST_F(test_ais_message_08, read_binary_in_place)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "83aGF=hj2P00000001>hj@QU6SL0", 0);
+
+	auto m = ais::create_message<ais::message_08>(bits);
+	ais::binary_200_10 expected;
+	m.read_binary(expected);
+
+	ais::binary_200_10 b;
+	b.read_from(ais::raw_view{bits, ais::message_08::SIZE_BITS_HEAD,
+		bits.size() - ais::message_08::SIZE_BITS_HEAD});
+
+	EXPECT_EQ(expected.get_vessel_id(), b.get_vessel_id());
+	EXPECT_EQ(expected.get_length(), b.get_length());
+	EXPECT_EQ(expected.get_beam(), b.get_beam());
+	EXPECT_EQ(expected.get_draught(), b.get_draught());
+}
+
 TEST_F(test_ais_message_08, set_binary_200_10)
 {
 	ais::message_08 m;
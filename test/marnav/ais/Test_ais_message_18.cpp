@@ -96,4 +96,38 @@ TEST_F(test_ais_message_18, get_lon)
 
 	EXPECT_DOUBLE_EQ(expected, decoded);
 }
+
+TEST_F(test_ais_message_18, view)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "B000000002=Agp=18D3Q3wv00000", 0);
+
+	const auto m = ais::create_message<ais::message_18>(bits);
+	const ais::message_18::view view{bits};
+
+	EXPECT_EQ(m.get_repeat_indicator(), view.get_repeat_indicator());
+	EXPECT_EQ(m.get_mmsi(), view.get_mmsi());
+	EXPECT_EQ(m.get_sog(), view.get_sog());
+	EXPECT_EQ(m.get_position_accuracy(), view.get_position_accuracy());
+	EXPECT_EQ(m.get_cog(), view.get_cog());
+	EXPECT_EQ(m.get_hdg(), view.get_hdg());
+	EXPECT_EQ(m.get_timestamp(), view.get_timestamp());
+	EXPECT_EQ(m.get_cs_unit(), view.get_cs_unit());
+	EXPECT_EQ(m.get_display_flag(), view.get_display_flag());
+	EXPECT_EQ(m.get_dsc_flag(), view.get_dsc_flag());
+	EXPECT_EQ(m.get_band_flag(), view.get_band_flag());
+	EXPECT_EQ(m.get_message_22_flag(), view.get_message_22_flag());
+	EXPECT_EQ(m.get_assigned(), view.get_assigned());
+	EXPECT_EQ(m.get_raim(), view.get_raim());
+	EXPECT_EQ(m.get_radio_status(), view.get_radio_status());
+	EXPECT_EQ(m.get_lon(), view.get_lon());
+	EXPECT_EQ(m.get_lat(), view.get_lat());
+}
+
+TEST_F(test_ais_message_18, view_invalid)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "133m@ogP00PD;88MD5MTDww@2D7k", 0);
+	EXPECT_THROW(ais::message_18::view{bits}, std::invalid_argument);
+}
 }
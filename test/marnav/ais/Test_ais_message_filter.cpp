@@ -0,0 +1,82 @@
+#include <marnav/ais/message_filter.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+
+class test_ais_message_filter : public ::testing::Test
+{
+public:
+	static ais::message_header make_header(ais::message_id type, uint32_t mmsi)
+	{
+		ais::message_header h;
+		h.type = type;
+		h.mmsi = utils::mmsi{mmsi};
+		return h;
+	}
+};
+
+TEST_F(test_ais_message_filter, default_accepts_all)
+{
+	const ais::message_filter f;
+
+	EXPECT_TRUE(f.accepts_all());
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::position_report_class_a, 1)));
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::static_data_report, 2)));
+	EXPECT_TRUE(f.accepts(std::string{"1"}));
+}
+
+TEST_F(test_ais_message_filter, types)
+{
+	ais::message_filter f;
+	f.accept_type(ais::message_id::position_report_class_a)
+		.accept_type(ais::message_id::standard_class_b_cs_position_report);
+
+	EXPECT_FALSE(f.accepts_all());
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::position_report_class_a, 1)));
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::standard_class_b_cs_position_report, 1)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::base_station_report, 1)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::NONE, 1)));
+}
+
+TEST_F(test_ais_message_filter, mmsis)
+{
+	ais::message_filter f;
+	f.accept_mmsi(utils::mmsi{300}).accept_mmsi(utils::mmsi{100}).accept_mmsi(utils::mmsi{200});
+	f.accept_mmsi(utils::mmsi{200});
+
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::position_report_class_a, 100)));
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::base_station_report, 200)));
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::position_report_class_a, 300)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::position_report_class_a, 150)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::position_report_class_a, 0)));
+}
+
+TEST_F(test_ais_message_filter, types_and_mmsis)
+{
+	ais::message_filter f;
+	f.accept_type(ais::message_id::position_report_class_a).accept_mmsi(utils::mmsi{100});
+
+	EXPECT_TRUE(f.accepts(make_header(ais::message_id::position_report_class_a, 100)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::position_report_class_a, 101)));
+	EXPECT_FALSE(f.accepts(make_header(ais::message_id::base_station_report, 100)));
+}
+
+TEST_F(test_ais_message_filter, payload)
+{
+	ais::message_filter f;
+	f.accept_mmsi(utils::mmsi{205344990});
+
+	EXPECT_TRUE(f.accepts(std::string{"133m@ogP00PD;88MD5MTDww@2D7k"}));
+	EXPECT_FALSE(f.accepts(std::string{"B000000002=Agp=18D3Q3wv00000"}));
+}
+
+TEST_F(test_ais_message_filter, payload_too_short)
+{
+	ais::message_filter f;
+	f.accept_mmsi(utils::mmsi{1});
+
+	EXPECT_TRUE(f.accepts(std::string{"133m@o"}));
+}
+}
@@ -0,0 +1,179 @@
+#include <marnav/ais/position_columns.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_18.hpp>
+#include <marnav/ais/message_19.hpp>
+#include <gtest/gtest.h>
+#include "make_report.hpp"
+#include <cmath>
+
+namespace
+{
+using namespace marnav;
+
+class test_ais_position_columns : public ::testing::Test
+{
+public:
+	struct converted {
+		std::vector<double> lat, lon, sog, cog;
+		std::vector<uint8_t> lat_valid, lon_valid, sog_valid, cog_valid;
+	};
+
+	static converted convert(const ais::position_columns & c)
+	{
+		const auto n = c.size();
+		converted r{std::vector<double>(n), std::vector<double>(n), std::vector<double>(n),
+			std::vector<double>(n), std::vector<uint8_t>(n), std::vector<uint8_t>(n),
+			std::vector<uint8_t>(n), std::vector<uint8_t>(n)};
+		ais::convert_latitudes(c.latitudes().data(), n, r.lat.data(), r.lat_valid.data());
+		ais::convert_longitudes(c.longitudes().data(), n, r.lon.data(), r.lon_valid.data());
+		ais::convert_sog(c.sog().data(), n, r.sog.data(), r.sog_valid.data());
+		ais::convert_cog(c.cog().data(), n, r.cog.data(), r.cog_valid.data());
+		return r;
+	}
+};
+
+TEST_F(test_ais_position_columns, construction)
+{
+	ais::position_columns columns;
+	EXPECT_EQ(0u, columns.size());
+}
+
+TEST_F(test_ais_position_columns, same_as_getters)
+{
+	ais::position_columns columns;
+	std::vector<ais::raw> reports;
+	reports.push_back(ais::encode_bits(marnav_test::make_report(1, 47.5, 8.25, 12.3, 270.1)));
+	reports.push_back(ais::encode_bits(marnav_test::make_report(2, -33.9, -151.2, 0.0, 0.0)));
+	reports.push_back(ais::encode_bits(
+		marnav_test::make_report<ais::message_18>(3, 89.9, 179.9, 102.2, 359.9)));
+	{
+		ais::message_19 m;
+		m.set_mmsi(utils::mmsi{4});
+		m.set_lat(geo::latitude{-89.9});
+		m.set_lon(geo::longitude{-179.9});
+		m.set_sog(units::knots{5.5});
+		m.set_cog(900); // in 0.1 degrees
+		reports.push_back(ais::encode_bits(m));
+	}
+	for (const auto & bits : reports)
+		EXPECT_TRUE(columns.append(bits));
+	ASSERT_EQ(4u, columns.size());
+
+	const auto r = convert(columns);
+	for (std::size_t i = 0; i < reports.size(); ++i) {
+		const auto m = ais::make_message(reports[i]);
+		double lat = 0.0, lon = 0.0, sog = 0.0, cog = 0.0;
+		if (m->type() == ais::message_id::position_report_class_a) {
+			const auto & t = static_cast<const ais::message_01 &>(*m);
+			lat = *t.get_lat();
+			lon = *t.get_lon();
+			sog = t.get_sog()->value();
+			cog = *t.get_cog();
+		} else if (m->type() == ais::message_id::standard_class_b_cs_position_report) {
+			const auto & t = static_cast<const ais::message_18 &>(*m);
+			lat = *t.get_lat();
+			lon = *t.get_lon();
+			sog = t.get_sog()->value();
+			cog = *t.get_cog();
+		} else {
+			const auto & t = static_cast<const ais::message_19 &>(*m);
+			lat = *t.get_lat();
+			lon = *t.get_lon();
+			sog = t.get_sog()->value();
+			cog = 0.1 * t.get_cog();
+		}
+
+		EXPECT_EQ(i + 1, columns.mmsi()[i]);
+		EXPECT_NEAR(lat, r.lat[i], 1e-6);
+		EXPECT_NEAR(lon, r.lon[i], 1e-6);
+		EXPECT_NEAR(sog, r.sog[i], 1e-9);
+		EXPECT_NEAR(cog, r.cog[i], 1e-9);
+		EXPECT_EQ(1u, r.lat_valid[i]);
+		EXPECT_EQ(1u, r.lon_valid[i]);
+		EXPECT_EQ(1u, r.sog_valid[i]);
+		EXPECT_EQ(1u, r.cog_valid[i]);
+	}
+}
+
+TEST_F(test_ais_position_columns, not_available)
+{
+	ais::message_01 m;
+	m.set_mmsi(utils::mmsi{123456789});
+
+	ais::position_columns columns;
+	EXPECT_TRUE(columns.append(ais::encode_bits(m)));
+
+	const auto r = convert(columns);
+	EXPECT_TRUE(std::isnan(r.lat[0]));
+	EXPECT_TRUE(std::isnan(r.lon[0]));
+	EXPECT_TRUE(std::isnan(r.sog[0]));
+	EXPECT_TRUE(std::isnan(r.cog[0]));
+	EXPECT_EQ(0u, r.lat_valid[0]);
+	EXPECT_EQ(0u, r.lon_valid[0]);
+	EXPECT_EQ(0u, r.sog_valid[0]);
+	EXPECT_EQ(0u, r.cog_valid[0]);
+}
+
+TEST_F(test_ais_position_columns, out_of_range)
+{
+	// raw values, in 1/10000 minutes: +/-90 and +/-180 degrees are valid
+	const std::vector<uint32_t> lat
+		= {54000000u, (1u << 27) - 54000000u, 54000001u, (1u << 27) - 54000001u};
+	const std::vector<uint32_t> lon
+		= {108000000u, (1u << 28) - 108000000u, 108000001u, (1u << 28) - 108000001u};
+	const std::vector<uint32_t> cog = {3599u, 3600u, 3601u, 4095u};
+	const std::vector<uint32_t> sog = {1021u, 1022u, 1023u, 0u};
+
+	std::vector<double> result(4);
+	std::vector<uint8_t> valid(4);
+
+	ais::convert_latitudes(lat.data(), 4, result.data(), valid.data());
+	EXPECT_EQ(90.0, result[0]);
+	EXPECT_EQ(-90.0, result[1]);
+	EXPECT_EQ((std::vector<uint8_t>{1, 1, 0, 0}), valid);
+
+	ais::convert_longitudes(lon.data(), 4, result.data(), valid.data());
+	EXPECT_EQ(180.0, result[0]);
+	EXPECT_EQ(-180.0, result[1]);
+	EXPECT_EQ((std::vector<uint8_t>{1, 1, 0, 0}), valid);
+
+	ais::convert_cog(cog.data(), 4, result.data(), valid.data());
+	EXPECT_EQ((std::vector<uint8_t>{1, 0, 0, 0}), valid);
+
+	ais::convert_sog(sog.data(), 4, result.data(), valid.data());
+	EXPECT_NEAR(102.2, result[1], 1e-9);
+	EXPECT_EQ((std::vector<uint8_t>{1, 1, 0, 1}), valid);
+}
+
+TEST_F(test_ais_position_columns, other_messages_are_ignored)
+{
+	ais::message_05 m;
+	m.set_mmsi(utils::mmsi{123456789});
+
+	ais::position_columns columns;
+	EXPECT_FALSE(columns.append(ais::encode_bits(m)));
+	EXPECT_EQ(0u, columns.size());
+}
+
+TEST_F(test_ais_position_columns, invalid_number_of_bits)
+{
+	auto bits = ais::encode_bits(marnav_test::make_report(1, 47.5, 8.25, 12.3, 270.1));
+	bits.append(0u, 6);
+
+	ais::position_columns columns;
+	EXPECT_THROW(columns.append(bits), std::invalid_argument);
+	EXPECT_EQ(0u, columns.size());
+}
+
+TEST_F(test_ais_position_columns, clear)
+{
+	ais::position_columns columns;
+	columns.reserve(16);
+	columns.append(ais::encode_bits(marnav_test::make_report(1, 47.5, 8.25, 12.3, 270.1)));
+	columns.clear();
+	EXPECT_EQ(0u, columns.size());
+	EXPECT_TRUE(columns.latitudes().empty());
+}
+}
@@ -0,0 +1,214 @@
+#include <marnav/ais/static_data_cache.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_19.hpp>
+#include <marnav/ais/message_24.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+
+class test_ais_static_data_cache : public ::testing::Test
+{
+public:
+	static ais::message_24 make_part_a(uint32_t mmsi, const std::string & name)
+	{
+		ais::message_24 m;
+		m.set_mmsi(utils::mmsi{mmsi});
+		m.set_part_number(ais::message_24::part::A);
+		m.set_shipname(name);
+		return m;
+	}
+
+	static ais::message_24 make_part_b(uint32_t mmsi, const std::string & callsign)
+	{
+		ais::message_24 m;
+		m.set_mmsi(utils::mmsi{mmsi});
+		m.set_part_number(ais::message_24::part::B);
+		m.set_callsign(callsign);
+		m.set_shiptype(ais::ship_type::sailing);
+		m.set_vessel_dimension(ais::vessel_dimension{units::meters{8}, units::meters{4},
+			units::meters{2}, units::meters{2}});
+		return m;
+	}
+};
+
+TEST_F(test_ais_static_data_cache, construction)
+{
+	ais::static_data_cache cache;
+	EXPECT_EQ(0u, cache.size());
+	EXPECT_EQ(nullptr, cache.find(utils::mmsi{123456789}));
+}
+
+TEST_F(test_ais_static_data_cache, join_parts_of_message_24)
+{
+	ais::static_data_cache cache;
+
+	EXPECT_TRUE(cache.update(ais::encode_bits(make_part_a(123456789, "SAILOR"))));
+	EXPECT_TRUE(cache.update(ais::encode_bits(make_part_b(123456789, "ABC"))));
+	EXPECT_EQ(1u, cache.size());
+
+	const auto * data = cache.find(utils::mmsi{123456789});
+	ASSERT_NE(nullptr, data);
+	EXPECT_EQ(123456789u, data->mmsi);
+	EXPECT_EQ("SAILOR", data->shipname);
+	EXPECT_EQ("ABC", data->callsign);
+	EXPECT_EQ(ais::ship_type::sailing, data->shiptype);
+	EXPECT_EQ(12.0, data->dimension.length().value());
+	EXPECT_EQ(2u, data->revision);
+}
+
+TEST_F(test_ais_static_data_cache, unchanged_repeats_are_not_decoded)
+{
+	ais::static_data_cache cache;
+	const auto a = ais::encode_bits(make_part_a(123456789, "SAILOR"));
+	const auto b = ais::encode_bits(make_part_b(123456789, "ABC"));
+
+	EXPECT_TRUE(cache.update(a));
+	EXPECT_TRUE(cache.update(b));
+	for (int i = 0; i < 10; ++i) {
+		EXPECT_FALSE(cache.update(a));
+		EXPECT_FALSE(cache.update(b));
+	}
+
+	const auto & stats = cache.get_statistics();
+	EXPECT_EQ(22u, stats.messages);
+	EXPECT_EQ(20u, stats.unchanged);
+	EXPECT_EQ(2u, stats.decoded);
+	EXPECT_EQ(2u, cache.find(utils::mmsi{123456789})->revision);
+}
+
+TEST_F(test_ais_static_data_cache, changed_content_is_decoded)
+{
+	ais::static_data_cache cache;
+
+	EXPECT_TRUE(cache.update(ais::encode_bits(make_part_a(123456789, "SAILOR"))));
+	EXPECT_TRUE(cache.update(ais::encode_bits(make_part_a(123456789, "SAILOR II"))));
+	EXPECT_EQ("SAILOR II", cache.find(utils::mmsi{123456789})->shipname);
+	EXPECT_EQ(2u, cache.get_statistics().decoded);
+}
+
+TEST_F(test_ais_static_data_cache, changed_bits_with_same_content)
+{
+	ais::static_data_cache cache;
+
+	auto b = make_part_b(123456789, "ABC");
+	EXPECT_TRUE(cache.update(ais::encode_bits(b)));
+
+	// vendor id is not part of the static data record
+	b.set_vendor_id("XYZ");
+	EXPECT_FALSE(cache.update(ais::encode_bits(b)));
+	EXPECT_EQ(2u, cache.get_statistics().decoded);
+	EXPECT_EQ(1u, cache.find(utils::mmsi{123456789})->revision);
+}
+
+TEST_F(test_ais_static_data_cache, message_05)
+{
+	ais::static_data_cache cache;
+
+	ais::message_05 m;
+	m.set_mmsi(utils::mmsi{211234560});
+	m.set_shipname("TITANIC");
+	m.set_callsign("MGY");
+	m.set_imo_number(1234567);
+	m.set_shiptype(ais::ship_type::passenger);
+	m.set_destination("NEW YORK");
+
+	EXPECT_TRUE(cache.update(ais::encode_bits(m)));
+
+	// voyage related data is not part of the fingerprint
+	m.set_destination("HALIFAX");
+	EXPECT_FALSE(cache.update(ais::encode_bits(m)));
+	EXPECT_EQ(1u, cache.get_statistics().decoded);
+
+	const auto * data = cache.find(utils::mmsi{211234560});
+	ASSERT_NE(nullptr, data);
+	EXPECT_EQ("TITANIC", data->shipname);
+	EXPECT_EQ("MGY", data->callsign);
+	EXPECT_EQ(1234567u, data->imo_number);
+	EXPECT_EQ(ais::ship_type::passenger, data->shiptype);
+}
+
+TEST_F(test_ais_static_data_cache, message_19_position_is_ignored)
+{
+	ais::static_data_cache cache;
+
+	ais::message_19 m;
+	m.set_mmsi(utils::mmsi{211234560});
+	m.set_shipname("FISHER");
+	m.set_shiptype(ais::ship_type::fishing);
+	m.set_lat(geo::latitude{10.0});
+	EXPECT_TRUE(cache.update(ais::encode_bits(m)));
+
+	m.set_lat(geo::latitude{10.1});
+	EXPECT_FALSE(cache.update(ais::encode_bits(m)));
+	EXPECT_EQ(1u, cache.get_statistics().unchanged);
+	EXPECT_EQ("FISHER", cache.find(utils::mmsi{211234560})->shipname);
+}
+
+TEST_F(test_ais_static_data_cache, other_messages_are_ignored)
+{
+	ais::static_data_cache cache;
+
+	ais::message_01 m;
+	m.set_mmsi(utils::mmsi{123456789});
+	EXPECT_FALSE(cache.update(ais::encode_bits(m)));
+	EXPECT_FALSE(cache.update(m));
+	EXPECT_FALSE(cache.update(ais::encode_bits(make_part_a(0, "NOBODY"))));
+	EXPECT_EQ(0u, cache.size());
+	EXPECT_EQ(0u, cache.get_statistics().messages);
+}
+
+TEST_F(test_ais_static_data_cache, invalid_number_of_bits)
+{
+	ais::static_data_cache cache;
+
+	auto bits = ais::encode_bits(make_part_b(123456789, "ABC"));
+	ais::raw short_bits;
+	short_bits.append(bits.get<uint64_t>(0, 64), 64);
+	short_bits.append(bits.get<uint64_t>(64, 64), 64);
+	EXPECT_THROW(cache.update(short_bits), std::invalid_argument);
+	EXPECT_EQ(0u, cache.size());
+}
+
+TEST_F(test_ais_static_data_cache, update_decoded_message)
+{
+	ais::static_data_cache cache;
+
+	const auto a = make_part_a(123456789, "SAILOR");
+	EXPECT_TRUE(cache.update(a));
+	EXPECT_FALSE(cache.update(a));
+	EXPECT_TRUE(cache.update(make_part_b(123456789, "ABC")));
+
+	const auto * data = cache.find(utils::mmsi{123456789});
+	ASSERT_NE(nullptr, data);
+	EXPECT_EQ("SAILOR", data->shipname);
+	EXPECT_EQ("ABC", data->callsign);
+}
+
+TEST_F(test_ais_static_data_cache, raw_data_after_decoded_message)
+{
+	ais::static_data_cache cache;
+
+	const auto a = ais::encode_bits(make_part_a(123456789, "SAILOR"));
+	EXPECT_TRUE(cache.update(a));
+	EXPECT_TRUE(cache.update(make_part_a(123456789, "WINDY")));
+	EXPECT_TRUE(cache.update(a));
+
+	const auto * data = cache.find(utils::mmsi{123456789});
+	ASSERT_NE(nullptr, data);
+	EXPECT_EQ("SAILOR", data->shipname);
+	EXPECT_EQ(0u, cache.get_statistics().unchanged);
+}
+
+TEST_F(test_ais_static_data_cache, clear)
+{
+	ais::static_data_cache cache;
+	cache.update(make_part_a(123456789, "SAILOR"));
+	cache.clear();
+	EXPECT_EQ(0u, cache.size());
+	EXPECT_EQ(1u, cache.get_statistics().messages);
+}
+}
@@ -0,0 +1,275 @@
+#include <marnav/ais/track_store.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_18.hpp>
+#include <gtest/gtest.h>
+#include "make_report.hpp"
+#include <cmath>
+
+namespace
+{
+using namespace marnav;
+using namespace std::chrono_literals;
+
+class test_ais_track_store : public ::testing::Test
+{
+public:
+	using clock = ais::track_store::clock;
+
+	const clock::time_point t0 = clock::time_point{} + 1000h;
+};
+
+TEST_F(test_ais_track_store, construction)
+{
+	ais::track_store tracks;
+	EXPECT_EQ(0u, tracks.size());
+	EXPECT_EQ(8u, tracks.depth());
+
+	EXPECT_THROW(ais::track_store{1}, std::invalid_argument);
+}
+
+TEST_F(test_ais_track_store, ignores_other_messages)
+{
+	ais::track_store tracks;
+
+	ais::message_05 m05;
+	m05.set_mmsi(utils::mmsi{123456789});
+	EXPECT_FALSE(tracks.update(m05, t0));
+
+	ais::message_01 no_position;
+	no_position.set_mmsi(utils::mmsi{123456789});
+	EXPECT_FALSE(tracks.update(no_position, t0));
+
+	EXPECT_EQ(0u, tracks.size());
+}
+
+TEST_F(test_ais_track_store, invalid_number_of_bits)
+{
+	auto bits = ais::encode_bits(marnav_test::make_report(1, 47.0, 8.0));
+	bits.append(0u, 6);
+
+	ais::track_store tracks;
+	EXPECT_THROW(tracks.update(bits, t0), std::invalid_argument);
+	EXPECT_EQ(0u, tracks.size());
+}
+
+TEST_F(test_ais_track_store, rejects_reports_out_of_order)
+{
+	ais::track_store tracks;
+	EXPECT_TRUE(tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0));
+	EXPECT_FALSE(tracks.update(marnav_test::make_report(1, 47.1, 8.0), t0));
+	EXPECT_FALSE(tracks.update(marnav_test::make_report(1, 47.1, 8.0), t0 - 1s));
+	EXPECT_TRUE(tracks.update(marnav_test::make_report(1, 47.1, 8.0), t0 + 1s));
+	EXPECT_EQ(2u, tracks.track(utils::mmsi{1}).size());
+}
+
+TEST_F(test_ais_track_store, ring_buffer)
+{
+	ais::track_store tracks{3};
+	for (int i = 0; i < 5; ++i)
+		tracks.update(
+			marnav_test::make_report(1, 10.0 + i, 20.0, 0.1 * i, 10.0 * i), t0 + i * 10s);
+
+	const auto track = tracks.track(utils::mmsi{1});
+	ASSERT_EQ(3u, track.size());
+	for (std::size_t i = 0; i < track.size(); ++i) {
+		EXPECT_EQ(t0 + static_cast<int>(i + 2) * 10s, track[i].time);
+		EXPECT_NEAR(12.0 + i, track[i].pos.lat().get(), 1e-6);
+		EXPECT_NEAR(20.0, track[i].pos.lon().get(), 1e-6);
+		EXPECT_NEAR(0.1 * (i + 2), track[i].sog->value(), 1e-9);
+		EXPECT_NEAR(10.0 * (i + 2), *track[i].cog, 1e-9);
+	}
+
+	EXPECT_TRUE(tracks.track(utils::mmsi{2}).empty());
+}
+
+TEST_F(test_ais_track_store, interpolation)
+{
+	ais::track_store tracks;
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0);
+	tracks.update(marnav_test::make_report(1, 47.2, 8.4), t0 + 60s);
+	tracks.update(marnav_test::make_report(1, 47.4, 8.4), t0 + 120s);
+
+	const auto p1 = tracks.position_at(utils::mmsi{1}, t0 + 15s);
+	ASSERT_TRUE(p1);
+	EXPECT_NEAR(47.05, p1->lat().get(), 1e-6);
+	EXPECT_NEAR(8.1, p1->lon().get(), 1e-6);
+
+	const auto p2 = tracks.position_at(utils::mmsi{1}, t0 + 90s);
+	ASSERT_TRUE(p2);
+	EXPECT_NEAR(47.3, p2->lat().get(), 1e-6);
+	EXPECT_NEAR(8.4, p2->lon().get(), 1e-6);
+
+	EXPECT_FALSE(tracks.position_at(utils::mmsi{1}, t0 - 1s));
+	EXPECT_FALSE(tracks.position_at(utils::mmsi{2}, t0));
+}
+
+TEST_F(test_ais_track_store, interpolation_across_antimeridian)
+{
+	ais::track_store tracks;
+	tracks.update(marnav_test::make_report(1, 0.0, 179.9), t0);
+	tracks.update(marnav_test::make_report(1, 0.0, -179.9), t0 + 60s);
+
+	const auto p = tracks.position_at(utils::mmsi{1}, t0 + 15s);
+	ASSERT_TRUE(p);
+	EXPECT_NEAR(179.95, p->lon().get(), 1e-6);
+
+	const auto q = tracks.position_at(utils::mmsi{1}, t0 + 45s);
+	ASSERT_TRUE(q);
+	EXPECT_NEAR(-179.95, q->lon().get(), 1e-6);
+}
+
+TEST_F(test_ais_track_store, dead_reckoning_straight)
+{
+	ais::track_store tracks{8, 1h};
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0, 10.0, 0.0), t0);
+	tracks.update(marnav_test::make_report(2, 60.0, 8.0, 6.0, 90.0), t0);
+
+	// 10 knots north for 30 minutes: 5 nautical miles
+	const auto p1 = tracks.position_at(utils::mmsi{1}, t0 + 30min);
+	ASSERT_TRUE(p1);
+	EXPECT_NEAR(47.0 + 5.0 / 60.0, p1->lat().get(), 1e-6);
+	EXPECT_NEAR(8.0, p1->lon().get(), 1e-6);
+
+	// 6 knots east for 1 hour at 60 degrees north: 0.2 degrees
+	const auto p2 = tracks.position_at(utils::mmsi{2}, t0 + 1h);
+	ASSERT_TRUE(p2);
+	EXPECT_NEAR(60.0, p2->lat().get(), 1e-6);
+	EXPECT_NEAR(8.2, p2->lon().get(), 1e-6);
+
+	EXPECT_FALSE(tracks.position_at(utils::mmsi{1}, t0 + 1h + 1s));
+}
+
+TEST_F(test_ais_track_store, dead_reckoning_with_rate_of_turn)
+{
+	const ais::rate_of_turn rot{30.0}; // degrees per minute, to starboard
+	ais::track_store tracks;
+	auto m = marnav_test::make_report(1, 0.0, 0.0, 10.0, 0.0);
+	m.set_rot(rot);
+	tracks.update(m, t0);
+
+	// turned by 180 degrees, east of the start by the diameter of the turning circle
+	const auto t = std::chrono::duration<double, std::ratio<60>>{180.0 / rot.value()};
+	const auto p = tracks.position_at(
+		utils::mmsi{1}, t0 + std::chrono::duration_cast<std::chrono::milliseconds>(t));
+	ASSERT_TRUE(p);
+
+	const double pi = 3.14159265358979323846;
+	const double radius = (10.0 / 60.0) / (rot.value() * pi / 180.0); // nautical miles
+	EXPECT_NEAR(0.0, p->lat().get(), 1e-5);
+	EXPECT_NEAR(2.0 * radius / 60.0, p->lon().get(), 1e-5);
+}
+
+TEST_F(test_ais_track_store, dead_reckoning_near_pole)
+{
+	ais::track_store tracks{8, 1h};
+	tracks.update(marnav_test::make_report(1, 90.0, 8.0, 100.0, 90.0), t0);
+	tracks.update(marnav_test::make_report(2, -89.99, 170.0, 100.0, 270.0), t0);
+	tracks.update(marnav_test::make_report(3, 89.0, 179.0, 102.3, 45.0), t0);
+
+	for (uint32_t mmsi = 1; mmsi <= 3; ++mmsi) {
+		for (auto t = t0; t <= t0 + 1h; t += 5min) {
+			const auto p = tracks.position_at(utils::mmsi{mmsi}, t);
+			ASSERT_TRUE(p);
+			EXPECT_LE(std::abs(p->lat().get()), 90.0);
+			EXPECT_LE(std::abs(p->lon().get()), 180.0);
+		}
+	}
+}
+
+TEST_F(test_ais_track_store, dead_reckoning_without_speed)
+{
+	ais::track_store tracks;
+	ais::message_18 m;
+	m.set_mmsi(utils::mmsi{1});
+	m.set_lat(geo::latitude{47.0});
+	m.set_lon(geo::longitude{8.0});
+	tracks.update(m, t0);
+
+	const auto p = tracks.position_at(utils::mmsi{1}, t0 + 5min);
+	ASSERT_TRUE(p);
+	EXPECT_NEAR(47.0, p->lat().get(), 1e-6);
+	EXPECT_NEAR(8.0, p->lon().get(), 1e-6);
+}
+
+TEST_F(test_ais_track_store, positions_at)
+{
+	ais::track_store tracks;
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0);
+	tracks.update(marnav_test::make_report(1, 47.2, 8.0), t0 + 60s);
+	tracks.update(marnav_test::make_report(2, 10.0, 20.0, 12.0, 180.0), t0 + 20s);
+	tracks.update(marnav_test::make_report(3, 30.0, 40.0), t0 + 40s);
+
+	const auto n = tracks.size();
+	ASSERT_EQ(3u, n);
+	EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), tracks.mmsi());
+
+	std::vector<double> lat(n);
+	std::vector<double> lon(n);
+	std::vector<uint8_t> valid(n);
+	tracks.positions_at(t0 + 30s, lat.data(), lon.data(), valid.data());
+
+	EXPECT_EQ((std::vector<uint8_t>{1, 1, 0}), valid);
+	EXPECT_NEAR(47.1, lat[0], 1e-6);
+	EXPECT_NEAR(10.0 - (12.0 * 10.0 / 3600.0) / 60.0, lat[1], 1e-6);
+	EXPECT_NEAR(20.0, lon[1], 1e-6);
+	EXPECT_TRUE(std::isnan(lat[2]));
+	EXPECT_TRUE(std::isnan(lon[2]));
+
+	for (std::size_t i = 0; i < n; ++i) {
+		const auto p = tracks.position_at(utils::mmsi{tracks.mmsi()[i]}, t0 + 30s);
+		ASSERT_EQ(valid[i] != 0, p.has_value());
+		if (p) {
+			EXPECT_EQ(lat[i], p->lat().get());
+			EXPECT_EQ(lon[i], p->lon().get());
+		}
+	}
+}
+
+TEST_F(test_ais_track_store, remove)
+{
+	ais::track_store tracks;
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0);
+	tracks.update(marnav_test::make_report(2, 10.0, 20.0), t0);
+	tracks.update(marnav_test::make_report(3, 30.0, 40.0), t0);
+
+	EXPECT_TRUE(tracks.remove(utils::mmsi{1}));
+	EXPECT_FALSE(tracks.remove(utils::mmsi{1}));
+	EXPECT_EQ((std::vector<uint32_t>{3, 2}), tracks.mmsi());
+	EXPECT_FALSE(tracks.position_at(utils::mmsi{1}, t0));
+
+	// the moved vessel keeps its track
+	const auto p = tracks.position_at(utils::mmsi{3}, t0);
+	ASSERT_TRUE(p);
+	EXPECT_NEAR(30.0, p->lat().get(), 1e-6);
+	EXPECT_TRUE(tracks.update(marnav_test::make_report(3, 31.0, 40.0), t0 + 1s));
+	EXPECT_EQ(2u, tracks.track(utils::mmsi{3}).size());
+}
+
+TEST_F(test_ais_track_store, expire)
+{
+	ais::track_store tracks{8, 1min};
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0);
+	tracks.update(marnav_test::make_report(2, 10.0, 20.0), t0);
+	tracks.update(marnav_test::make_report(3, 30.0, 40.0), t0);
+	tracks.update(marnav_test::make_report(2, 10.0, 20.0), t0 + 30s);
+
+	EXPECT_EQ(0u, tracks.expire(t0 + 1min));
+	EXPECT_EQ(2u, tracks.expire(t0 + 1min + 1s));
+	EXPECT_EQ((std::vector<uint32_t>{2}), tracks.mmsi());
+	EXPECT_TRUE(tracks.position_at(utils::mmsi{2}, t0 + 1min + 1s));
+
+	EXPECT_EQ(1u, tracks.expire(t0 + 2min));
+	EXPECT_EQ(0u, tracks.size());
+}
+
+TEST_F(test_ais_track_store, clear)
+{
+	ais::track_store tracks;
+	tracks.update(marnav_test::make_report(1, 47.0, 8.0), t0);
+	tracks.clear();
+	EXPECT_EQ(0u, tracks.size());
+	EXPECT_FALSE(tracks.position_at(utils::mmsi{1}, t0));
+}
+}
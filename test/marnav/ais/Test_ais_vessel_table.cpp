@@ -0,0 +1,248 @@
+#include <marnav/ais/vessel_table.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <marnav/ais/message_18.hpp>
+#include <marnav/ais/message_19.hpp>
+#include <marnav/ais/message_24.hpp>
+#include <marnav/ais/message_04.hpp>
+#include <gtest/gtest.h>
+#include "make_report.hpp"
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace marnav;
+
+class test_ais_vessel_table : public ::testing::Test
+{
+};
+
+TEST_F(test_ais_vessel_table, construction)
+{
+	ais::vessel_table table{100};
+	EXPECT_EQ(100u, table.capacity());
+	EXPECT_EQ(0u, table.size());
+	EXPECT_FALSE(table.find(utils::mmsi{123456789}));
+}
+
+TEST_F(test_ais_vessel_table, construction_invalid_capacity)
+{
+	EXPECT_THROW(ais::vessel_table{0}, std::invalid_argument);
+}
+
+TEST_F(test_ais_vessel_table, update_position_class_a)
+{
+	ais::vessel_table table{10};
+	const auto t = ais::vessel_table::clock::time_point{std::chrono::seconds{100}};
+
+	auto m = marnav_test::make_report(123456789, 12.5, -45.25, 12.3, 45.6);
+	m.set_hdg(47);
+	m.set_nav_status(ais::navigation_status::under_way_using_engine);
+	EXPECT_TRUE(table.update(m, t));
+	EXPECT_EQ(1u, table.size());
+
+	const auto v = table.find(utils::mmsi{123456789});
+	ASSERT_TRUE(v);
+	EXPECT_EQ(123456789u, v->mmsi);
+	ASSERT_TRUE(v->pos);
+	EXPECT_NEAR(12.5, v->pos->lat().get(), 1e-5);
+	EXPECT_NEAR(-45.25, v->pos->lon().get(), 1e-5);
+	ASSERT_TRUE(v->sog);
+	EXPECT_NEAR(12.3, v->sog->value(), 1e-6);
+	ASSERT_TRUE(v->cog);
+	EXPECT_NEAR(45.6, *v->cog, 1e-6);
+	ASSERT_TRUE(v->hdg);
+	EXPECT_EQ(47u, *v->hdg);
+	EXPECT_EQ(ais::navigation_status::under_way_using_engine, v->nav_status);
+	EXPECT_EQ(t, v->dynamic_time);
+	EXPECT_TRUE(v->shipname.empty());
+}
+
+TEST_F(test_ais_vessel_table, update_position_class_b_not_available)
+{
+	ais::vessel_table table{10};
+
+	ais::message_18 m;
+	m.set_mmsi(utils::mmsi{987654321});
+	EXPECT_TRUE(table.update(m));
+
+	const auto v = table.find(utils::mmsi{987654321});
+	ASSERT_TRUE(v);
+	EXPECT_FALSE(v->sog);
+	EXPECT_FALSE(v->cog);
+	EXPECT_FALSE(v->hdg);
+}
+
+TEST_F(test_ais_vessel_table, update_position_invalid_coordinates)
+{
+	ais::vessel_table table{10};
+
+	// longitude of 200 degrees, out of range
+	auto bits = ais::encode_bits(marnav_test::make_report(123456789, 1.0, 2.0));
+	bits.set(static_cast<int32_t>(200 * 60 * 10000), 61, 28);
+	const auto m = ais::make_message(bits);
+
+	EXPECT_TRUE(table.update(*m));
+
+	const auto v = table.find(utils::mmsi{123456789});
+	ASSERT_TRUE(v);
+	EXPECT_FALSE(v->pos);
+	EXPECT_TRUE(v->sog);
+}
+
+TEST_F(test_ais_vessel_table, update_static_data)
+{
+	ais::vessel_table table{10};
+
+	ais::message_05 m05;
+	m05.set_mmsi(utils::mmsi{123456789});
+	m05.set_shipname("TITANIC");
+	m05.set_callsign("ABC123");
+	m05.set_imo_number(9876543);
+	m05.set_shiptype(ais::ship_type::passenger);
+	m05.set_vessel_dimension(ais::vessel_dimension{units::meters{100}, units::meters{20},
+		units::meters{5}, units::meters{6}});
+
+	EXPECT_TRUE(table.update(marnav_test::make_report(123456789, 1.0, 2.0)));
+	EXPECT_TRUE(table.update(m05));
+	EXPECT_EQ(1u, table.size());
+
+	const auto v = table.find(utils::mmsi{123456789});
+	ASSERT_TRUE(v);
+	EXPECT_TRUE(v->pos);
+	EXPECT_EQ(m05.get_shipname(), v->shipname);
+	EXPECT_EQ(m05.get_callsign(), v->callsign);
+	EXPECT_EQ(9876543u, v->imo_number);
+	EXPECT_EQ(ais::ship_type::passenger, v->shiptype);
+	EXPECT_EQ(120.0, v->dimension.length().value());
+	EXPECT_EQ(11.0, v->dimension.width().value());
+}
+
+TEST_F(test_ais_vessel_table, update_static_data_report)
+{
+	ais::vessel_table table{10};
+
+	ais::message_24 a;
+	a.set_mmsi(utils::mmsi{123456789});
+	a.set_part_number(ais::message_24::part::A);
+	a.set_shipname("SAILOR");
+
+	ais::message_24 b;
+	b.set_mmsi(utils::mmsi{123456789});
+	b.set_part_number(ais::message_24::part::B);
+	b.set_callsign("XYZ");
+	b.set_shiptype(ais::ship_type::sailing);
+
+	EXPECT_TRUE(table.update(a));
+	EXPECT_TRUE(table.update(b));
+
+	const auto v = table.find(utils::mmsi{123456789});
+	ASSERT_TRUE(v);
+	EXPECT_FALSE(v->pos);
+	EXPECT_EQ(a.get_shipname(), v->shipname);
+	EXPECT_EQ(b.get_callsign(), v->callsign);
+	EXPECT_EQ(ais::ship_type::sailing, v->shiptype);
+}
+
+TEST_F(test_ais_vessel_table, update_extended_class_b_report)
+{
+	ais::vessel_table table{10};
+
+	ais::message_19 m19;
+	m19.set_mmsi(utils::mmsi{123456789});
+	m19.set_lat(geo::latitude{1.0});
+	m19.set_lon(geo::longitude{2.0});
+	m19.set_shipname("TRAWLER");
+	m19.set_shiptype(ais::ship_type::fishing);
+
+	// decoded from the raw data, the name is padded
+	EXPECT_TRUE(table.update(*ais::make_message(ais::encode_bits(m19))));
+
+	const auto v = table.find(utils::mmsi{123456789});
+	ASSERT_TRUE(v);
+	EXPECT_TRUE(v->pos);
+	EXPECT_EQ("TRAWLER", v->shipname);
+	EXPECT_EQ(ais::ship_type::fishing, v->shiptype);
+}
+
+TEST_F(test_ais_vessel_table, update_ignores_other_messages)
+{
+	ais::vessel_table table{10};
+
+	ais::message_04 m;
+	m.set_mmsi(utils::mmsi{123456789});
+	EXPECT_FALSE(table.update(m));
+	EXPECT_FALSE(table.update(marnav_test::make_report(0, 1.0, 2.0)));
+	EXPECT_EQ(0u, table.size());
+}
+
+TEST_F(test_ais_vessel_table, capacity_exceeded)
+{
+	ais::vessel_table table{2};
+
+	EXPECT_TRUE(table.update(marnav_test::make_report(1, 1.0, 1.0)));
+	EXPECT_TRUE(table.update(marnav_test::make_report(2, 1.0, 1.0)));
+	EXPECT_TRUE(table.update(marnav_test::make_report(1, 2.0, 2.0)));
+	EXPECT_THROW(table.update(marnav_test::make_report(3, 1.0, 1.0)), std::length_error);
+	EXPECT_EQ(2u, table.size());
+}
+
+TEST_F(test_ais_vessel_table, many_vessels)
+{
+	ais::vessel_table table{10000};
+
+	for (uint32_t i = 1; i <= table.capacity(); ++i)
+		table.update(
+			marnav_test::make_report(200000000 + i * 7, (i % 80) * 1.0, (i % 170) * 1.0));
+	EXPECT_EQ(table.capacity(), table.size());
+
+	for (uint32_t i = 1; i <= table.capacity(); ++i) {
+		const auto v = table.find(utils::mmsi{200000000 + i * 7});
+		ASSERT_TRUE(v) << "i=" << i;
+		ASSERT_TRUE(v->pos);
+		EXPECT_NEAR((i % 80) * 1.0, v->pos->lat().get(), 1e-5);
+		EXPECT_NEAR((i % 170) * 1.0, v->pos->lon().get(), 1e-5);
+	}
+	EXPECT_FALSE(table.find(utils::mmsi{200000001}));
+}
+
+TEST_F(test_ais_vessel_table, for_each)
+{
+	ais::vessel_table table{10};
+	table.update(marnav_test::make_report(3, 1.0, 1.0));
+	table.update(marnav_test::make_report(1, 1.0, 1.0));
+	table.update(marnav_test::make_report(2, 1.0, 1.0));
+	table.update(marnav_test::make_report(1, 2.0, 2.0));
+
+	std::vector<uint32_t> mmsis;
+	table.for_each([&mmsis](const ais::vessel_table::vessel & v) { mmsis.push_back(v.mmsi); });
+	EXPECT_EQ((std::vector<uint32_t>{3, 1, 2}), mmsis);
+}
+
+TEST_F(test_ais_vessel_table, concurrent_reader_consistent)
+{
+	ais::vessel_table table{16};
+	table.update(marnav_test::make_report(123456789, 0.0, 0.0));
+
+	std::atomic<bool> done{false};
+	std::thread writer{[&table, &done] {
+		for (int i = 0; i < 20000; ++i) {
+			const double x = i % 80;
+			table.update(marnav_test::make_report(123456789, x, x));
+		}
+		done = true;
+	}};
+
+	std::size_t inconsistent = 0;
+	while (!done) {
+		const auto v = table.find(utils::mmsi{123456789});
+		if (!v || !v->pos || (std::abs(v->pos->lat().get() - v->pos->lon().get()) > 1e-5))
+			++inconsistent;
+	}
+	writer.join();
+
+	EXPECT_EQ(0u, inconsistent);
+}
+}
@@ -0,0 +1,34 @@
+#ifndef TEST_MARNAV_AIS_MAKE_REPORT_HPP
+#define TEST_MARNAV_AIS_MAKE_REPORT_HPP
+
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_01.hpp>
+#include <cstdint>
+
+namespace marnav_test
+{
+/// Returns a position report of the specified type (1, 2, 3, 18 or 19).
+template <class Report = marnav::ais::message_01>
+Report make_report(uint32_t mmsi, double lat, double lon, double sog = 0.0, double cog = 0.0)
+{
+	Report m;
+	m.set_mmsi(marnav::utils::mmsi{mmsi});
+	m.set_lat(marnav::geo::latitude{lat});
+	m.set_lon(marnav::geo::longitude{lon});
+	m.set_sog(marnav::units::knots{sog});
+	m.set_cog(cog);
+	return m;
+}
+
+/// Returns the raw data of a position report without position, reports of the
+/// same vessel differ by the time stamp (second of the minute).
+inline marnav::ais::raw make_report_bits(uint32_t mmsi, uint32_t second)
+{
+	marnav::ais::message_01 m;
+	m.set_mmsi(marnav::utils::mmsi{mmsi});
+	m.set_timestamp(second);
+	return marnav::ais::encode_bits(m);
+}
+}
+
+#endif
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
+#include <marnav/geo/cpa_screen.hpp>
+#include <random>
+
+namespace
+{
+using namespace marnav;
+
+const geo::position origin{54.0, 8.0};
+
+const geo::cpa_screen::limits limits{units::nautical_miles{0.5}, std::chrono::minutes{20}};
+
+/// Vessels in the German Bight, about 60 x 70 nm.
+static std::vector<geo::vessel> create_vessels(std::size_t n)
+{
+	std::mt19937 gen{42};
+	std::uniform_real_distribution<double> lat{53.5, 54.5};
+	std::uniform_real_distribution<double> lon{7.0, 9.0};
+	std::uniform_real_distribution<double> sog{0.0, 20.0};
+	std::uniform_real_distribution<double> cog{0.0, 360.0};
+
+	std::vector<geo::vessel> result;
+	for (std::size_t i = 0; i < n; ++i)
+		result.push_back({{lat(gen), lon(gen)}, sog(gen), cog(gen)});
+	return result;
+}
+
+static geo::cpa_screen create_screen(const std::vector<geo::vessel> & vessels)
+{
+	geo::cpa_screen s{origin};
+	s.reserve(vessels.size());
+	for (std::size_t i = 0; i < vessels.size(); ++i)
+		s.add(static_cast<geo::cpa_screen::id_type>(i), vessels[i]);
+	return s;
+}
+}
+
+/// Reference: own ship against all vessels, one call of `geo::cpa` per vessel.
+static void benchmark_cpa_own_ship(benchmark::State & state)
+{
+	const auto vessels = create_vessels(static_cast<std::size_t>(state.range(0)));
+	const geo::vessel own{origin, 12.0, 45.0};
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		std::size_t n = 0;
+		for (const auto & v : vessels) {
+			const auto result = geo::cpa(own, v);
+			n += std::get<3>(result);
+		}
+		benchmark::DoNotOptimize(n);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(benchmark_cpa_own_ship)->Arg(1000)->Arg(10000);
+
+static void benchmark_cpa_screen_own_ship(benchmark::State & state)
+{
+	const auto s = create_screen(create_vessels(static_cast<std::size_t>(state.range(0))));
+	const geo::vessel own{origin, 12.0, 45.0};
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto result = s.screen(0xffffffff, own, limits);
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(benchmark_cpa_screen_own_ship)->Arg(1000)->Arg(10000);
+
+/// All pairs, items are vessels. Second argument is the number of threads.
+static void benchmark_cpa_screen_pairs(benchmark::State & state)
+{
+	auto s = create_screen(create_vessels(static_cast<std::size_t>(state.range(0))));
+	s.prepare();
+	const auto threads = static_cast<std::size_t>(state.range(1));
+
+	std::size_t found = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto result = s.screen_pairs_parallel(limits, threads);
+		found += result.size();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["found"] = static_cast<double>(found) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK(benchmark_cpa_screen_pairs)
+	->Args({1000, 1})
+	->Args({10000, 1})
+	->Args({10000, 4})
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,174 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
+#include <marnav/geo/grid_index.hpp>
+#include <random>
+#include <cmath>
+
+namespace
+{
+using namespace marnav;
+
+// 100000 targets in the North Sea, a dense traffic area
+constexpr uint32_t n_targets = 100000;
+constexpr double lat_min = 50.0;
+constexpr double lat_max = 60.0;
+constexpr double lon_min = -5.0;
+constexpr double lon_max = 10.0;
+
+struct target {
+	double lat;
+	double lon;
+	double d_lat; // movement per report, degrees
+	double d_lon;
+};
+
+static std::vector<target> create_targets()
+{
+	std::mt19937 gen{42};
+	std::uniform_real_distribution<double> lat{lat_min, lat_max};
+	std::uniform_real_distribution<double> lon{lon_min, lon_max};
+	std::uniform_real_distribution<double> course{0.0, 2.0 * 3.14159265358979323846};
+
+	// 12 knots, one report every 10 seconds: 0.033 NM per report
+	constexpr double step = 12.0 / 3600.0 * 10.0 / 60.0;
+
+	std::vector<target> result;
+	result.reserve(n_targets);
+	for (uint32_t i = 0; i < n_targets; ++i) {
+		const auto c = course(gen);
+		result.push_back({lat(gen), lon(gen), step * std::cos(c), step * std::sin(c)});
+	}
+	return result;
+}
+
+static geo::grid_index create_index(const std::vector<target> & targets, double cell_size)
+{
+	geo::grid_index index{cell_size};
+	for (uint32_t id = 0; id < targets.size(); ++id)
+		index.update(id, {targets[id].lat, targets[id].lon});
+	return index;
+}
+
+static std::vector<geo::position> create_queries()
+{
+	std::mt19937 gen{7};
+	std::uniform_real_distribution<double> lat{lat_min + 1.0, lat_max - 1.0};
+	std::uniform_real_distribution<double> lon{lon_min + 1.0, lon_max - 1.0};
+
+	std::vector<geo::position> result;
+	for (int i = 0; i < 256; ++i)
+		result.emplace_back(lat(gen), lon(gen));
+	return result;
+}
+
+/// Cell sizes in hundredths of a degree.
+static void cell_sizes(benchmark::internal::Benchmark * b)
+{
+	b->Arg(10)->Arg(25)->Arg(100);
+}
+
+static double cell_size(const benchmark::State & state)
+{
+	return static_cast<double>(state.range(0)) / 100.0;
+}
+}
+
+static void benchmark_grid_index_update(benchmark::State & state)
+{
+	auto targets = create_targets();
+	auto index = create_index(targets, cell_size(state));
+
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		// one position report of every target
+		for (uint32_t id = 0; id < targets.size(); ++id) {
+			auto & t = targets[id];
+			t.lat += t.d_lat;
+			t.lon += t.d_lon;
+			index.update(id, {t.lat, t.lon});
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(targets.size()));
+}
+
+BENCHMARK(benchmark_grid_index_update)->Apply(cell_sizes);
+
+static void benchmark_grid_index_within(benchmark::State & state)
+{
+	const auto index = create_index(create_targets(), cell_size(state));
+	const auto queries = create_queries();
+
+	std::size_t i = 0;
+	std::size_t found = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto result = index.within(queries[i++ % queries.size()], units::nautical_miles{5.0});
+		found += result.size();
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["found"] = static_cast<double>(found) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK(benchmark_grid_index_within)->Apply(cell_sizes);
+
+static void benchmark_grid_index_inside(benchmark::State & state)
+{
+	const auto index = create_index(create_targets(), cell_size(state));
+	const auto queries = create_queries();
+
+	std::size_t i = 0;
+	std::size_t found = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto result = index.inside(geo::region{queries[i++ % queries.size()], 0.5, 0.5});
+		found += result.size();
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["found"] = static_cast<double>(found) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK(benchmark_grid_index_inside)->Apply(cell_sizes);
+
+static void benchmark_grid_index_nearest(benchmark::State & state)
+{
+	const auto index = create_index(create_targets(), cell_size(state));
+	const auto queries = create_queries();
+
+	std::size_t i = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const auto result = index.nearest(queries[i++ % queries.size()], 10);
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(benchmark_grid_index_nearest)->Apply(cell_sizes);
+
+/// Reference: testing all targets with `geo::region::inside`.
+static void benchmark_region_inside_linear(benchmark::State & state)
+{
+	const auto targets = create_targets();
+	std::vector<geo::position> positions;
+	for (const auto & t : targets)
+		positions.emplace_back(t.lat, t.lon);
+	const auto queries = create_queries();
+
+	std::size_t i = 0;
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		const geo::region r{queries[i++ % queries.size()], 0.5, 0.5};
+		std::vector<uint32_t> result;
+		for (uint32_t id = 0; id < positions.size(); ++id)
+			if (r.inside(positions[id]))
+				result.push_back(id);
+		benchmark::DoNotOptimize(result.data());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(benchmark_region_inside_linear);
+
+BENCHMARK_MAIN();
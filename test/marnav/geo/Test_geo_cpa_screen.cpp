@@ -0,0 +1,171 @@
+#include <marnav/geo/cpa_screen.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+
+namespace
+{
+using namespace marnav;
+using namespace marnav::geo;
+
+class test_geo_cpa_screen : public ::testing::Test
+{
+public:
+	using pair = std::pair<cpa_screen::id_type, cpa_screen::id_type>;
+
+	static std::vector<pair> pairs(const std::vector<cpa_screen::encounter> & e)
+	{
+		std::vector<pair> result;
+		for (const auto & t : e)
+			result.emplace_back(t.first, t.second);
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	const cpa_screen::limits limits{units::nautical_miles{0.5}, std::chrono::minutes{60}};
+};
+
+TEST_F(test_geo_cpa_screen, head_on)
+{
+	// 0.1 degrees on the equator: 6 nm, closing in with 12 kn
+	cpa_screen s{{0.0, 0.0}};
+	s.add(2, {{0.0, 0.1}, 6.0, 270.0});
+	EXPECT_EQ(1u, s.size());
+
+	const auto e = s.screen(1, {{0.0, 0.0}, 6.0, 90.0}, limits);
+	ASSERT_EQ(1u, e.size());
+	EXPECT_EQ(1u, e[0].first);
+	EXPECT_EQ(2u, e[0].second);
+	EXPECT_NEAR(0.0, e[0].cpa.value(), 1e-9);
+	EXPECT_EQ(std::chrono::seconds{30 * 60}, e[0].tcpa);
+}
+
+TEST_F(test_geo_cpa_screen, crossing)
+{
+	// target 3 nm north, heading south with 6 kn, passes 0.3 nm east of
+	// own ship, which is not moving
+	cpa_screen s{{0.0, 0.0}};
+	s.add(2, {{0.05, 0.005}, 6.0, 180.0});
+
+	const auto e = s.screen(1, {{0.0, 0.0}, 0.0, 0.0}, limits);
+	ASSERT_EQ(1u, e.size());
+	EXPECT_NEAR(0.3, e[0].cpa.value(), 1e-3);
+	EXPECT_EQ(std::chrono::seconds{30 * 60}, e[0].tcpa);
+}
+
+TEST_F(test_geo_cpa_screen, not_reported)
+{
+	cpa_screen s{{0.0, 0.0}};
+	s.add(2, {{0.0, 0.1}, 6.0, 90.0}); // diverging
+	s.add(3, {{0.0, 0.001}, 6.0, 90.0}); // parallel, same speed
+	s.add(4, {{0.0, 0.3}, 6.0, 270.0}); // too far away, tcpa 90 min
+	s.add(5, {{0.1, 0.1}, 6.0, 270.0}); // passes 6 nm north
+	s.add(1, {{0.0, 0.0}, 6.0, 90.0}); // own ship
+
+	EXPECT_TRUE(s.screen(1, {{0.0, 0.0}, 6.0, 90.0}, limits).empty());
+}
+
+TEST_F(test_geo_cpa_screen, date_line)
+{
+	cpa_screen s{{0.0, 179.95}};
+	s.add(2, {{0.0, -179.95}, 6.0, 270.0});
+
+	const auto e = s.screen(1, {{0.0, 179.95}, 6.0, 90.0}, limits);
+	ASSERT_EQ(1u, e.size());
+	EXPECT_EQ(std::chrono::seconds{30 * 60}, e[0].tcpa);
+}
+
+TEST_F(test_geo_cpa_screen, latitude_scale)
+{
+	// at 60N one degree of longitude is 30 nm
+	cpa_screen s{{60.0, 0.0}};
+	s.add(2, {{60.0, 0.2}, 6.0, 270.0});
+
+	const auto e = s.screen(1, {{60.0, 0.0}, 6.0, 90.0}, limits);
+	ASSERT_EQ(1u, e.size());
+	EXPECT_NEAR(30.0 * 60.0, static_cast<double>(e[0].tcpa.count()), 2.0);
+}
+
+TEST_F(test_geo_cpa_screen, pairs)
+{
+	cpa_screen s{{0.0, 0.0}};
+	s.add(10, {{0.0, 0.1}, 6.0, 270.0});
+	s.add(11, {{0.0, 0.0}, 6.0, 90.0});
+	s.add(12, {{0.5, 0.5}, 6.0, 90.0});
+
+	const auto e = s.screen_pairs(limits);
+	ASSERT_EQ(1u, e.size());
+	EXPECT_EQ(10u, e[0].first);
+	EXPECT_EQ(11u, e[0].second);
+	EXPECT_EQ(std::chrono::seconds{30 * 60}, e[0].tcpa);
+}
+
+TEST_F(test_geo_cpa_screen, pairs_invalid_part)
+{
+	cpa_screen s{{0.0, 0.0}};
+	EXPECT_THROW(s.screen_pairs(limits, 0, 0), std::invalid_argument);
+	EXPECT_THROW(s.screen_pairs(limits, 2, 2), std::invalid_argument);
+	EXPECT_THROW(s.screen_pairs_parallel(limits, 0), std::invalid_argument);
+	EXPECT_TRUE(s.screen_pairs(limits).empty());
+	EXPECT_TRUE(s.screen_pairs_parallel(limits, 2).empty());
+}
+
+TEST_F(test_geo_cpa_screen, pairs_random)
+{
+	std::mt19937 gen{42};
+	std::uniform_real_distribution<double> lat{53.5, 54.5};
+	std::uniform_real_distribution<double> lon{7.0, 9.0};
+	std::uniform_real_distribution<double> sog{0.0, 20.0};
+	std::uniform_real_distribution<double> cog{0.0, 360.0};
+
+	std::vector<vessel> vessels;
+	cpa_screen s{{54.0, 8.0}};
+	for (cpa_screen::id_type id = 0; id < 1000; ++id) {
+		vessels.push_back({{lat(gen), lon(gen)}, sog(gen), cog(gen)});
+		s.add(id, vessels.back());
+	}
+
+	// reference: own ship screening of every vessel
+	std::vector<pair> expected;
+	for (cpa_screen::id_type id = 0; id < vessels.size(); ++id)
+		for (const auto & e : s.screen(id, vessels[id], limits))
+			if (e.first < e.second)
+				expected.emplace_back(e.first, e.second);
+	std::sort(expected.begin(), expected.end());
+	ASSERT_FALSE(expected.empty());
+
+	EXPECT_EQ(expected, pairs(s.screen_pairs(limits)));
+	EXPECT_EQ(expected, pairs(s.screen_pairs_parallel(limits, 4)));
+
+	// distributed among threads by the caller
+	s.prepare();
+	constexpr std::size_t parts = 3;
+	std::vector<cpa_screen::encounter> results[parts];
+	std::vector<std::thread> threads;
+	for (std::size_t part = 0; part < parts; ++part)
+		threads.emplace_back(
+			[&s, &results, part, this] { results[part] = s.screen_pairs(limits, part, parts); });
+	for (auto & t : threads)
+		t.join();
+
+	std::vector<cpa_screen::encounter> all;
+	for (const auto & r : results)
+		all.insert(all.end(), r.begin(), r.end());
+	EXPECT_EQ(expected, pairs(all));
+	EXPECT_EQ(expected, pairs(s.screen_pairs_parallel(limits, 3)));
+}
+
+TEST_F(test_geo_cpa_screen, add_after_prepare)
+{
+	cpa_screen s{{0.0, 0.0}};
+	s.add(10, {{0.0, 0.1}, 6.0, 270.0});
+	s.prepare();
+	EXPECT_TRUE(s.screen_pairs(limits).empty());
+
+	s.add(11, {{0.0, 0.0}, 6.0, 90.0});
+	EXPECT_EQ(1u, s.screen_pairs(limits).size());
+	s.prepare();
+	EXPECT_EQ(1u, s.screen_pairs(limits).size());
+}
+}
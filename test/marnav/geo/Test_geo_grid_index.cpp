@@ -0,0 +1,249 @@
+#include <marnav/geo/grid_index.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <cmath>
+
+namespace
+{
+using namespace marnav;
+using namespace marnav::geo;
+
+class test_geo_grid_index : public ::testing::Test
+{
+public:
+	static std::vector<grid_index::id_type> sorted(std::vector<grid_index::id_type> v)
+	{
+		std::sort(v.begin(), v.end());
+		return v;
+	}
+
+	/// Distance by the spherical law of cosines, for reference.
+	static double distance_nm(const position & a, const position & b)
+	{
+		constexpr double rad = 3.14159265358979323846 / 180.0;
+		const double angle = std::acos(std::sin(a.lat() * rad) * std::sin(b.lat() * rad)
+			+ std::cos(a.lat() * rad) * std::cos(b.lat() * rad)
+				* std::cos((b.lon() - a.lon()) * rad));
+		return angle / rad * 60.0;
+	}
+};
+
+TEST_F(test_geo_grid_index, construction)
+{
+	grid_index index;
+	EXPECT_EQ(1.0, index.cell_size());
+	EXPECT_EQ(0u, index.size());
+	EXPECT_TRUE(index.empty());
+	EXPECT_FALSE(index.find(1));
+}
+
+TEST_F(test_geo_grid_index, construction_invalid_cell_size)
+{
+	EXPECT_THROW(grid_index{0.0}, std::invalid_argument);
+	EXPECT_THROW(grid_index{-1.0}, std::invalid_argument);
+	EXPECT_THROW(grid_index{181.0}, std::invalid_argument);
+}
+
+TEST_F(test_geo_grid_index, update_and_find)
+{
+	grid_index index;
+	index.update(1, {10.5, 20.5});
+	index.update(2, {-10.5, -20.5});
+	EXPECT_EQ(2u, index.size());
+
+	const auto p = index.find(1);
+	ASSERT_TRUE(p);
+	EXPECT_EQ((position{10.5, 20.5}), *p);
+
+	// move within the cell and into another cell
+	index.update(1, {10.6, 20.6});
+	EXPECT_EQ((position{10.6, 20.6}), *index.find(1));
+	index.update(1, {-10.6, -20.6});
+	EXPECT_EQ(2u, index.size());
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2}),
+		sorted(index.within({-10.5, -20.5}, units::nautical_miles{20.0})));
+	EXPECT_TRUE(index.within({10.6, 20.6}, units::nautical_miles{20.0}).empty());
+}
+
+TEST_F(test_geo_grid_index, update_boundaries)
+{
+	grid_index index;
+	index.update(1, {90.0, 180.0});
+	index.update(2, {-90.0, -180.0});
+	index.update(3, {0.0, 180.0});
+	EXPECT_EQ(3u, index.size());
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2, 3}),
+		sorted(index.within({0.0, 0.0}, units::nautical_miles{10800.0})));
+}
+
+TEST_F(test_geo_grid_index, remove)
+{
+	grid_index index;
+	index.update(1, {1.0, 1.0});
+	index.update(2, {1.1, 1.1});
+	index.update(3, {1.2, 1.2});
+
+	EXPECT_TRUE(index.remove(1));
+	EXPECT_FALSE(index.remove(1));
+	EXPECT_EQ(2u, index.size());
+	EXPECT_FALSE(index.find(1));
+	ASSERT_TRUE(index.find(3));
+	EXPECT_EQ((position{1.2, 1.2}), *index.find(3));
+	EXPECT_EQ((std::vector<grid_index::id_type>{2, 3}),
+		sorted(index.within({1.0, 1.0}, units::nautical_miles{60.0})));
+
+	index.update(3, {5.0, 5.0});
+	EXPECT_TRUE(index.remove(2));
+	EXPECT_EQ((std::vector<grid_index::id_type>{3}),
+		sorted(index.within({5.0, 5.0}, units::nautical_miles{1.0})));
+}
+
+TEST_F(test_geo_grid_index, clear)
+{
+	grid_index index;
+	index.update(1, {1.0, 1.0});
+	index.update(2, {2.0, 2.0});
+	index.clear();
+	EXPECT_TRUE(index.empty());
+	EXPECT_TRUE(index.within({1.0, 1.0}, units::nautical_miles{600.0}).empty());
+}
+
+TEST_F(test_geo_grid_index, inside)
+{
+	grid_index index{0.5};
+	index.update(1, {1.0, -1.0}); // corner
+	index.update(2, {0.0, 0.0});
+	index.update(3, {-2.0, 3.0}); // corner
+	index.update(4, {0.0, 3.1});
+	index.update(5, {1.1, 0.0});
+	index.update(6, {0.0, -179.0});
+
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2, 3}),
+		sorted(index.inside(region{{1.0, -1.0}, {-2.0, 3.0}})));
+}
+
+TEST_F(test_geo_grid_index, inside_date_line)
+{
+	grid_index index;
+	index.update(1, {0.0, 179.5});
+	index.update(2, {0.0, -179.5});
+	index.update(3, {0.0, 180.0});
+	index.update(4, {0.0, 0.0});
+	index.update(5, {0.0, 178.0});
+
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2, 3}),
+		sorted(index.inside(region{{1.0, 179.0}, {-1.0, -179.0}})));
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 3}),
+		sorted(index.inside(region{{1.0, 179.0}, {-1.0, 180.0}})));
+}
+
+TEST_F(test_geo_grid_index, within_date_line)
+{
+	grid_index index;
+	index.update(1, {0.0, 179.9});
+	index.update(2, {0.0, -179.9});
+	index.update(3, {0.0, 179.0});
+
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2}),
+		sorted(index.within({0.0, 180.0}, units::nautical_miles{10.0})));
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2}),
+		sorted(index.within({0.0, -179.95}, units::nautical_miles{10.0})));
+}
+
+TEST_F(test_geo_grid_index, within_pole)
+{
+	grid_index index;
+	index.update(1, {89.5, 0.0});
+	index.update(2, {89.5, 180.0});
+	index.update(3, {88.0, 90.0});
+
+	EXPECT_EQ((std::vector<grid_index::id_type>{1, 2}),
+		sorted(index.within({89.9, 45.0}, units::nautical_miles{70.0})));
+}
+
+TEST_F(test_geo_grid_index, within_random)
+{
+	std::mt19937 gen{42};
+	std::uniform_real_distribution<double> lat{50.0, 60.0};
+	std::uniform_real_distribution<double> lon{-5.0, 10.0};
+
+	grid_index index{0.25};
+	std::vector<position> pos;
+	for (grid_index::id_type id = 0; id < 5000; ++id) {
+		pos.emplace_back(lat(gen), lon(gen));
+		index.update(id, pos.back());
+	}
+
+	for (int i = 0; i < 20; ++i) {
+		const position center{lat(gen), lon(gen)};
+		const double radius = 5.0 + i * 5.0;
+
+		std::vector<grid_index::id_type> expected;
+		for (grid_index::id_type id = 0; id < pos.size(); ++id)
+			if (distance_nm(center, pos[id]) <= radius)
+				expected.push_back(id);
+
+		EXPECT_EQ(expected, sorted(index.within(center, units::nautical_miles{radius})))
+			<< "i=" << i;
+	}
+}
+
+TEST_F(test_geo_grid_index, nearest)
+{
+	grid_index index;
+	index.update(1, {0.0, 0.3});
+	index.update(2, {0.0, 0.1});
+	index.update(3, {0.0, -0.2});
+	index.update(4, {10.0, 10.0});
+
+	const auto n = index.nearest({0.0, 0.0}, 3);
+	ASSERT_EQ(3u, n.size());
+	EXPECT_EQ(2u, n[0].id);
+	EXPECT_EQ(3u, n[1].id);
+	EXPECT_EQ(1u, n[2].id);
+	EXPECT_NEAR(6.0, n[0].distance.value(), 1e-6);
+	EXPECT_NEAR(12.0, n[1].distance.value(), 1e-6);
+	EXPECT_NEAR(18.0, n[2].distance.value(), 1e-6);
+}
+
+TEST_F(test_geo_grid_index, nearest_not_enough_targets)
+{
+	grid_index index;
+	EXPECT_TRUE(index.nearest({0.0, 0.0}, 3).empty());
+
+	index.update(1, {45.0, 90.0});
+	index.update(2, {-45.0, -90.0});
+	const auto n = index.nearest({0.0, 0.0}, 3);
+	ASSERT_EQ(2u, n.size());
+	EXPECT_TRUE(index.nearest({0.0, 0.0}, 0).empty());
+}
+
+TEST_F(test_geo_grid_index, nearest_random)
+{
+	std::mt19937 gen{7};
+	std::uniform_real_distribution<double> lat{-60.0, 60.0};
+	std::uniform_real_distribution<double> lon{-180.0, 180.0};
+
+	grid_index index{2.0};
+	std::vector<position> pos;
+	for (grid_index::id_type id = 0; id < 2000; ++id) {
+		pos.emplace_back(lat(gen), lon(gen));
+		index.update(id, pos.back());
+	}
+
+	for (int i = 0; i < 20; ++i) {
+		const position center{lat(gen), lon(gen)};
+
+		std::vector<double> expected;
+		for (const auto & p : pos)
+			expected.push_back(distance_nm(center, p));
+		std::sort(expected.begin(), expected.end());
+
+		const auto n = index.nearest(center, 10);
+		ASSERT_EQ(10u, n.size());
+		for (std::size_t k = 0; k < n.size(); ++k)
+			EXPECT_NEAR(expected[k], n[k].distance.value(), 1e-6) << "i=" << i << " k=" << k;
+	}
+}
+}
@@ -1,5 +1,6 @@
 #include <marnav/nmea/checksum.hpp>
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 
 namespace
 {
@@ -15,6 +16,7 @@ static std::string checksum_to_string_v0(uint8_t sum)
 static void benchmark_nmea_checksum_to_string_v0(benchmark::State & state)
 {
 	std::string result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = checksum_to_string_v0(state.range(0));
 		benchmark::DoNotOptimize(result);
@@ -26,6 +28,7 @@ BENCHMARK(benchmark_nmea_checksum_to_string_v0)->Range(0x00, 0xff);
 static void benchmark_nmea_checksum_to_string(benchmark::State & state)
 {
 	std::string result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = marnav::nmea::checksum_to_string(state.range(0));
 		benchmark::DoNotOptimize(result);
@@ -1,5 +1,6 @@
 #include <marnav/nmea/io.hpp>
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 #include <algorithm>
 
 namespace v4
@@ -217,6 +218,7 @@ std::string format(uint64_t data, unsigned int width, marnav::nmea::data_format
 
 void bench_dec_v0(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v0::format(data, 10, marnav::nmea::data_format::dec);
@@ -226,6 +228,7 @@ void bench_dec_v0(benchmark::State & state)
 
 void bench_hex_v0(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v0::format(data, 10, marnav::nmea::data_format::hex);
@@ -235,6 +238,7 @@ void bench_hex_v0(benchmark::State & state)
 
 void bench_dec_v1(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v1::format(data, 10, marnav::nmea::data_format::dec);
@@ -244,6 +248,7 @@ void bench_dec_v1(benchmark::State & state)
 
 void bench_hex_v1(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v1::format(data, 10, marnav::nmea::data_format::hex);
@@ -253,6 +258,7 @@ void bench_hex_v1(benchmark::State & state)
 
 void bench_dec_v2(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v2::format(data, 10, marnav::nmea::data_format::dec);
@@ -262,6 +268,7 @@ void bench_dec_v2(benchmark::State & state)
 
 void bench_hex_v2(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v2::format(data, 10, marnav::nmea::data_format::hex);
@@ -271,6 +278,7 @@ void bench_hex_v2(benchmark::State & state)
 
 void bench_dec_v3(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v3::format(data, 10, marnav::nmea::data_format::dec);
@@ -280,6 +288,7 @@ void bench_dec_v3(benchmark::State & state)
 
 void bench_hex_v3(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v3::format(data, 10, marnav::nmea::data_format::hex);
@@ -289,6 +298,7 @@ void bench_hex_v3(benchmark::State & state)
 
 void bench_dec_v4(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v4::format(data, 10, marnav::nmea::data_format::dec);
@@ -298,6 +308,7 @@ void bench_dec_v4(benchmark::State & state)
 
 void bench_hex_v4(benchmark::State & state)
 {
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::uint64_t data = state.range(0);
 		const auto s = v4::format(data, 10, marnav::nmea::data_format::hex);
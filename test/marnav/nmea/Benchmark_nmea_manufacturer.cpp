@@ -1,5 +1,6 @@
 #include <marnav/nmea/manufacturer.hpp>
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 
 static void benchmark_get_manufacturer_name_from_id(benchmark::State & state)
 {
@@ -7,6 +8,7 @@ static void benchmark_get_manufacturer_name_from_id(benchmark::State & state)
 
 	const std::vector<nmea::manufacturer_id> ids = nmea::get_supported_manufacturer_id();
 
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		for (auto id : ids) {
 			std::string name = nmea::get_manufacturer_name(id);
@@ -21,6 +23,7 @@ static void benchmark_get_supported_manufacturer_id(benchmark::State & state)
 {
 	using namespace marnav;
 
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		const std::vector<nmea::manufacturer_id> ids = nmea::get_supported_manufacturer_id();
 		benchmark::DoNotOptimize(ids);
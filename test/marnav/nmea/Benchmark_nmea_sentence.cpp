@@ -94,6 +94,7 @@
 #include <marnav/nmea/zte.hpp>
 #include <marnav/nmea/ztg.hpp>
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 #include <algorithm>
 #include <typeindex>
 
@@ -242,6 +243,7 @@ static void specific(benchmark::internal::Benchmark * b)
 static void benchmark_make_sentence(benchmark::State & state)
 {
 	state.SetLabel(sentences[state.range(0)].tag);
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		auto tmp = nmea::make_sentence(sentences[state.range(0)].text);
 		benchmark::DoNotOptimize(tmp);
@@ -253,6 +255,7 @@ BENCHMARK(benchmark_make_sentence)->Apply(all_sentences);
 static void benchmark_sentence_to_string(benchmark::State & state)
 {
 	state.SetLabel(sentences[state.range(0)].tag);
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		state.PauseTiming();
 		const auto raw = sentences[state.range(0)].text;
@@ -269,6 +272,7 @@ template <class T>
 static void benchmark_create_sentence(benchmark::State & state)
 {
 	state.SetLabel(sentences[state.range(0)].tag);
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		auto tmp = nmea::create_sentence<T>(sentences[state.range(0)].text);
 		benchmark::DoNotOptimize(tmp);
@@ -379,6 +383,7 @@ BENCHMARK_TEMPLATE_SENTENCE(ztg);
 static void benchmark_extract_id(benchmark::State & state)
 {
 	state.SetLabel(sentences[state.range(0)].tag);
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		auto tmp = nmea::extract_id(sentences[state.range(0)].text);
 		benchmark::DoNotOptimize(tmp);
@@ -1,5 +1,6 @@
 #include <marnav/nmea/split.hpp>
 #include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
 #include <regex>
 
 namespace
@@ -100,6 +101,7 @@ static void benchmark_nmea_split_v0(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = parse_fields_v0(sentence);
 		benchmark::DoNotOptimize(result);
@@ -112,6 +114,7 @@ static void benchmark_nmea_split_v1(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = parse_fields_v1(sentence);
 		benchmark::DoNotOptimize(result);
@@ -124,6 +127,7 @@ static void benchmark_nmea_split_v2(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = parse_fields_v2(sentence);
 		benchmark::DoNotOptimize(result);
@@ -136,6 +140,7 @@ static void benchmark_nmea_split_v3(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = parse_fields_v3(sentence);
 		benchmark::DoNotOptimize(result);
@@ -148,6 +153,7 @@ static void benchmark_nmea_split_v4(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = parse_fields_v4(sentence);
 		benchmark::DoNotOptimize(result);
@@ -160,6 +166,7 @@ static void benchmark_nmea_split(benchmark::State & state)
 {
 	std::string sentence = SENTENCES[state.range(0)];
 	std::vector<std::string> result;
+	marnav_test::allocation_counter allocs{state};
 	while (state.KeepRunning()) {
 		result = marnav::nmea::detail::parse_fields(sentence);
 		benchmark::DoNotOptimize(result);
@@ -0,0 +1,273 @@
+#include <marnav/nmea/ais_reassembler.hpp>
+#include <marnav/nmea/vdm.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_05.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+using namespace std::chrono_literals;
+
+class test_nmea_ais_reassembler : public ::testing::Test
+{
+public:
+	using clock = nmea::ais_reassembler::clock;
+
+	const clock::time_point t0 = clock::time_point{} + 1h;
+
+	static constexpr const char * payload_05_1
+		= "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53";
+	static constexpr const char * payload_05_2 = "1@0000000000000";
+
+	static nmea::vdm make_vdm(uint32_t n, uint32_t i, uint32_t seq, const std::string & payload,
+		uint32_t fill_bits, nmea::ais_channel channel = nmea::ais_channel::B,
+		const std::string & tag_block = {})
+	{
+		nmea::vdm v;
+		v.set_n_fragments(n);
+		v.set_fragment(i);
+		v.set_seq_msg_id(seq);
+		v.set_radio_channel(channel);
+		v.set_payload(payload, fill_bits);
+		v.set_tag_block(tag_block);
+		return v;
+	}
+};
+
+TEST_F(test_nmea_ais_reassembler, invalid_number_of_slots)
+{
+	EXPECT_ANY_THROW(nmea::ais_reassembler(0));
+}
+
+TEST_F(test_nmea_ais_reassembler, single_fragment)
+{
+	nmea::ais_reassembler r;
+
+	auto m = r.process(make_vdm(1, 1, 0, "177KQJ5000G?tO`K>RA1wUbN0TKH", 0), t0);
+	ASSERT_NE(nullptr, m);
+	EXPECT_EQ(ais::message_id::position_report_class_a, m->type());
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(1u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, two_fragments)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(1u, r.pending());
+	auto m = r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0 + 10ms);
+	ASSERT_NE(nullptr, m);
+	EXPECT_EQ(0u, r.pending());
+
+	const auto expected = ais::make_message({{payload_05_1, 0}, {payload_05_2, 2}});
+	const auto m05 = ais::message_cast<ais::message_05>(m.get());
+	const auto e05 = ais::message_cast<ais::message_05>(expected.get());
+	ASSERT_NE(nullptr, m05);
+	EXPECT_EQ(e05->get_mmsi(), m05->get_mmsi());
+	EXPECT_EQ(e05->get_shipname(), m05->get_shipname());
+	EXPECT_EQ(ais::encode_message(*e05), ais::encode_message(*m05));
+
+	const auto stats = r.get_statistics();
+	EXPECT_EQ(2u, stats.fragments);
+	EXPECT_EQ(1u, stats.completed);
+	EXPECT_EQ(0u, stats.dropped_sequence);
+}
+
+TEST_F(test_nmea_ais_reassembler, interleaved_sequence_ids)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 4, payload_05_1, 0), t0));
+	EXPECT_EQ(2u, r.pending());
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 4, payload_05_2, 2), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(2u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, interleaved_channels)
+{
+	nmea::ais_reassembler r;
+	const auto a = nmea::ais_channel::A;
+	const auto b = nmea::ais_channel::B;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0, a), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0, b), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2, a), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2, b), t0));
+}
+
+TEST_F(test_nmea_ais_reassembler, interleaved_sources)
+{
+	nmea::ais_reassembler r;
+	const auto a = nmea::ais_channel::A;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0, a, "s:r1*00"), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0, a, "c:1,s:r2*00"), t0));
+	EXPECT_EQ(2u, r.pending());
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2, a, "s:r1*00"), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2, a, "s:r2,c:2*00"), t0));
+}
+
+TEST_F(test_nmea_ais_reassembler, missing_first_fragment)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(1u, r.get_statistics().dropped_sequence);
+}
+
+TEST_F(test_nmea_ais_reassembler, restarted_message)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(1u, r.get_statistics().dropped_sequence);
+	EXPECT_EQ(1u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, fragment_out_of_sequence)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(3, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(3, 3, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(1u, r.get_statistics().dropped_sequence);
+}
+
+TEST_F(test_nmea_ais_reassembler, timeout)
+{
+	nmea::ais_reassembler r{4, 1s};
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0 + 2s));
+	EXPECT_EQ(0u, r.pending());
+
+	const auto stats = r.get_statistics();
+	EXPECT_EQ(1u, stats.evicted_timeout);
+	EXPECT_EQ(1u, stats.dropped_sequence);
+	EXPECT_EQ(0u, stats.completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, overflow_evicts_oldest)
+{
+	nmea::ais_reassembler r{2};
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 1, payload_05_1, 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 2, payload_05_1, 0), t0 + 1ms));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0 + 2ms));
+	EXPECT_EQ(2u, r.pending());
+	EXPECT_EQ(1u, r.get_statistics().evicted_overflow);
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 2, 1, payload_05_2, 2), t0 + 3ms));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 2, payload_05_2, 2), t0 + 3ms));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0 + 3ms));
+}
+
+TEST_F(test_nmea_ais_reassembler, many_interleaved_messages)
+{
+	nmea::ais_reassembler r{64};
+
+	for (uint32_t seq = 0; seq < 64; ++seq)
+		EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, seq, payload_05_1, 0), t0));
+	EXPECT_EQ(64u, r.pending());
+
+	// completed in a different order than started
+	for (uint32_t i = 0; i < 64; ++i) {
+		const auto seq = (i * 37) % 64;
+		EXPECT_NE(nullptr, r.process(make_vdm(2, 2, seq, payload_05_2, 2), t0));
+	}
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(64u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, invalid_fragment_numbers)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_ANY_THROW(r.process(make_vdm(0, 0, 3, payload_05_1, 0), t0));
+	EXPECT_ANY_THROW(r.process(make_vdm(2, 3, 3, payload_05_1, 0), t0));
+}
+
+TEST_F(test_nmea_ais_reassembler, invalid_message_releases_slot)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, "5", 0), t0));
+	EXPECT_ANY_THROW(r.process(make_vdm(2, 2, 3, "1", 0), t0));
+	EXPECT_EQ(0u, r.pending());
+}
+
+TEST_F(test_nmea_ais_reassembler, invalid_message_not_completed)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_ANY_THROW(r.process(make_vdm(1, 1, 0, "1", 0), t0));
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, "5", 0), t0));
+	EXPECT_ANY_THROW(r.process(make_vdm(2, 2, 3, "1", 0), t0));
+	EXPECT_EQ(0u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, invalid_fragment_releases_slot)
+{
+	nmea::ais_reassembler r;
+	const std::string payload(100, '0');
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(3, 1, 3, payload, 0), t0));
+	EXPECT_ANY_THROW(r.process(make_vdm(3, 2, 3, payload, 0), t0));
+	EXPECT_EQ(0u, r.pending());
+}
+
+TEST_F(test_nmea_ais_reassembler, clear)
+{
+	nmea::ais_reassembler r;
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	r.clear();
+	EXPECT_EQ(0u, r.pending());
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+}
+
+TEST_F(test_nmea_ais_reassembler, filter_single_fragment)
+{
+	nmea::ais_reassembler r;
+	r.set_filter(ais::message_filter{}.accept_type(ais::message_id::base_station_report));
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(1, 1, 0, "177KQJ5000G?tO`K>RA1wUbN0TKH", 0), t0));
+	EXPECT_EQ(1u, r.get_statistics().filtered);
+	EXPECT_EQ(0u, r.get_statistics().completed);
+}
+
+TEST_F(test_nmea_ais_reassembler, filter_two_fragments)
+{
+	nmea::ais_reassembler r;
+	r.set_filter(ais::message_filter{}.accept_mmsi(utils::mmsi{1}));
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_EQ(1u, r.pending());
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(0u, r.pending());
+
+	const auto stats = r.get_statistics();
+	EXPECT_EQ(1u, stats.filtered);
+	EXPECT_EQ(0u, stats.completed);
+	EXPECT_EQ(0u, stats.dropped_sequence);
+}
+
+TEST_F(test_nmea_ais_reassembler, filter_accepts)
+{
+	nmea::ais_reassembler r;
+	r.set_filter(ais::message_filter{}.accept_type(ais::message_id::static_and_voyage_related_data));
+
+	EXPECT_EQ(nullptr, r.process(make_vdm(2, 1, 3, payload_05_1, 0), t0));
+	EXPECT_NE(nullptr, r.process(make_vdm(2, 2, 3, payload_05_2, 2), t0));
+	EXPECT_EQ(0u, r.get_statistics().filtered);
+}
+}
@@ -0,0 +1,159 @@
+#include <marnav/nmea/sentence_limiter.hpp>
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace marnav;
+using namespace std::chrono_literals;
+
+class test_nmea_sentence_limiter : public ::testing::Test
+{
+public:
+	using clock = nmea::sentence_limiter::clock;
+
+	const clock::time_point t0 = clock::time_point{} + 1h;
+};
+
+TEST_F(test_nmea_sentence_limiter, default_accepts_different_sentences)
+{
+	nmea::sentence_limiter limiter;
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_TRUE(limiter.accept("$GPHDT,11.0,T*09", t0));
+	EXPECT_TRUE(limiter.accept("$GPHDT,12.0,T*0A", t0));
+
+	const auto stats = limiter.get_statistics();
+	EXPECT_EQ(3u, stats.received);
+	EXPECT_EQ(3u, stats.passed);
+	EXPECT_EQ(0u, stats.dropped_duplicate);
+	EXPECT_EQ(0u, stats.dropped_rate);
+}
+
+TEST_F(test_nmea_sentence_limiter, drop_duplicate_within_window)
+{
+	nmea::sentence_limiter limiter{0ms, 1s};
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,10.0,T*08", t0 + 500ms));
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0 + 1s));
+
+	const auto stats = limiter.get_statistics();
+	EXPECT_EQ(3u, stats.received);
+	EXPECT_EQ(2u, stats.passed);
+	EXPECT_EQ(1u, stats.dropped_duplicate);
+	EXPECT_EQ(16u, stats.dropped_bytes);
+}
+
+TEST_F(test_nmea_sentence_limiter, duplicate_ignores_line_ending_and_tag_block)
+{
+	nmea::sentence_limiter limiter{0ms, 1s};
+
+	EXPECT_TRUE(limiter.accept("\\s:r1,c:1000*00\\$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("\\s:r1,c:1001*00\\$GPHDT,10.0,T*08\r\n", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,10.0,T*08", t0));
+}
+
+TEST_F(test_nmea_sentence_limiter, duplicate_detection_disabled)
+{
+	nmea::sentence_limiter limiter{0ms, 0ms};
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+}
+
+TEST_F(test_nmea_sentence_limiter, rate_limit_default)
+{
+	nmea::sentence_limiter limiter{100ms, 0ms};
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,11.0,T*09", t0 + 50ms));
+	EXPECT_TRUE(limiter.accept("$GPHDT,12.0,T*0A", t0 + 100ms));
+	EXPECT_FALSE(limiter.accept("$GPHDT,13.0,T*0B", t0 + 199ms));
+	EXPECT_TRUE(limiter.accept("$GPHDT,14.0,T*0C", t0 + 200ms));
+
+	const auto stats = limiter.get_statistics();
+	EXPECT_EQ(5u, stats.received);
+	EXPECT_EQ(3u, stats.passed);
+	EXPECT_EQ(2u, stats.dropped_rate);
+}
+
+TEST_F(test_nmea_sentence_limiter, rate_limit_per_tag)
+{
+	nmea::sentence_limiter limiter{0ms, 0ms};
+	limiter.set_min_interval("HDT", 100ms);
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,11.0,T*09", t0 + 50ms));
+	EXPECT_TRUE(limiter.accept("$HEHDT,11.0,T*09", t0 + 50ms));
+	EXPECT_TRUE(limiter.accept("$GPROT,1.0,A*30", t0));
+	EXPECT_TRUE(limiter.accept("$GPROT,2.0,A*33", t0 + 1ms));
+}
+
+TEST_F(test_nmea_sentence_limiter, rate_limit_proprietary)
+{
+	nmea::sentence_limiter limiter{0ms, 0ms};
+	limiter.set_min_interval("PGRME", 1s);
+
+	EXPECT_TRUE(limiter.accept("$PGRME,22.0,M,52.9,M,51.0,M*14", t0));
+	EXPECT_FALSE(limiter.accept("$PGRME,22.1,M,52.9,M,51.0,M*15", t0 + 500ms));
+}
+
+TEST_F(test_nmea_sentence_limiter, key_with_source)
+{
+	nmea::sentence_limiter limiter{100ms, 1s, true};
+
+	EXPECT_TRUE(limiter.accept("\\s:r1*00\\$GPHDT,10.0,T*08", t0));
+	EXPECT_TRUE(limiter.accept("\\s:r2*00\\$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("\\s:r1*00\\$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("\\c:1000,s:r2*00\\$GPHDT,11.0,T*09", t0 + 10ms));
+	EXPECT_TRUE(limiter.accept("$GPHDT,11.0,T*09", t0 + 10ms));
+}
+
+TEST_F(test_nmea_sentence_limiter, key_without_source)
+{
+	nmea::sentence_limiter limiter{100ms, 1s, false};
+
+	EXPECT_TRUE(limiter.accept("\\s:r1*00\\$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("\\s:r2*00\\$GPHDT,10.0,T*08", t0));
+}
+
+TEST_F(test_nmea_sentence_limiter, malformed_passed_through)
+{
+	nmea::sentence_limiter limiter{1s, 1s};
+
+	EXPECT_TRUE(limiter.accept("", t0));
+	EXPECT_TRUE(limiter.accept("", t0));
+	EXPECT_TRUE(limiter.accept("\\s:r1*00", t0));
+	EXPECT_TRUE(limiter.accept("\\s:r1*00", t0));
+	EXPECT_TRUE(limiter.accept("$GPHDT", t0));
+	EXPECT_TRUE(limiter.accept("$GPHDT", t0));
+
+	EXPECT_EQ(6u, limiter.get_statistics().passed);
+}
+
+TEST_F(test_nmea_sentence_limiter, clear)
+{
+	nmea::sentence_limiter limiter{1s, 1s};
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	limiter.clear();
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_EQ(3u, limiter.get_statistics().received);
+}
+
+TEST_F(test_nmea_sentence_limiter, reset_statistics)
+{
+	nmea::sentence_limiter limiter{1s, 1s};
+
+	EXPECT_TRUE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	EXPECT_FALSE(limiter.accept("$GPHDT,10.0,T*08", t0));
+	limiter.reset_statistics();
+
+	const auto stats = limiter.get_statistics();
+	EXPECT_EQ(0u, stats.received);
+	EXPECT_EQ(0u, stats.passed);
+	EXPECT_EQ(0u, stats.dropped_duplicate);
+	EXPECT_EQ(0u, stats.dropped_bytes);
+}
+}
@@ -3,6 +3,8 @@
 #include <marnav/nmea/ais_helper.hpp>
 #include <marnav/nmea/mtw.hpp>
 #include <marnav/nmea/nmea.hpp>
+#include <marnav/ais/ais.hpp>
+#include <marnav/ais/message_05.hpp>
 #include <gtest/gtest.h>
 
 namespace
@@ -167,4 +169,56 @@ TEST_F(test_nmea_vdm, make_vdms_2)
 		EXPECT_STREQ(expected[i], result.c_str());
 	}
 }
+
+TEST_F(test_nmea_vdm, write_vdms_1)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "177KQJ5000G?tO`K>RA1wUbN0TKH", 0);
+
+	char buffer[nmea::vdms_max_size];
+	const auto n = nmea::write_vdms(bits, buffer, sizeof(buffer));
+
+	EXPECT_EQ("!AIVDM,1,1,,B,177KQJ5000G?tO`K>RA1wUbN0TKH,0*5C\r\n", std::string(buffer, n));
+}
+
+TEST_F(test_nmea_vdm, write_vdms_2)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53", 0);
+	ais::append_payload(bits, "1@0000000000000", 2);
+
+	char buffer[nmea::vdms_max_size];
+	const auto n = nmea::write_vdms(bits, buffer, sizeof(buffer), 3);
+
+	EXPECT_EQ("!AIVDM,2,1,3,B,55P5TL01VIaAL@7WKO@mBplU@<PDhh000000001S;AJ::4A80?4i@E53,0*3E\r\n"
+			  "!AIVDM,2,2,3,B,1@0000000000000,2*55\r\n",
+		std::string(buffer, n));
+}
+
+TEST_F(test_nmea_vdm, write_vdms_same_as_make_vdms)
+{
+	ais::message_05 m;
+	m.set_mmsi(utils::mmsi{123456789});
+	m.set_shipname("TEST SHIP");
+	m.set_destination("SOMEWHERE");
+
+	std::string expected;
+	for (const auto & s : nmea::make_vdms(ais::encode_message(m), 7, nmea::ais_channel::A))
+		expected += nmea::to_string(*s) + "\r\n";
+
+	char buffer[nmea::vdms_max_size];
+	const auto n = nmea::write_vdms(m, buffer, sizeof(buffer), 7, nmea::ais_channel::A);
+
+	EXPECT_EQ(expected, std::string(buffer, n));
+}
+
+TEST_F(test_nmea_vdm, write_vdms_buffer_too_small)
+{
+	ais::raw bits;
+	ais::append_payload(bits, "177KQJ5000G?tO`K>RA1wUbN0TKH", 0);
+
+	char buffer[40];
+	EXPECT_THROW(nmea::write_vdms(bits, buffer, sizeof(buffer)), std::length_error);
+	EXPECT_THROW(nmea::write_vdms(ais::raw{}, buffer, sizeof(buffer)), std::invalid_argument);
+}
 }
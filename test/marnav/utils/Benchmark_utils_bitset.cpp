@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include "benchmark_allocation.hpp"
+#include <marnav/ais/binary_data.hpp>
+#include <marnav/utils/bitset.hpp>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/// All offsets and number of bits of the AIS message layouts (`bitset_value`).
+static const std::vector<std::pair<std::size_t, std::size_t>> layout = {
+	{0, 6}, {6, 2}, {8, 30}, {38, 2}, {38, 4}, {38, 5}, {38, 12}, {38, 14},
+	{40, 8}, {40, 10}, {40, 12}, {40, 18}, {40, 20}, {40, 30}, {42, 8}, {43, 20},
+	{46, 10}, {48, 3}, {50, 6}, {50, 10}, {52, 4}, {52, 12}, {56, 1}, {56, 3},
+	{56, 5}, {57, 28}, {58, 17}, {59, 11}, {60, 1}, {61, 5}, {61, 28}, {64, 4},
+	{66, 4}, {66, 6}, {68, 1}, {69, 18}, {69, 30}, {70, 1}, {70, 2}, {70, 7},
+	{70, 12}, {70, 20}, {72, 6}, {72, 10}, {72, 30}, {75, 18}, {78, 1}, {79, 28},
+	{82, 4}, {82, 6}, {85, 27}, {86, 3}, {87, 17}, {89, 11}, {89, 27}, {90, 7},
+	{93, 17}, {100, 12}, {102, 2}, {104, 18}, {104, 30}, {107, 27}, {110, 4}, {112, 4},
+	{112, 12}, {112, 20}, {114, 8}, {116, 3}, {116, 12}, {119, 11}, {122, 17}, {124, 9},
+	{128, 6}, {128, 9}, {130, 12}, {132, 9}, {132, 30}, {133, 6}, {134, 2}, {134, 4},
+	{134, 8}, {136, 30}, {137, 6}, {139, 1}, {140, 1}, {141, 1}, {141, 9}, {142, 1},
+	{142, 3}, {142, 4}, {143, 1}, {143, 2}, {143, 20}, {144, 1}, {144, 2}, {145, 1},
+	{146, 1}, {146, 3}, {146, 4}, {147, 1}, {148, 1}, {148, 20}, {149, 11}, {149, 19},
+	{150, 4}, {150, 6}, {156, 6}, {163, 1}, {164, 28}, {166, 2}, {192, 27}, {219, 9},
+	{228, 9}, {232, 8}, {237, 6}, {240, 9}, {243, 6}, {249, 4}, {249, 9}, {253, 6},
+	{258, 6}, {259, 1}, {260, 8}, {263, 8}, {264, 6}, {268, 1}, {269, 1}, {270, 1},
+	{270, 4}, {271, 9}, {274, 4}, {278, 5}, {280, 9}, {283, 5}, {288, 6}, {289, 6},
+	{294, 8}, {295, 6}, {301, 4}, {302, 20}, {305, 1}, {306, 1}, {307, 1}, {422, 1},
+};
+
+/// Bitset large enough for all layouts, with a non-trivial bit pattern.
+template <class Bits>
+static Bits make_bits()
+{
+	Bits bits;
+	for (std::size_t i = 0; i < 432; ++i)
+		bits.append((i % 3) == 0 ? 1u : 0u, 1);
+	return bits;
+}
+}
+
+template <class Bits>
+static void benchmark_bitset_get(benchmark::State & state)
+{
+	const auto bits = make_bits<Bits>();
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & e : layout) {
+			auto v = bits.template get<uint32_t>(e.first, e.second);
+			benchmark::DoNotOptimize(v);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(layout.size()));
+}
+
+template <class Bits>
+static void benchmark_bitset_set(benchmark::State & state)
+{
+	auto bits = make_bits<Bits>();
+	marnav_test::allocation_counter allocs{state};
+	for (auto _ : state) {
+		for (const auto & e : layout)
+			bits.set(uint32_t{0x2aaaaaaa}, e.first, e.second);
+		benchmark::DoNotOptimize(bits);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(layout.size()));
+}
+
+BENCHMARK_TEMPLATE(benchmark_bitset_get, marnav::ais::raw);
+BENCHMARK_TEMPLATE(benchmark_bitset_get, marnav::utils::bitset<uint8_t>);
+BENCHMARK_TEMPLATE(benchmark_bitset_get, marnav::utils::bitset<uint32_t>);
+BENCHMARK_TEMPLATE(benchmark_bitset_set, marnav::ais::raw);
+BENCHMARK_TEMPLATE(benchmark_bitset_set, marnav::utils::bitset<uint8_t>);
+BENCHMARK_TEMPLATE(benchmark_bitset_set, marnav::utils::bitset<uint32_t>);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,6 @@
 #include <marnav/utils/bitset.hpp>
 #include <marnav/utils/bitset_string.hpp>
+#include <marnav/utils/static_vector.hpp>
 #include <gtest/gtest.h>
 
 namespace
@@ -162,6 +163,70 @@ TEST_F(test_utils_bitset, uint8_append_zero_bits)
 	EXPECT_STREQ("", to_string(b).c_str());
 }
 
+TEST_F(test_utils_bitset, uint8_append_packed_aligned)
+{
+	const uint8_t data[] = {0xaa, 0xf0, 0xff};
+
+	bitset<uint8_t> b;
+	b.append_packed(data, 20);
+	EXPECT_EQ(20u, b.size());
+	EXPECT_STREQ("10101010111100001111", to_string(b).c_str());
+
+	// unused bits of the last block must not appear
+	b.append(0, 4);
+	EXPECT_STREQ("101010101111000011110000", to_string(b).c_str());
+}
+
+TEST_F(test_utils_bitset, uint8_append_packed_unaligned)
+{
+	const uint8_t data[] = {0xaa, 0xf0};
+
+	bitset<uint8_t> b;
+	b.append(1, 3);
+	b.append_packed(data, 12);
+	EXPECT_EQ(15u, b.size());
+	EXPECT_STREQ("001101010101111", to_string(b).c_str());
+}
+
+TEST_F(test_utils_bitset, uint8_append_packed_zero_bits)
+{
+	const uint8_t data[] = {0xaa};
+
+	bitset<uint8_t> b;
+	b.append_packed(data, 0);
+	EXPECT_EQ(0u, b.size());
+}
+
+TEST_F(test_utils_bitset, uint16_append_packed)
+{
+	const uint16_t data[] = {0x1234, 0x5678, 0x9abc};
+
+	bitset<uint16_t> b;
+	b.append_packed(data, 40);
+	EXPECT_EQ(40u, b.size());
+	EXPECT_EQ(0x12345678u, b.get<uint32_t>(0));
+	EXPECT_EQ(0x9au, b.get<uint32_t>(32, 8));
+}
+
+TEST_F(test_utils_bitset, static_container)
+{
+	using static_bitset = bitset<uint8_t, static_vector<uint8_t, 2>>;
+
+	static_bitset b;
+	b.append(0xaa, 8);
+	b.append(0x5, 4);
+	EXPECT_STREQ("101010100101", to_string(b).c_str());
+	EXPECT_EQ(0xa5u, b.get<uint8_t>(4, 8));
+
+	bitset<uint8_t> d;
+	d.append(0xaa, 8);
+	d.append(0x5, 4);
+	EXPECT_TRUE(b == d);
+
+	EXPECT_THROW(b.append(0xff, 8), std::length_error);
+	EXPECT_THROW(static_bitset(17), std::length_error);
+}
+
 TEST_F(test_utils_bitset, uint8_set_into_self)
 {
 	bitset<uint8_t> b;
@@ -1774,4 +1839,104 @@ TEST_F(test_utils_bitset, uint8_shift_right)
 		EXPECT_STREQ("01010101", to_string(b).c_str());
 	}
 }
+
+template <class Block>
+class test_utils_bitset_window : public ::testing::Test
+{
+public:
+	// pattern with bits in all positions of a block
+	static bitset<Block> make_pattern(std::size_t n)
+	{
+		bitset<Block> b;
+		for (std::size_t i = 0; i < n; ++i)
+			b.append(((i * 7) % 3) == 0 ? 1u : 0u, 1);
+		return b;
+	}
+
+	// reference implementation, bit by bit
+	static uint64_t read_bits(const bitset<Block> & b, std::size_t ofs, std::size_t bits)
+	{
+		uint64_t v = 0;
+		for (std::size_t i = 0; i < bits; ++i)
+			v = (v << 1) | (b.get_bit(ofs + i) ? 1u : 0u);
+		return v;
+	}
+};
+
+using block_types = ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(test_utils_bitset_window, block_types, );
+
+TYPED_TEST(test_utils_bitset_window, get_all_offsets_and_widths)
+{
+	const std::size_t n = 200;
+	const auto b = TestFixture::make_pattern(n);
+
+	for (std::size_t bits = 1; bits <= 64; ++bits) {
+		for (std::size_t ofs = 0; ofs + bits <= n; ++ofs) {
+			ASSERT_EQ(TestFixture::read_bits(b, ofs, bits), b.template get<uint64_t>(ofs, bits))
+				<< "ofs=" << ofs << ", bits=" << bits;
+		}
+	}
+}
+
+TYPED_TEST(test_utils_bitset_window, get_at_end)
+{
+	// the 64 bit window exceeds the data at the end
+	bitset<TypeParam> b;
+	b.append(0x5u, 3);
+	EXPECT_EQ(0x5u, b.template get<uint32_t>(0, 3));
+	EXPECT_EQ(0x1u, b.template get<uint32_t>(2, 1));
+	EXPECT_ANY_THROW(b.template get<uint32_t>(2, 2));
 }
+
+TYPED_TEST(test_utils_bitset_window, set_all_offsets_and_widths)
+{
+	const std::size_t n = 200;
+	const uint64_t value = 0xa5c3'5a3c'f00f'0ff0ull;
+
+	for (std::size_t bits = 1; bits <= 64; ++bits) {
+		for (std::size_t ofs = 0; ofs + bits <= n; ++ofs) {
+			auto b = TestFixture::make_pattern(n);
+			const auto expected = TestFixture::make_pattern(n);
+
+			b.set(value, ofs, bits);
+
+			const uint64_t mask = (bits == 64) ? ~uint64_t{0} : ((uint64_t{1} << bits) - 1);
+			ASSERT_EQ(value & mask, TestFixture::read_bits(b, ofs, bits))
+				<< "ofs=" << ofs << ", bits=" << bits;
+
+			// surrounding bits must not be modified
+			ASSERT_EQ(n, b.size());
+			if (ofs > 0) {
+				ASSERT_EQ(TestFixture::read_bits(expected, 0, 1),
+					TestFixture::read_bits(b, 0, 1));
+				ASSERT_EQ(TestFixture::read_bits(expected, ofs - 1, 1),
+					TestFixture::read_bits(b, ofs - 1, 1));
+			}
+			if (ofs + bits < n) {
+				ASSERT_EQ(TestFixture::read_bits(expected, ofs + bits, 1),
+					TestFixture::read_bits(b, ofs + bits, 1));
+				ASSERT_EQ(TestFixture::read_bits(expected, n - 1, 1),
+					TestFixture::read_bits(b, n - 1, 1));
+			}
+		}
+	}
+}
+
+TYPED_TEST(test_utils_bitset_window, set_extends)
+{
+	bitset<TypeParam> b;
+	b.set(0x3u, 70, 2);
+	EXPECT_EQ(72u, b.size());
+	EXPECT_EQ(0x3u, b.template get<uint8_t>(70, 2));
+	EXPECT_EQ(0u, b.template get<uint64_t>(0, 64));
+}
+
+TYPED_TEST(test_utils_bitset_window, set_signed_value)
+{
+	bitset<TypeParam> b(16);
+	b.set(int8_t{-1}, 4, 4);
+	EXPECT_EQ(0x0f00u, b.template get<uint16_t>(0));
+}
+}
+
@@ -0,0 +1,137 @@
+#include <marnav/utils/bitset_view.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+
+namespace
+{
+using namespace marnav::utils;
+
+class test_utils_bitset_view : public ::testing::Test
+{
+public:
+	/// Returns a bitset with a pseudo random bit pattern.
+	template <class Block>
+	static bitset<Block> make_bits(std::size_t n)
+	{
+		bitset<Block> bits;
+		uint32_t x = 0x12345678u;
+		for (std::size_t i = 0; i < n; ++i) {
+			x = x * 1103515245u + 12345u;
+			bits.append((x >> 16) & 1u, 1);
+		}
+		return bits;
+	}
+};
+
+TEST_F(test_utils_bitset_view, default_construction)
+{
+	bitset_view<uint8_t> view;
+	EXPECT_EQ(0u, view.size());
+	EXPECT_TRUE(view.empty());
+	EXPECT_ANY_THROW(view.get_bit(0));
+}
+
+TEST_F(test_utils_bitset_view, entire_bitset)
+{
+	const auto bits = make_bits<uint8_t>(100);
+	const bitset_view<uint8_t> view{bits};
+
+	ASSERT_EQ(bits.size(), view.size());
+	for (std::size_t i = 0; i < bits.size(); ++i)
+		EXPECT_EQ(bits[i], view[i]) << "index " << i;
+}
+
+TEST_F(test_utils_bitset_view, get_same_as_bitset)
+{
+	const auto bits = make_bits<uint8_t>(200);
+
+	for (std::size_t ofs = 0; ofs < 40; ++ofs) {
+		const bitset_view<uint8_t> view{bits, ofs, bits.size() - ofs};
+		for (std::size_t i = 0; i < 80; ++i) {
+			for (std::size_t n = 1; n <= 64; ++n) {
+				EXPECT_EQ(bits.get<uint64_t>(ofs + i, n), view.get<uint64_t>(i, n))
+					<< "ofs=" << ofs << " i=" << i << " n=" << n;
+			}
+		}
+	}
+}
+
+TEST_F(test_utils_bitset_view, get_uint32_blocks)
+{
+	const auto bits = make_bits<uint32_t>(200);
+	const bitset_view<uint32_t> view{bits, 13, 150};
+
+	for (std::size_t i = 0; i < 100; ++i)
+		EXPECT_EQ(bits.get<uint64_t>(13 + i, 50), view.get<uint64_t>(i, 50)) << "i=" << i;
+}
+
+TEST_F(test_utils_bitset_view, get_at_end)
+{
+	bitset<uint8_t> bits;
+	bits.append(0x5, 3);
+	bits.append(0x1ab, 9);
+
+	const bitset_view<uint8_t> view{bits, 3, 9};
+	EXPECT_EQ(0x1abu, view.get<uint32_t>(0, 9));
+	EXPECT_EQ(0xbu, view.get<uint32_t>(5, 4));
+	EXPECT_ANY_THROW(view.get<uint32_t>(5, 5));
+}
+
+TEST_F(test_utils_bitset_view, get_invalid_number_of_bits)
+{
+	const auto bits = make_bits<uint8_t>(100);
+	const bitset_view<uint8_t> view{bits};
+
+	EXPECT_ANY_THROW(view.get<uint8_t>(0, 9));
+	EXPECT_EQ(0u, view.get<uint8_t>(0, 0));
+}
+
+TEST_F(test_utils_bitset_view, get_enum_and_bool)
+{
+	enum class e : uint8_t { a = 1, b = 2, c = 3 };
+
+	bitset<uint8_t> bits;
+	bits.append(0, 7);
+	bits.append(3, 2);
+	bits.append(1, 1);
+
+	const bitset_view<uint8_t> view{bits, 7, 3};
+	EXPECT_EQ(e::c, view.get<e>(0, 2));
+
+	bool flag = false;
+	view.get(flag, 2);
+	EXPECT_TRUE(flag);
+	EXPECT_TRUE(view.get(2));
+	EXPECT_TRUE(view.test(1));
+}
+
+TEST_F(test_utils_bitset_view, view_exceeds_bitset)
+{
+	const auto bits = make_bits<uint8_t>(100);
+
+	EXPECT_NO_THROW((bitset_view<uint8_t>{bits, 50, 50}));
+	EXPECT_ANY_THROW((bitset_view<uint8_t>{bits, 50, 51}));
+}
+
+TEST_F(test_utils_bitset_view, subview)
+{
+	const auto bits = make_bits<uint8_t>(200);
+	const bitset_view<uint8_t> view{bits, 5, 190};
+	const auto sub = view.subview(17, 100);
+
+	ASSERT_EQ(100u, sub.size());
+	for (std::size_t i = 0; i < sub.size(); ++i)
+		EXPECT_EQ(bits[5 + 17 + i], sub[i]) << "index " << i;
+
+	EXPECT_ANY_THROW(view.subview(100, 91));
+}
+
+TEST_F(test_utils_bitset_view, external_memory)
+{
+	const uint8_t data[] = {0x12, 0x34, 0x56, 0x78};
+	const bitset_view<uint8_t> view{data, 4, 24};
+
+	EXPECT_EQ(0x234567u, view.get<uint32_t>(0, 24));
+	EXPECT_EQ(0x45u, view.get<uint32_t>(8, 8));
+}
+}
@@ -0,0 +1,122 @@
+#include <marnav/utils/parse_statistics.hpp>
+#include <marnav/nmea/nmea.hpp>
+#include <marnav/nmea/sentence.hpp>
+#include <marnav/ais/ais.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+using namespace marnav;
+
+class test_utils_parse_statistics : public ::testing::Test
+{
+public:
+	void SetUp() override
+	{
+		nmea::reset_parse_statistics();
+		ais::reset_parse_statistics();
+	}
+
+	template <class Container, class Id>
+	static utils::parse_statistics find(const Container & c, Id id)
+	{
+		const auto i = std::find_if(
+			std::begin(c), std::end(c), [id](const auto & e) { return e.first == id; });
+		return (i != std::end(c)) ? i->second : utils::parse_statistics{};
+	}
+
+	template <class Container>
+	static void parse_nmea(Container & v)
+	{
+		for (const auto & s : v) {
+			try {
+				nmea::make_sentence(s);
+			} catch (...) {
+				// counted by statistics
+			}
+		}
+	}
+};
+
+TEST_F(test_utils_parse_statistics, statistics_total)
+{
+	utils::parse_statistics s;
+	s.parsed = 1;
+	s.failed_checksum = 2;
+	s.failed_unknown = 3;
+	s.failed_invalid = 4;
+
+	EXPECT_EQ(9u, s.failed());
+	EXPECT_EQ(10u, s.total());
+}
+
+TEST_F(test_utils_parse_statistics, nmea_statistics)
+{
+	const std::vector<std::string> v = {
+		"$GPHDT,10.0,T*04",
+		"$GPHDT,11.0,T*05",
+		"$GPHDT,10.0,T*00", // checksum
+		"$GPXYZ,10.0,T*07", // unknown
+		"$GPHDT,,,,T*1B", // invalid
+		"$,", // malformed
+	};
+	parse_nmea(v);
+
+	const auto stats = nmea::get_parse_statistics();
+
+	if (!utils::is_instrumentation_enabled()) {
+		EXPECT_TRUE(stats.empty());
+		return;
+	}
+
+	const auto hdt = find(stats, nmea::sentence_id::HDT);
+	EXPECT_EQ(2u, hdt.parsed);
+	EXPECT_EQ(1u, hdt.failed_checksum);
+	EXPECT_EQ(1u, hdt.failed_invalid);
+	EXPECT_EQ(0u, hdt.failed_unknown);
+	EXPECT_EQ(4u, std::accumulate(hdt.latency.begin(), hdt.latency.end(), uint64_t{0}));
+
+	const auto none = find(stats, nmea::sentence_id::NONE);
+	EXPECT_EQ(0u, none.parsed);
+	EXPECT_EQ(1u, none.failed_unknown);
+	EXPECT_EQ(1u, none.failed_invalid);
+}
+
+TEST_F(test_utils_parse_statistics, nmea_reset)
+{
+	const std::vector<std::string> v = {"$GPHDT,10.0,T*04"};
+	parse_nmea(v);
+	nmea::reset_parse_statistics();
+
+	EXPECT_TRUE(nmea::get_parse_statistics().empty());
+}
+
+TEST_F(test_utils_parse_statistics, ais_statistics)
+{
+	ais::make_message({{"13u?etPv2;0n:dDPwUM1U1Cb069D", 0}});
+	EXPECT_ANY_THROW(ais::make_message({{"h3u?etPv2;0n:dDPwUM1U1Cb069D", 0}})); // unknown
+	EXPECT_ANY_THROW(ais::make_message({{"13u?etPv2;0n", 0}})); // invalid size
+	EXPECT_ANY_THROW(ais::make_message({{"13u?etPv2;0n", 6}})); // invalid fill bits
+
+	const auto stats = ais::get_parse_statistics();
+
+	if (!utils::is_instrumentation_enabled()) {
+		EXPECT_TRUE(stats.empty());
+		return;
+	}
+
+	const auto m01 = find(stats, ais::message_id::position_report_class_a);
+	EXPECT_EQ(1u, m01.parsed);
+	EXPECT_EQ(1u, m01.failed_invalid);
+	EXPECT_EQ(2u, m01.total());
+
+	const auto unknown = find(stats, static_cast<ais::message_id>(48));
+	EXPECT_EQ(1u, unknown.failed_unknown);
+
+	const auto none = find(stats, ais::message_id::NONE);
+	EXPECT_EQ(0u, none.failed_unknown);
+	EXPECT_EQ(1u, none.failed_invalid);
+}
+}
@@ -0,0 +1,103 @@
+#include <marnav/utils/static_vector.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+
+namespace
+{
+using namespace marnav::utils;
+
+class test_utils_static_vector : public ::testing::Test
+{
+};
+
+TEST_F(test_utils_static_vector, default_construction)
+{
+	static_vector<uint8_t, 4> v;
+	EXPECT_EQ(0u, v.size());
+	EXPECT_TRUE(v.empty());
+	EXPECT_EQ(4u, v.capacity());
+	EXPECT_EQ(v.begin(), v.end());
+}
+
+TEST_F(test_utils_static_vector, construction_initializer_list)
+{
+	static_vector<uint8_t, 4> v{1, 2, 3};
+	ASSERT_EQ(3u, v.size());
+	EXPECT_EQ(1u, v[0]);
+	EXPECT_EQ(2u, v[1]);
+	EXPECT_EQ(3u, v[2]);
+	EXPECT_EQ(1u, v.front());
+	EXPECT_EQ(3u, v.back());
+}
+
+TEST_F(test_utils_static_vector, construction_exceeds_capacity)
+{
+	using vector = static_vector<uint8_t, 2>;
+	EXPECT_THROW(vector({1, 2, 3}), std::length_error);
+	EXPECT_THROW(vector(3), std::length_error);
+}
+
+TEST_F(test_utils_static_vector, push_back)
+{
+	static_vector<uint8_t, 2> v;
+	v.push_back(1);
+	v.push_back(2);
+	EXPECT_EQ(2u, v.size());
+	EXPECT_THROW(v.push_back(3), std::length_error);
+	EXPECT_EQ(2u, v.size());
+}
+
+TEST_F(test_utils_static_vector, resize_initializes_new_elements)
+{
+	static_vector<uint8_t, 4> v{1, 2, 3, 4};
+	v.resize(1);
+	v.resize(3);
+	ASSERT_EQ(3u, v.size());
+	EXPECT_EQ(1u, v[0]);
+	EXPECT_EQ(0u, v[1]);
+	EXPECT_EQ(0u, v[2]);
+}
+
+TEST_F(test_utils_static_vector, reserve)
+{
+	static_vector<uint8_t, 4> v;
+	EXPECT_NO_THROW(v.reserve(4));
+	EXPECT_THROW(v.reserve(5), std::length_error);
+	EXPECT_EQ(0u, v.size());
+}
+
+TEST_F(test_utils_static_vector, clear)
+{
+	static_vector<uint8_t, 4> v{1, 2};
+	v.clear();
+	EXPECT_TRUE(v.empty());
+}
+
+TEST_F(test_utils_static_vector, at)
+{
+	static_vector<uint8_t, 4> v{1, 2};
+	EXPECT_EQ(2u, v.at(1));
+	EXPECT_THROW(v.at(2), std::out_of_range);
+}
+
+TEST_F(test_utils_static_vector, comparison)
+{
+	static_vector<uint8_t, 4> a{1, 2};
+	static_vector<uint8_t, 4> b{1, 2};
+	static_vector<uint8_t, 4> c{1, 2, 0};
+
+	EXPECT_TRUE(a == b);
+	EXPECT_FALSE(a != b);
+	EXPECT_FALSE(a == c);
+	EXPECT_TRUE(a != c);
+}
+
+TEST_F(test_utils_static_vector, copy)
+{
+	static_vector<uint8_t, 4> a{1, 2};
+	auto b = a;
+	b.push_back(3);
+	EXPECT_EQ(2u, a.size());
+	EXPECT_EQ(3u, b.size());
+}
+}